@@ -0,0 +1,584 @@
+//
+// GUIslice Library Benchmarks
+// - Calvin Hass
+// - https://www.impulseadventure.com/elec/guislice-gui.html
+// - https://github.com/ImpulseAdventure/GUIslice
+// - Headless rendering benchmark (LINUX):
+//   - Times the core drawing primitives, full page redraws,
+//     budgeted updates, extended element redraws and touch hit-testing
+//   - Renders into the software framebuffer driver (DRV_DISP_FB)
+//     without any output sink
+//   - Results are written to stdout as CSV:
+//       bench,ops,ns_per_op,pix_per_op,calls_per_op
+//     where pix_per_op counts frame pixels written and calls_per_op
+//     counts drawing calls into the driver
+//
+// USAGE:
+//   make && ./bench [iterations]
+//
+#include "GUIslice.h"
+#include "GUIslice_drv.h"
+
+// Include any extended elements
+#include "elem/XRingGauge.h"
+#include "elem/XGraph.h"
+#include "elem/XListbox.h"
+#include "elem/XKeyPad_Num.h"
+#include "elem/XGlowball.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+// Enumerations for pages, elements, fonts, images
+enum { E_PG_PRIM, E_PG_MAIN, E_PG_RING, E_PG_GRAPH, E_PG_LISTBOX, E_PG_KEYPAD,
+       E_PG_GLOW, E_PG_READOUT, E_PG_HIT10, E_PG_HIT100, E_PG_HIT500, MAX_PAGE };
+enum { E_FONT_TXT, E_FONT_TXT2, MAX_FONT };
+
+// Instantiate the GUI
+#define MAX_ELEM_PG_PRIM    1
+#define MAX_ELEM_PG_MAIN    16
+#define MAX_ELEM_PG_WIDGET  2
+#define MAX_ELEM_PG_HIT     500
+
+#define BENCH_ITER_DEF      200     // Default number of iterations per benchmark
+#define BENCH_HIT_QUERIES   20000   // Number of coordinates per hit-test benchmark
+#define BENCH_HIT_GRID_COLS 8
+#define BENCH_HIT_GRID_ROWS 8
+#define MAX_TICK            4
+#define BENCH_BUDGET_US     20      // Time budget per gslc_UpdateBudget() call
+
+gslc_tsGui                  m_gui;
+gslc_tsDriver               m_drv;
+gslc_tsFont                 m_asFont[MAX_FONT];
+gslc_tsPage                 m_asPage[MAX_PAGE];
+
+gslc_tsElem                 m_asPgPrimElem[MAX_ELEM_PG_PRIM];
+gslc_tsElemRef              m_asPgPrimElemRef[MAX_ELEM_PG_PRIM];
+gslc_tsElem                 m_asPgMainElem[MAX_ELEM_PG_MAIN];
+gslc_tsElemRef              m_asPgMainElemRef[MAX_ELEM_PG_MAIN];
+gslc_tsElem                 m_asPgWidgetElem[E_PG_READOUT-E_PG_RING+1][MAX_ELEM_PG_WIDGET];
+gslc_tsElemRef              m_asPgWidgetElemRef[E_PG_READOUT-E_PG_RING+1][MAX_ELEM_PG_WIDGET];
+gslc_tsElem                 m_asPgHitElem[3][MAX_ELEM_PG_HIT];
+gslc_tsElemRef              m_asPgHitElemRef[3][MAX_ELEM_PG_HIT];
+
+gslc_tsHitGrid              m_asHitGrid[3];
+gslc_tsTick                 m_asTick[MAX_TICK];
+uint32_t                    m_nTickCnt = 0;
+uint8_t                     m_anHitGridBuf[3][GSLC_HITGRID_BUF_SIZE(BENCH_HIT_GRID_COLS,BENCH_HIT_GRID_ROWS,MAX_ELEM_PG_HIT)];
+
+// Extended element data
+gslc_tsXRingGauge           m_sXRingGauge;
+gslc_tsXGraph               m_sXGraph;
+gslc_tsXListbox             m_sXListbox;
+gslc_tsXKeyPad              m_sXKeyPad;
+gslc_tsXGlowball            m_sXGlowball;
+
+#define RING_STR_LEN        8
+char                        m_acRingStr[RING_STR_LEN];
+#define RING_QUALITY        72
+gslc_tsPt                   m_asRingCache[XRING_POLAR_CACHE_PTS(RING_QUALITY)];
+#define GRAPH_ROWS          100
+int16_t                     m_anGraphBuf[GRAPH_ROWS];
+#define LISTBOX_BUF_LEN     200
+uint8_t                     m_anListboxBuf[LISTBOX_BUF_LEN];
+
+#define NUM_RINGS 6
+gslc_tsXGlowballRing m_asRings[NUM_RINGS] = {
+  {0,12,(gslc_tsColor) { 138, 0, 255 }},
+  {12,24,(gslc_tsColor) { 0, 96, 255 }},
+  {24,36,(gslc_tsColor) { 0, 255, 150 }},
+  {36,48,(gslc_tsColor) { 255, 234, 0 }},
+  {48,54,(gslc_tsColor) { 255, 152, 0 }},
+  {54,60,(gslc_tsColor) { 255, 0, 0 }}
+};
+#define GLOW_QUALITY        72
+gslc_tsPt                   m_asGlowCache[XGLOWBALL_POLAR_CACHE_PTS(GLOW_QUALITY,NUM_RINGS)];
+#define READOUT_STR_LEN     16
+char                        m_acReadoutStr[READOUT_STR_LEN];
+gslc_tsTxtIncr              m_sReadoutIncr;
+
+gslc_tsElemRef*             m_pElemRing     = NULL;
+gslc_tsElemRef*             m_pElemGraph    = NULL;
+gslc_tsElemRef*             m_pElemListbox  = NULL;
+gslc_tsElemRef*             m_pElemKeyPad   = NULL;
+gslc_tsElemRef*             m_pElemGlow     = NULL;
+gslc_tsElemRef*             m_pElemReadout  = NULL;
+gslc_tsElemRef*             m_pElemMainBtn  = NULL;
+
+uint32_t                    m_nIter = BENCH_ITER_DEF;
+
+static int16_t DebugOut(char ch) { fputc(ch,stderr); return 0; }
+
+// ------------------------------------------------
+// Measurement
+// ------------------------------------------------
+
+// Snapshot of the counters at the start of a benchmark
+uint64_t                    m_nBenchStartNs;
+uint32_t                    m_nBenchStartPix;
+uint32_t                    m_nBenchStartDraw;
+
+uint64_t BenchNowNs(void)
+{
+  struct timespec sTime;
+  clock_gettime(CLOCK_MONOTONIC,&sTime);
+  return (uint64_t)sTime.tv_sec * 1000000000ULL + (uint64_t)sTime.tv_nsec;
+}
+
+void BenchStart(void)
+{
+  m_nBenchStartPix  = m_drv.nStatPixCnt;
+  m_nBenchStartDraw = m_drv.nStatDrawCnt;
+  m_nBenchStartNs   = BenchNowNs();
+}
+
+void BenchEnd(const char* pStrName,uint32_t nOps)
+{
+  uint64_t nElapsedNs = BenchNowNs() - m_nBenchStartNs;
+  uint32_t nPix  = m_drv.nStatPixCnt - m_nBenchStartPix;
+  uint32_t nDraw = m_drv.nStatDrawCnt - m_nBenchStartDraw;
+  printf("%s,%u,%.1f,%.1f,%.2f\n",pStrName,nOps,
+    (double)nElapsedNs / nOps,(double)nPix / nOps,(double)nDraw / nOps);
+}
+
+// Reproducible pseudo-random coordinates for hit-testing
+uint32_t m_nRandState = 1;
+uint16_t BenchRand(uint16_t nMax)
+{
+  m_nRandState = m_nRandState * 1103515245UL + 12345UL;
+  return (uint16_t)((m_nRandState >> 16) % nMax);
+}
+
+// ------------------------------------------------
+// Benchmarks
+// ------------------------------------------------
+
+void BenchPrimitives(gslc_tsGui* pGui)
+{
+  uint32_t nInd;
+  gslc_SetPageCur(pGui,E_PG_PRIM);
+  gslc_Update(pGui);
+
+  BenchStart();
+  for (nInd=0;nInd<m_nIter;nInd++) {
+    gslc_DrawFillCircle(pGui,240,160,20+(nInd%40),GSLC_COL_BLUE);
+  }
+  BenchEnd("draw_fill_circle",m_nIter);
+
+  BenchStart();
+  for (nInd=0;nInd<m_nIter;nInd++) {
+    gslc_DrawFillTriangle(pGui,40,300,240,20+(nInd%40),440,300,GSLC_COL_GREEN);
+  }
+  BenchEnd("draw_fill_triangle",m_nIter);
+
+  BenchStart();
+  for (nInd=0;nInd<m_nIter;nInd++) {
+    gslc_DrawFillSector(pGui,72,240,160,40,60,GSLC_COL_ORANGE,0,90+(nInd%270));
+  }
+  BenchEnd("draw_fill_sector",m_nIter);
+
+  char acTxt[] = "GUIslice benchmark 0123456789";
+  gslc_tsRect rTxt = (gslc_tsRect){20,140,440,40};
+  gslc_tsFont* pFont = gslc_FontGet(pGui,E_FONT_TXT2);
+  BenchStart();
+  for (nInd=0;nInd<m_nIter;nInd++) {
+    gslc_DrawTxtBase(pGui,acTxt,rTxt,pFont,(gslc_teTxtFlags)(GSLC_TXT_MEM_RAM | GSLC_TXT_ALLOC_EXT),GSLC_ALIGN_MID_MID,
+      GSLC_COL_WHITE,GSLC_COL_BLACK,0,0);
+  }
+  BenchEnd("draw_txt_base",m_nIter);
+}
+
+void BenchPageRedraw(gslc_tsGui* pGui)
+{
+  uint32_t nInd;
+  gslc_SetPageCur(pGui,E_PG_MAIN);
+  gslc_Update(pGui);
+
+  BenchStart();
+  for (nInd=0;nInd<m_nIter;nInd++) {
+    gslc_PageRedrawSet(pGui,true);
+    gslc_PageRedrawGo(pGui);
+  }
+  BenchEnd("page_redraw_full",m_nIter);
+}
+
+// Time a full redraw of an element and an incremental update
+// driven by a value change through gslc_Update()
+void BenchElem(gslc_tsGui* pGui,int16_t nPageId,gslc_tsElemRef* pElemRef,
+  const char* pStrFull,const char* pStrInc,void (*pfuncSetVal)(gslc_tsGui*,uint32_t))
+{
+  uint32_t nInd;
+  gslc_SetPageCur(pGui,nPageId);
+  // Start from the same value so that repeated runs are comparable
+  (*pfuncSetVal)(pGui,0);
+  gslc_Update(pGui);
+
+  BenchStart();
+  for (nInd=0;nInd<m_nIter;nInd++) {
+    gslc_ElemSetRedraw(pGui,pElemRef,GSLC_REDRAW_FULL);
+    gslc_Update(pGui);
+  }
+  BenchEnd(pStrFull,m_nIter);
+
+  BenchStart();
+  for (nInd=0;nInd<m_nIter;nInd++) {
+    (*pfuncSetVal)(pGui,nInd);
+    gslc_Update(pGui);
+  }
+  BenchEnd(pStrInc,m_nIter);
+}
+
+void BenchSetRing(gslc_tsGui* pGui,uint32_t nInd)
+{
+  gslc_ElemXRingGaugeSetVal(pGui,m_pElemRing,(int16_t)(nInd % 100));
+}
+
+void BenchSetGraph(gslc_tsGui* pGui,uint32_t nInd)
+{
+  gslc_ElemXGraphAdd(pGui,m_pElemGraph,(int16_t)(nInd % 50));
+}
+
+void BenchSetListbox(gslc_tsGui* pGui,uint32_t nInd)
+{
+  gslc_ElemXListboxSetSel(pGui,m_pElemListbox,(int16_t)(nInd % 6));
+}
+
+void BenchSetKeyPad(gslc_tsGui* pGui,uint32_t nInd)
+{
+  char acVal[12];
+  snprintf(acVal,sizeof(acVal),"%u",(unsigned)(nInd % 100000));
+  gslc_ElemXKeyPadValSet(pGui,m_pElemKeyPad,acVal);
+}
+
+void BenchSetGlow(gslc_tsGui* pGui,uint32_t nInd)
+{
+  gslc_ElemXGlowballSetVal(pGui,m_pElemGlow,(int16_t)(nInd % 60));
+}
+
+void BenchSetReadout(gslc_tsGui* pGui,uint32_t nInd)
+{
+  char acVal[READOUT_STR_LEN];
+  snprintf(acVal,sizeof(acVal),"%8.2f V",(double)(nInd % 10000) * 1.37);
+  gslc_ElemSetTxtStr(pGui,m_pElemReadout,acVal);
+}
+
+// Confirm that the displayed element matches a full redraw of it
+void BenchCheckElem(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,const char* pStrName)
+{
+  gslc_tsRect rElem = pElemRef->pElem->rElem;
+  uint32_t    nRowLen = (uint32_t)rElem.w * DRV_FB_PIX_BYTES;
+  uint8_t*    pSnap = (uint8_t*)malloc(nRowLen * rElem.h);
+  uint16_t    nRow;
+  bool        bSame = true;
+  if (!pSnap) { return; }
+  for (nRow=0;nRow<rElem.h;nRow++) {
+    memcpy(pSnap + nRow*nRowLen,
+      m_drv.pFrame + ((uint32_t)(rElem.y+nRow)*m_drv.nFrameW + rElem.x)*DRV_FB_PIX_BYTES,nRowLen);
+  }
+  gslc_ElemSetRedraw(pGui,pElemRef,GSLC_REDRAW_FULL);
+  gslc_Update(pGui);
+  for (nRow=0;nRow<rElem.h;nRow++) {
+    if (memcmp(pSnap + nRow*nRowLen,
+        m_drv.pFrame + ((uint32_t)(rElem.y+nRow)*m_drv.nFrameW + rElem.x)*DRV_FB_PIX_BYTES,nRowLen) != 0) {
+      bSame = false;
+    }
+  }
+  free(pSnap);
+  if (!bSame) {
+    fprintf(stderr,"ERROR: %s display differs from a full redraw\n",pStrName);
+  }
+}
+
+// Confirm that a glow change on an element with incremental text
+// is not skipped when only the frame color depends on the glow state
+void BenchCheckTxtIncrGlow(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef)
+{
+  gslc_tsElem* pElem = pElemRef->pElem;
+  gslc_tsColor colFrameGlow = pElem->colElemFrameGlow;
+  gslc_tsColor colFillGlow  = pElem->colElemFillGlow;
+  gslc_tsColor colTxtGlow   = pElem->colElemTextGlow;
+
+  gslc_ElemSetGlowCol(pGui,pElemRef,GSLC_COL_RED,pElem->colElemFill,pElem->colElemText);
+  gslc_ElemSetGlowEn(pGui,pElemRef,true);
+  gslc_Update(pGui);
+  gslc_ElemSetGlow(pGui,pElemRef,true);
+  gslc_Update(pGui);
+  BenchCheckElem(pGui,pElemRef,"txt_incr_glow_on");
+  gslc_ElemSetGlow(pGui,pElemRef,false);
+  gslc_Update(pGui);
+  BenchCheckElem(pGui,pElemRef,"txt_incr_glow_off");
+
+  gslc_ElemSetGlowEn(pGui,pElemRef,false);
+  gslc_ElemSetGlowCol(pGui,pElemRef,colFrameGlow,colFillGlow,colTxtGlow);
+  gslc_Update(pGui);
+}
+
+bool CbTickCount(void* pvGui,void* pvElemRef)
+{
+  (void)pvGui; // Unused
+  (void)pvElemRef; // Unused
+  m_nTickCnt++;
+  return true;
+}
+
+// Time the main loop when nothing needs redrawing, first with the
+// tick event issued to every element and then with the scheduler
+void BenchTick(gslc_tsGui* pGui)
+{
+  uint32_t nInd;
+  gslc_ElemSetTickFunc(pGui,m_pElemReadout,&CbTickCount);
+  gslc_SetPageCur(pGui,E_PG_READOUT);
+  gslc_Update(pGui);
+
+  BenchStart();
+  for (nInd=0;nInd<m_nIter;nInd++) {
+    gslc_Update(pGui);
+  }
+  BenchEnd("update_tick_all",m_nIter);
+
+  gslc_InitTick(pGui,m_asTick,MAX_TICK);
+  gslc_TickAdd(pGui,E_PG_READOUT,m_pElemReadout,0,true);
+  BenchStart();
+  for (nInd=0;nInd<m_nIter;nInd++) {
+    gslc_Update(pGui);
+  }
+  BenchEnd("update_tick_sched",m_nIter);
+
+  if (m_nTickCnt == 0) {
+    fprintf(stderr,"ERROR: tick callback was not called\n");
+  }
+  gslc_InitTick(pGui,NULL,0);
+  gslc_ElemSetTickFunc(pGui,m_pElemReadout,NULL);
+}
+
+// Time full page redraws spread over gslc_UpdateBudget() calls, with
+// an element changed part way through each redraw, and confirm that
+// the result matches a redraw performed in one call
+void BenchUpdateBudget(gslc_tsGui* pGui)
+{
+  uint32_t nInd;
+  uint32_t nCalls = 0;
+  uint32_t nFrameLen = (uint32_t)m_drv.nFrameW * m_drv.nFrameH * DRV_FB_PIX_BYTES;
+  gslc_SetPageCur(pGui,E_PG_MAIN);
+  gslc_Update(pGui);
+  gslc_UpdateLatencyReset(pGui);
+
+  BenchStart();
+  for (nInd=0;nInd<m_nIter;nInd++) {
+    uint32_t nStep = 0;
+    gslc_PageRedrawSet(pGui,true);
+    do {
+      if (++nStep == 3) {
+        gslc_ElemSetTxtStr(pGui,m_pElemMainBtn,(nInd % 2)? "Button" : "Pressed");
+      }
+    } while (!gslc_UpdateBudget(pGui,BENCH_BUDGET_US));
+    nCalls += nStep;
+  }
+  BenchEnd("update_budget_page_redraw",m_nIter);
+
+  fprintf(stderr,"INFO: update_budget calls/frame=%.1f update_us p50=%u p99=%u frame_us p50=%u p99=%u\n",
+    (double)nCalls / m_nIter,
+    (unsigned)gslc_UpdateLatencyGet(pGui,false,50),(unsigned)gslc_UpdateLatencyGet(pGui,false,99),
+    (unsigned)gslc_UpdateLatencyGet(pGui,true,50),(unsigned)gslc_UpdateLatencyGet(pGui,true,99));
+
+  uint8_t* pSnap = (uint8_t*)malloc(nFrameLen);
+  if (!pSnap) { return; }
+  memcpy(pSnap,m_drv.pFrame,nFrameLen);
+  gslc_PageRedrawSet(pGui,true);
+  gslc_PageRedrawGo(pGui);
+  if (memcmp(pSnap,m_drv.pFrame,nFrameLen) != 0) {
+    fprintf(stderr,"ERROR: update_budget display differs from a full redraw\n");
+  }
+  free(pSnap);
+}
+
+void BenchHitTest(gslc_tsGui* pGui,int16_t nPageId,uint8_t nSlot,uint16_t nNumElem)
+{
+  gslc_tsPage*    pPage = gslc_PageFindById(pGui,nPageId);
+  gslc_tsCollect* pCollect = &pPage->sCollect;
+  int16_t         nElemInd;
+  uint32_t        nInd;
+  uint32_t        nFound = 0;
+  char            acName[32];
+
+  // Linear scan
+  m_nRandState = 1;
+  BenchStart();
+  for (nInd=0;nInd<BENCH_HIT_QUERIES;nInd++) {
+    if (gslc_CollectFindElemFromCoord(pGui,pCollect,BenchRand(480),BenchRand(320),&nElemInd)) {
+      nFound++;
+    }
+  }
+  snprintf(acName,sizeof(acName),"hit_linear_%u",nNumElem);
+  BenchEnd(acName,BENCH_HIT_QUERIES);
+
+  // Hit-test grid with the same coordinates
+  gslc_PageSetHitGrid(pGui,nPageId,&m_asHitGrid[nSlot],m_anHitGridBuf[nSlot],
+    sizeof(m_anHitGridBuf[nSlot]),BENCH_HIT_GRID_COLS,BENCH_HIT_GRID_ROWS);
+  m_nRandState = 1;
+  BenchStart();
+  for (nInd=0;nInd<BENCH_HIT_QUERIES;nInd++) {
+    if (gslc_CollectFindElemFromCoord(pGui,pCollect,BenchRand(480),BenchRand(320),&nElemInd)) {
+      nFound--;
+    }
+  }
+  snprintf(acName,sizeof(acName),"hit_grid_%u",nNumElem);
+  BenchEnd(acName,BENCH_HIT_QUERIES);
+
+  if (nFound != 0) {
+    fprintf(stderr,"ERROR: hit-test grid results differ from linear scan (%u elements)\n",nNumElem);
+  }
+}
+
+// ------------------------------------------------
+// Create page elements
+// ------------------------------------------------
+
+void CreateHitPage(gslc_tsGui* pGui,int16_t nPageId,uint8_t nSlot,uint16_t nNumElem)
+{
+  gslc_tsElemRef* pElemRef;
+  uint16_t        nInd;
+  // Lay out the elements in a uniform grid, with overlap between
+  // neighbours so that some coordinates match more than one element
+  uint16_t        nCols = 1;
+  while ((uint32_t)nCols * nCols * 3 < (uint32_t)nNumElem * 2) { nCols++; }
+  uint16_t        nRows = (nNumElem + nCols - 1) / nCols;
+  uint16_t        nCellW = 480 / nCols;
+  uint16_t        nCellH = 320 / nRows;
+
+  gslc_PageAdd(pGui,nPageId,m_asPgHitElem[nSlot],MAX_ELEM_PG_HIT,m_asPgHitElemRef[nSlot],MAX_ELEM_PG_HIT);
+  for (nInd=0;nInd<nNumElem;nInd++) {
+    gslc_tsRect rElem = (gslc_tsRect){ (int16_t)((nInd % nCols) * nCellW), (int16_t)((nInd / nCols) * nCellH),
+      (uint16_t)(nCellW + nCellW/2), (uint16_t)(nCellH + nCellH/2) };
+    pElemRef = gslc_ElemCreateBox(pGui,GSLC_ID_AUTO,nPageId,rElem);
+    gslc_ElemSetClickEn(pGui,pElemRef,(nInd % 4) != 3);
+  }
+}
+
+bool InitGUI(gslc_tsGui* pGui)
+{
+  gslc_tsElemRef* pElemRef;
+  uint8_t         nInd;
+
+  gslc_PageAdd(pGui,E_PG_PRIM,m_asPgPrimElem,MAX_ELEM_PG_PRIM,m_asPgPrimElemRef,MAX_ELEM_PG_PRIM);
+
+  // Main page with a mix of basic elements
+  gslc_PageAdd(pGui,E_PG_MAIN,m_asPgMainElem,MAX_ELEM_PG_MAIN,m_asPgMainElemRef,MAX_ELEM_PG_MAIN);
+  gslc_ElemCreateBox(pGui,GSLC_ID_AUTO,E_PG_MAIN,(gslc_tsRect){10,10,460,300});
+  for (nInd=0;nInd<6;nInd++) {
+    pElemRef = gslc_ElemCreateBtnTxt(pGui,GSLC_ID_AUTO,E_PG_MAIN,
+      (gslc_tsRect){(int16_t)(20+(nInd%3)*150),(int16_t)(30+(nInd/3)*60),130,40},"Button",0,E_FONT_TXT2,NULL);
+    gslc_ElemSetRoundEn(pGui,pElemRef,(nInd % 2) == 0);
+    if (nInd == 0) { m_pElemMainBtn = pElemRef; }
+  }
+  for (nInd=0;nInd<6;nInd++) {
+    gslc_ElemCreateTxt(pGui,GSLC_ID_AUTO,E_PG_MAIN,
+      (gslc_tsRect){(int16_t)(20+(nInd%3)*150),(int16_t)(170+(nInd/3)*40),130,30},"Label",0,E_FONT_TXT);
+  }
+  gslc_ElemCreateLine(pGui,GSLC_ID_AUTO,E_PG_MAIN,20,290,460,290);
+
+  // Extended elements, each on its own page
+  gslc_PageAdd(pGui,E_PG_RING,m_asPgWidgetElem[0],MAX_ELEM_PG_WIDGET,m_asPgWidgetElemRef[0],MAX_ELEM_PG_WIDGET);
+  m_pElemRing = gslc_ElemXRingGaugeCreate(pGui,GSLC_ID_AUTO,E_PG_RING,&m_sXRingGauge,
+    (gslc_tsRect){140,60,200,200},m_acRingStr,RING_STR_LEN,E_FONT_TXT2);
+  gslc_ElemXRingGaugeSetColorActiveGradient(pGui,m_pElemRing,GSLC_COL_BLUE_LT4,GSLC_COL_RED);
+  gslc_ElemXRingGaugeSetQuality(pGui,m_pElemRing,RING_QUALITY);
+
+  gslc_PageAdd(pGui,E_PG_GRAPH,m_asPgWidgetElem[1],MAX_ELEM_PG_WIDGET,m_asPgWidgetElemRef[1],MAX_ELEM_PG_WIDGET);
+  m_pElemGraph = gslc_ElemXGraphCreate(pGui,GSLC_ID_AUTO,E_PG_GRAPH,&m_sXGraph,
+    (gslc_tsRect){40,40,400,240},E_FONT_TXT,m_anGraphBuf,GRAPH_ROWS,GSLC_COL_ORANGE);
+  gslc_ElemXGraphSetStyle(pGui,m_pElemGraph,GSLCX_GRAPH_STYLE_FILL,5);
+  gslc_ElemXGraphSetRange(pGui,m_pElemGraph,0,50);
+
+  gslc_PageAdd(pGui,E_PG_LISTBOX,m_asPgWidgetElem[2],MAX_ELEM_PG_WIDGET,m_asPgWidgetElemRef[2],MAX_ELEM_PG_WIDGET);
+  m_pElemListbox = gslc_ElemXListboxCreate(pGui,GSLC_ID_AUTO,E_PG_LISTBOX,&m_sXListbox,
+    (gslc_tsRect){40,40,400,240},E_FONT_TXT2,m_anListboxBuf,LISTBOX_BUF_LEN,0);
+  gslc_ElemXListboxSetSize(pGui,m_pElemListbox,6,1);
+  for (nInd=0;nInd<6;nInd++) {
+    gslc_ElemXListboxAddItem(pGui,m_pElemListbox,"Listbox item");
+  }
+
+  gslc_PageAdd(pGui,E_PG_KEYPAD,m_asPgWidgetElem[3],MAX_ELEM_PG_WIDGET,m_asPgWidgetElemRef[3],MAX_ELEM_PG_WIDGET);
+  static gslc_tsXKeyPadCfg_Num sCfg;
+  sCfg = gslc_ElemXKeyPadCfgInit_Num();
+  gslc_ElemXKeyPadCfgSetFloatEn_Num(&sCfg,true);
+  gslc_ElemXKeyPadCfgSetSignEn_Num(&sCfg,true);
+  m_pElemKeyPad = gslc_ElemXKeyPadCreate_Num(pGui,GSLC_ID_AUTO,E_PG_KEYPAD,&m_sXKeyPad,
+    65,80,E_FONT_TXT2,&sCfg);
+
+  gslc_PageAdd(pGui,E_PG_GLOW,m_asPgWidgetElem[4],MAX_ELEM_PG_WIDGET,m_asPgWidgetElemRef[4],MAX_ELEM_PG_WIDGET);
+  m_pElemGlow = gslc_ElemXGlowballCreate(pGui,GSLC_ID_AUTO,E_PG_GLOW,&m_sXGlowball,
+    240,160,m_asRings,NUM_RINGS);
+  gslc_ElemXGlowballSetColorBack(pGui,m_pElemGlow,GSLC_COL_BLACK);
+  gslc_ElemXGlowballSetQuality(pGui,m_pElemGlow,GLOW_QUALITY);
+
+  // Left-aligned numeric readout
+  gslc_PageAdd(pGui,E_PG_READOUT,m_asPgWidgetElem[5],MAX_ELEM_PG_WIDGET,m_asPgWidgetElemRef[5],MAX_ELEM_PG_WIDGET);
+  m_pElemReadout = gslc_ElemCreateTxt(pGui,GSLC_ID_AUTO,E_PG_READOUT,(gslc_tsRect){40,140,400,40},
+    m_acReadoutStr,READOUT_STR_LEN,E_FONT_TXT2);
+  gslc_ElemSetFillEn(pGui,m_pElemReadout,true);
+  gslc_ElemSetFrameEn(pGui,m_pElemReadout,true);
+  gslc_ElemSetTxtAlign(pGui,m_pElemReadout,GSLC_ALIGN_MID_LEFT);
+  gslc_ElemSetTxtMargin(pGui,m_pElemReadout,8);
+
+  // Hit-testing pages
+  CreateHitPage(pGui,E_PG_HIT10,0,10);
+  CreateHitPage(pGui,E_PG_HIT100,1,100);
+  CreateHitPage(pGui,E_PG_HIT500,2,500);
+
+  return true;
+}
+
+int main(int argc, char* argv[])
+{
+  if (argc > 1) {
+    m_nIter = (uint32_t)strtoul(argv[1],NULL,10);
+    if (m_nIter == 0) { m_nIter = BENCH_ITER_DEF; }
+  }
+
+  // Initialize debug output
+  gslc_InitDebug(&DebugOut);
+
+  if (!gslc_Init(&m_gui,&m_drv,m_asPage,MAX_PAGE,m_asFont,MAX_FONT)) { return 1; }
+
+  // The framebuffer driver renders a built-in font scaled by size
+  if (!gslc_FontSet(&m_gui,E_FONT_TXT,GSLC_FONTREF_PTR,NULL,1)) { return 1; }
+  if (!gslc_FontSet(&m_gui,E_FONT_TXT2,GSLC_FONTREF_PTR,NULL,2)) { return 1; }
+
+  InitGUI(&m_gui);
+
+  printf("bench,ops,ns_per_op,pix_per_op,calls_per_op\n");
+
+  BenchPrimitives(&m_gui);
+  BenchPageRedraw(&m_gui);
+  BenchElem(&m_gui,E_PG_RING,m_pElemRing,"xringgauge_full","xringgauge_inc",&BenchSetRing);
+  BenchElem(&m_gui,E_PG_GRAPH,m_pElemGraph,"xgraph_full","xgraph_inc",&BenchSetGraph);
+  BenchElem(&m_gui,E_PG_LISTBOX,m_pElemListbox,"xlistbox_full","xlistbox_inc",&BenchSetListbox);
+  BenchElem(&m_gui,E_PG_KEYPAD,m_pElemKeyPad,"xkeypad_full","xkeypad_inc",&BenchSetKeyPad);
+  BenchElem(&m_gui,E_PG_GLOW,m_pElemGlow,"xglowball_full","xglowball_inc",&BenchSetGlow);
+  BenchElem(&m_gui,E_PG_READOUT,m_pElemReadout,"txt_readout_full","txt_readout_inc",&BenchSetReadout);
+
+  // Repeat the sector-based elements with their polar vertex caches enabled
+  gslc_ElemXRingGaugeSetPolarCache(&m_gui,m_pElemRing,m_asRingCache,XRING_POLAR_CACHE_PTS(RING_QUALITY));
+  gslc_ElemXGlowballSetPolarCache(&m_gui,m_pElemGlow,m_asGlowCache,XGLOWBALL_POLAR_CACHE_PTS(GLOW_QUALITY,NUM_RINGS));
+  BenchElem(&m_gui,E_PG_RING,m_pElemRing,"xringgauge_cache_full","xringgauge_cache_inc",&BenchSetRing);
+  BenchElem(&m_gui,E_PG_GLOW,m_pElemGlow,"xglowball_cache_full","xglowball_cache_inc",&BenchSetGlow);
+
+  // Repeat the readout with incremental text redraw enabled
+  gslc_ElemSetTxtIncr(&m_gui,m_pElemReadout,&m_sReadoutIncr);
+  BenchElem(&m_gui,E_PG_READOUT,m_pElemReadout,"txt_incr_full","txt_incr_inc",&BenchSetReadout);
+  BenchCheckElem(&m_gui,m_pElemReadout,"txt_incr");
+  BenchCheckTxtIncrGlow(&m_gui,m_pElemReadout);
+
+  BenchTick(&m_gui);
+  BenchUpdateBudget(&m_gui);
+
+  BenchHitTest(&m_gui,E_PG_HIT10,0,10);
+  BenchHitTest(&m_gui,E_PG_HIT100,1,100);
+  BenchHitTest(&m_gui,E_PG_HIT500,2,500);
+
+  gslc_Quit(&m_gui);
+  return 0;
+}
@@ -47,8 +47,10 @@
   #include <Arduino.h> // For delay()
 #endif // DBG_REDRAW
 
-#ifdef DBG_FRAME_RATE
-  #include <time.h> // for FrameRate reporting
+#if defined(GSLC_CFG_LINUX)
+  #include <time.h> // For clock_gettime()
+#else
+  #include <Arduino.h> // For millis(), micros()
 #endif
 
 #if (GSLC_USE_FLOAT)
@@ -65,6 +67,10 @@
 
 #include <stdarg.h>         // For va_*
 
+#if (GSLC_FEATURE_IMG_CACHE) && defined(ESP32) && defined(BOARD_HAS_PSRAM)
+  #include <esp_heap_caps.h> // For heap_caps_malloc()
+#endif
+
 // Version tracking
 #include "GUIslice_version.h"
 
@@ -169,6 +175,17 @@ bool gslc_Init(gslc_tsGui* pGui,void* pvDriver,gslc_tsPage* asPage,uint8_t nMaxP
   // Default to remapping enabled
   pGui->bTouchRemapEn = true;
 
+  #if defined(GSLC_TOUCH_IRQ_PIN) && !defined(GSLC_CFG_LINUX) && !defined(DRV_TOUCH_NONE)
+  // Touch controller interrupt pin monitored by gslc_WaitEvent()
+  pinMode(GSLC_TOUCH_IRQ_PIN,INPUT_PULLUP);
+  #endif
+
+  #if (GSLC_FEATURE_TOUCH_FILTER) && !defined(DRV_TOUCH_NONE)
+  // Default touch filter configuration
+  gslc_SetTouchFilterPos(pGui,GSLC_TOUCH_FILTER_MEDIAN,GSLC_TOUCH_FILTER_SMOOTH,GSLC_TOUCH_FILTER_MOVE_MIN);
+  gslc_SetTouchFilterPress(pGui,GSLC_TOUCH_FILTER_PRESS_ON,GSLC_TOUCH_FILTER_PRESS_OFF,GSLC_TOUCH_FILTER_DEBOUNCE_MS);
+  #endif
+
 
   pGui->nPageMax        = nMaxPage;
   pGui->nPageCnt        = 0;
@@ -184,10 +201,36 @@ bool gslc_Init(gslc_tsGui* pGui,void* pvDriver,gslc_tsPage* asPage,uint8_t nMaxP
   pGui->bScreenNeedFlip    = false;
 
   gslc_InvalidateRgnReset(pGui);
+  pGui->bRedrawPassEn      = false;
+  pGui->nRedrawPixCnt      = 0;
+  pGui->nExposeRectCnt     = 0;
+  #if (GSLC_FEATURE_PT_BATCH)
+  pGui->sPtBatch.nPtCnt    = 0;
+  #endif
+  #if (GSLC_FEATURE_UPDATE_BUDGET)
+  pGui->bRedrawStepActive  = false;
+  pGui->bRedrawStepScan    = false;
+  gslc_UpdateLatencyReset(pGui);
+  #endif
+
+  gslc_ElemProgCacheReset(pGui);
+
+  #if (GSLC_FEATURE_IMG_CACHE)
+  for (nInd=0;nInd<GSLC_IMG_CACHE_MAX;nInd++) {
+    pGui->asImgCache[nInd].pPix = NULL;
+  }
+  pGui->nImgCacheUse    = 0;
+  pGui->nImgCacheBudget = GSLC_IMG_CACHE_BYTES;
+  pGui->sImgCacheStats.nCnt       = 0;
+  pGui->sImgCacheStats.nBytesUsed = 0;
+  gslc_ImgCacheResetStats(pGui);
+  #endif
 
-   // Clear the event-pending struct
-  pGui->bEventPending = false;
-  pGui->sEventPend.eType = GSLC_EVT_NONE; 
+  // Clear the deferred event queue
+  pGui->nEvtQueueHead    = 0;
+  pGui->nEvtQueueCnt     = 0;
+  pGui->nEvtQueueHighCnt = 0;
+  gslc_EventQueueResetStats(pGui);
 
   // Default global element characteristics
   pGui->nRoundRadius = 4;
@@ -226,6 +269,10 @@ bool gslc_Init(gslc_tsGui* pGui,void* pvDriver,gslc_tsPage* asPage,uint8_t nMaxP
   //pGui->pfuncXEvent           = NULL; // UNUSED
   pGui->pfuncPinPoll          = NULL;
 
+  pGui->asTick                = NULL;
+  pGui->nTickMax              = 0;
+  pGui->nTickCnt              = 0;
+
   pGui->asInputMap            = NULL;
   pGui->nInputMapMax          = 0;
   pGui->nInputMapCnt          = 0;
@@ -255,9 +302,9 @@ bool gslc_Init(gslc_tsGui* pGui,void* pvDriver,gslc_tsPage* asPage,uint8_t nMaxP
   pGui->bRedrawPartialEn = false;
 
 
-  #ifdef DBG_FRAME_RATE
-  pGui->nFrameRateCnt = 0;
-  pGui->nFrameRateStart = time(NULL);
+  #if (GSLC_FEATURE_DRV_STATS)
+  gslc_DrvStatsReset(pGui);
+  gslc_DrvStatsSetScope(pGui,GSLC_ID_NONE,GSLC_REDRAW_NONE);
   #endif
 
   // Initialize the display and touch drivers
@@ -601,7 +648,7 @@ void gslc_Quit(gslc_tsGui* pGui)
 
 
 // Main polling loop for GUIslice
-void gslc_Update(gslc_tsGui* pGui)
+void gslc_UpdateInput(gslc_tsGui* pGui)
 {
   // The touch handling logic is used by both the touchscreen
   // handler as well as the GPIO/pin/keyboard input controller
@@ -617,10 +664,11 @@ void gslc_Update(gslc_tsGui* pGui)
   // --------------------------------------------------------------
   // Handle any pending events
   // --------------------------------------------------------------
-  if (pGui->bEventPending) {
-    gslc_ElemEvent((void*)pGui,pGui->sEventPend);
-    pGui->bEventPending = false;
-  }
+  gslc_EventQueueDrain(pGui);
+
+  #if (GSLC_TOUCH_BUDGET_MS > 0)
+  uint32_t nStartMs = gslc_GetTimeMs();
+  #endif
 
   // ---------------------------------------------
   // Touch handling
@@ -640,6 +688,7 @@ void gslc_Update(gslc_tsGui* pGui)
   bool                  bEvent = false;
   gslc_teInputRawEvent  eInputEvent = GSLC_INPUT_NONE;
   int16_t               nInputVal = 0;
+  bool                  bTouchOut = true;
 
   // Handle touchscreen presses
   // - We clear the event queue here so that we don't fall behind
@@ -662,6 +711,7 @@ void gslc_Update(gslc_tsGui* pGui)
   uint16_t  nNumEvts  = 0;
   do {
     bEvent = false;
+    bTouchOut = true;
 
     // --------------------------------------------------------------
     // First check physical pin inputs
@@ -690,6 +740,19 @@ void gslc_Update(gslc_tsGui* pGui)
     if (!bEvent) {
       // Fetch input event, which could include touch / mouse / keyboard / pin
       bEvent = gslc_GetTouch(pGui, &nTouchX, &nTouchY, &nTouchPress, &eInputEvent, &nInputVal);
+
+      #if (GSLC_FEATURE_TOUCH_FILTER)
+      // Filter the touch samples before they are tracked
+      if ((bEvent) && (eInputEvent == GSLC_INPUT_TOUCH)) {
+        bTouchOut = gslc_TouchFilter(pGui, true, &nTouchX, &nTouchY, &nTouchPress);
+      } else if (!bEvent) {
+        // Report any press / release that has completed its debounce
+        bEvent = gslc_TouchFilter(pGui, false, &nTouchX, &nTouchY, &nTouchPress);
+        if (bEvent) {
+          eInputEvent = GSLC_INPUT_TOUCH;
+        }
+      }
+      #endif
     }
 
     // --------------------------------------------------------------
@@ -718,7 +781,10 @@ void gslc_Update(gslc_tsGui* pGui)
         case GSLC_INPUT_TOUCH:
           // Track and handle the touch events
           // - Handle the events on the current page
-          gslc_TrackTouch(pGui,NULL,nTouchX,nTouchY,nTouchPress);
+          // - Skip any samples suppressed by the touch filter
+          if (bTouchOut) {
+            gslc_TrackTouch(pGui,NULL,nTouchX,nTouchY,nTouchPress);
+          }
 
           #ifdef DBG_TOUCH
           // Highlight current touch for coordinate debug
@@ -734,27 +800,61 @@ void gslc_Update(gslc_tsGui* pGui)
       }
 
       nNumEvts++;
+
+      // Issue any press / release events before reading further input
+      // so that they act upon the current page state. Move events
+      // remain queued so that subsequent moves can be coalesced.
+      if (pGui->nEvtQueueHighCnt > 0) {
+        gslc_EventQueueDrain(pGui);
+      }
     }
 
     // Should we stop handling events?
-    if ((!bEvent) || (nNumEvts >= GSLC_TOUCH_MAX_EVT)) {
+    if (!bEvent) {
+      bDoneEvts = true;
+    }
+    #if (GSLC_TOUCH_BUDGET_MS > 0)
+    if ((gslc_GetTimeMs() - nStartMs) >= (uint32_t)GSLC_TOUCH_BUDGET_MS) {
       bDoneEvts = true;
     }
+    #else
+    if (nNumEvts >= GSLC_TOUCH_MAX_EVT) {
+      bDoneEvts = true;
+    }
+    #endif
   } while (!bDoneEvts);
 
-  #endif // !DRV_TOUCH_NONE
+  // Issue the events generated by the input before the redraw
+  gslc_EventQueueDrain(pGui);
 
-  // ---------------------------------------------
+  #else
+  (void)pGui; // Unused
+  #endif // !DRV_TOUCH_NONE
+}
 
-  // Issue a timer tick to all pages
-  // - This is independent of the pages in the stack
-  uint8_t nPageInd;
-  gslc_tsPage* pPage = NULL;
-  for (nPageInd=0;nPageInd<pGui->nPageCnt;nPageInd++) {
-    pPage = &pGui->asPage[nPageInd];
-    gslc_tsEvent sEvent = gslc_EventCreate(pGui,GSLC_EVT_TICK,0,(void*)pPage,NULL);
-    gslc_PageEvent(pGui,sEvent);
+void gslc_UpdateTick(gslc_tsGui* pGui)
+{
+  if (pGui->asTick != NULL) {
+    // Issue timer ticks to the registered elements that are due
+    gslc_TickDispatch(pGui);
+  } else {
+    // Issue a timer tick to all pages
+    // - This is independent of the pages in the stack
+    uint8_t nPageInd;
+    gslc_tsPage* pPage = NULL;
+    for (nPageInd=0;nPageInd<pGui->nPageCnt;nPageInd++) {
+      pPage = &pGui->asPage[nPageInd];
+      gslc_tsEvent sEvent = gslc_EventCreate(pGui,GSLC_EVT_TICK,0,(void*)pPage,NULL);
+      gslc_PageEvent(pGui,sEvent);
+    }
   }
+}
+
+void gslc_Update(gslc_tsGui* pGui)
+{
+  gslc_UpdateInput(pGui);
+
+  gslc_UpdateTick(pGui);
 
   // Perform any redraw required for current page
   // - Only perform the redraw if at least one element
@@ -763,18 +863,18 @@ void gslc_Update(gslc_tsGui* pGui)
     gslc_PageRedrawGo(pGui);
   }
 
-  // Simple "frame" rate reporting
-  // - Note that the rate is based on the number of calls to gslc_Update()
-  //   per second, which may or may not redraw the frame
-  #ifdef DBG_FRAME_RATE
-  pGui->nFrameRateCnt++;
-  uint32_t  nElapsed = (time(NULL) - pGui->nFrameRateStart);
-  if (nElapsed > 0) {
-    GSLC_DEBUG_PRINT("Update rate: %6u / sec\n",pGui->nFrameRateCnt);
-    pGui->nFrameRateStart = time(NULL);
-    pGui->nFrameRateCnt = 0;
+  // Periodic report of the driver instrumentation
+  // - The number of updates and page flips within the interval
+  //   provides the update and frame rates
+  #if (GSLC_FEATURE_DRV_STATS)
+  pGui->sDrvStats.nUpdateCnt++;
+  #if (GSLC_DRV_STATS_DUMP_MS > 0)
+  if ((gslc_DrvStatsGetTimeUs() - pGui->sDrvStats.nStartUs) >= (uint32_t)GSLC_DRV_STATS_DUMP_MS * 1000) {
+    gslc_DrvStatsDump(pGui);
+    gslc_DrvStatsReset(pGui);
   }
   #endif
+  #endif
 
   // Provide periodic yield
   // - This instruction is important for some devices such as ESP8266
@@ -784,6 +884,203 @@ void gslc_Update(gslc_tsGui* pGui)
 
 }
 
+bool gslc_WaitEvent(gslc_tsGui* pGui,uint32_t nTimeoutMs)
+{
+  if (pGui == NULL) {
+    static const char GSLC_PMEM FUNCSTR[] = "WaitEvent";
+    GSLC_DEBUG2_PRINT_CONST(ERRSTR_NULL,FUNCSTR);
+    return false;
+  }
+
+  // Return immediately if gslc_Update() has work to do
+  if ((pGui->bRedrawNeeded) || (pGui->nEvtQueueCnt > 0)) {
+    return true;
+  }
+  #if (GSLC_FEATURE_UPDATE_BUDGET)
+  if (pGui->bRedrawStepActive) {
+    return true;
+  }
+  #endif
+
+  // Wake in time for the next scheduled tick
+  uint32_t nNowMs = gslc_GetTimeMs();
+  if ((pGui->asTick != NULL) && (pGui->nTickCnt > 0)) {
+    int32_t nDueMs = (int32_t)(pGui->asTick[0].nDueMs - nNowMs);
+    if (nDueMs <= 0) {
+      return true;
+    }
+    if ((uint32_t)nDueMs < nTimeoutMs) {
+      nTimeoutMs = (uint32_t)nDueMs;
+    }
+  }
+
+  #if defined(DRV_TOUCH_NONE)
+  // No input can arrive, so sleep until the timeout
+  #if defined(GSLC_CFG_LINUX)
+  struct timespec sDelay;
+  sDelay.tv_sec  = nTimeoutMs / 1000;
+  sDelay.tv_nsec = (long)(nTimeoutMs % 1000) * 1000000L;
+  nanosleep(&sDelay,NULL);
+  #else
+  delay(nTimeoutMs);
+  #endif
+  return false;
+
+  #else
+  #if (GSLC_FEATURE_TOUCH_FILTER)
+  // Wake in time to complete a debounced touch transition
+  if (pGui->sTouchFilter.bPend) {
+    uint32_t nPendMs = nNowMs - pGui->sTouchFilter.nPendMs;
+    if (nPendMs >= pGui->sTouchFilter.nDebounceMs) {
+      return true;
+    }
+    if (pGui->sTouchFilter.nDebounceMs - nPendMs < nTimeoutMs) {
+      nTimeoutMs = pGui->sTouchFilter.nDebounceMs - nPendMs;
+    }
+  }
+  #endif
+
+  #if (GSLC_FEATURE_INPUT)
+  // Pin inputs can only be polled
+  if (pGui->pfuncPinPoll != NULL) {
+    return true;
+  }
+  #endif
+
+  #if defined(DRV_HAS_WAIT_INPUT) && (DRV_HAS_WAIT_INPUT)
+  return gslc_DrvWaitInput(pGui,nTimeoutMs);
+  #elif defined(GSLC_TOUCH_IRQ_PIN) && !defined(GSLC_CFG_LINUX)
+  // While touched, the release is detected by polling the driver
+  if (pGui->nTouchLastPress > 0) {
+    return true;
+  }
+  // Wait for the touch controller to assert its interrupt pin
+  // - The delay yields to the scheduler on RTOS-based targets,
+  //   which allows the idle task to enter a low power state
+  while (digitalRead(GSLC_TOUCH_IRQ_PIN) != LOW) {
+    if ((gslc_GetTimeMs() - nNowMs) >= nTimeoutMs) {
+      return false;
+    }
+    delay(1);
+  }
+  return true;
+  #else
+  // The driver can only be polled
+  return true;
+  #endif
+  #endif // DRV_TOUCH_NONE
+}
+
+#if (GSLC_FEATURE_UPDATE_BUDGET)
+bool gslc_UpdateBudget(gslc_tsGui* pGui,uint32_t nBudgetUs)
+{
+  if (pGui == NULL) {
+    static const char GSLC_PMEM FUNCSTR[] = "UpdateBudget";
+    GSLC_DEBUG2_PRINT_CONST(ERRSTR_NULL,FUNCSTR);
+    return false;
+  }
+  uint32_t nStartUs = gslc_GetTimeUs();
+
+  gslc_UpdateInput(pGui);
+
+  gslc_UpdateTick(pGui);
+
+  // Start a redraw if none is in progress
+  if ((!pGui->bRedrawStepActive) && (pGui->bRedrawNeeded)) {
+    gslc_PageRedrawBegin(pGui);
+  }
+
+  // Continue the redraw until the budget has elapsed
+  // - At least one step is performed so that the redraw
+  //   always makes progress
+  while (gslc_PageRedrawStep(pGui)) {
+    if ((gslc_GetTimeUs() - nStartUs) >= nBudgetUs) {
+      break;
+    }
+  }
+
+  if (pGui->bRedrawStepActive) {
+    // Release the pass state until the next call so that any
+    // drawing performed by the input handlers is unaffected
+    pGui->bRedrawPassEn = false;
+    gslc_SetClipRect(pGui, NULL);
+  }
+
+  gslc_LatencyAdd(pGui->sLatencyStats.anUpdate,&(pGui->sLatencyStats.nUpdateMaxUs),gslc_GetTimeUs()-nStartUs);
+
+  #if (GSLC_FEATURE_DRV_STATS)
+  pGui->sDrvStats.nUpdateCnt++;
+  #if (GSLC_DRV_STATS_DUMP_MS > 0)
+  if ((gslc_DrvStatsGetTimeUs() - pGui->sDrvStats.nStartUs) >= (uint32_t)GSLC_DRV_STATS_DUMP_MS * 1000) {
+    gslc_DrvStatsDump(pGui);
+    gslc_DrvStatsReset(pGui);
+  }
+  #endif
+  #endif
+
+  #if defined(ESP8266)
+    yield();
+  #endif
+
+  return (!pGui->bRedrawStepActive) && (!pGui->bRedrawNeeded);
+}
+
+void gslc_LatencyAdd(uint32_t* anHist,uint32_t* pnMaxUs,uint32_t nTimeUs)
+{
+  uint8_t nBin = 0;
+  while ((nBin < GSLC_LATENCY_BIN_CNT-1) && ((nTimeUs >> (nBin+1)) != 0)) {
+    nBin++;
+  }
+  anHist[nBin]++;
+  if (nTimeUs > *pnMaxUs) {
+    *pnMaxUs = nTimeUs;
+  }
+}
+
+uint32_t gslc_UpdateLatencyGet(gslc_tsGui* pGui,bool bFrame,uint8_t nPercent)
+{
+  if (pGui == NULL) {
+    static const char GSLC_PMEM FUNCSTR[] = "UpdateLatencyGet";
+    GSLC_DEBUG2_PRINT_CONST(ERRSTR_NULL,FUNCSTR);
+    return 0;
+  }
+  uint32_t* anHist = (bFrame)? pGui->sLatencyStats.anFrame : pGui->sLatencyStats.anUpdate;
+  uint32_t  nMaxUs = (bFrame)? pGui->sLatencyStats.nFrameMaxUs : pGui->sLatencyStats.nUpdateMaxUs;
+  uint32_t  nTotal = 0;
+  uint32_t  nSum = 0;
+  uint8_t   nBin;
+
+  for (nBin=0;nBin<GSLC_LATENCY_BIN_CNT;nBin++) {
+    nTotal += anHist[nBin];
+  }
+  if (nTotal == 0) {
+    return 0;
+  }
+  if (nPercent > 100) {
+    nPercent = 100;
+  }
+  // Locate the bin containing the percentile and report its upper bound
+  for (nBin=0;nBin<GSLC_LATENCY_BIN_CNT-1;nBin++) {
+    nSum += anHist[nBin];
+    if ((nSum > 0) && ((uint64_t)nSum * 100 >= (uint64_t)nTotal * nPercent)) {
+      break;
+    }
+  }
+  uint32_t nBoundUs = ((uint32_t)2 << nBin) - 1;
+  return (nBin < GSLC_LATENCY_BIN_CNT-1)? GSLC_MIN(nBoundUs,nMaxUs) : nMaxUs;
+}
+
+void gslc_UpdateLatencyReset(gslc_tsGui* pGui)
+{
+  if (pGui == NULL) {
+    static const char GSLC_PMEM FUNCSTR[] = "UpdateLatencyReset";
+    GSLC_DEBUG2_PRINT_CONST(ERRSTR_NULL,FUNCSTR);
+    return;
+  }
+  memset(&(pGui->sLatencyStats),0,sizeof(gslc_tsLatencyStats));
+}
+#endif // GSLC_FEATURE_UPDATE_BUDGET
+
 gslc_tsEvent  gslc_EventCreate(gslc_tsGui* pGui,gslc_teEventType eType,uint8_t nSubType,void* pvScope,void* pvData)
 {
   (void)pGui; // Unused
@@ -796,6 +1093,201 @@ gslc_tsEvent  gslc_EventCreate(gslc_tsGui* pGui,gslc_teEventType eType,uint8_t n
 }
 
 
+// ------------------------------------------------------------------------
+// Tick Scheduling Functions
+// ------------------------------------------------------------------------
+
+void gslc_InitTick(gslc_tsGui* pGui,gslc_tsTick* asTick,uint16_t nTickMax)
+{
+  if (pGui == NULL) {
+    static const char GSLC_PMEM FUNCSTR[] = "InitTick";
+    GSLC_DEBUG2_PRINT_CONST(ERRSTR_NULL,FUNCSTR);
+    return;
+  }
+  pGui->asTick    = asTick;
+  pGui->nTickMax  = nTickMax;
+  pGui->nTickCnt  = 0;
+}
+
+bool gslc_TickAdd(gslc_tsGui* pGui,int16_t nPageId,gslc_tsElemRef* pElemRef,uint16_t nPeriodMs,bool bVisibleOnly)
+{
+  if ((pGui == NULL) || (pElemRef == NULL)) {
+    static const char GSLC_PMEM FUNCSTR[] = "TickAdd";
+    GSLC_DEBUG2_PRINT_CONST(ERRSTR_NULL,FUNCSTR);
+    return false;
+  }
+  if (pGui->asTick == NULL) {
+    GSLC_DEBUG2_PRINT("ERROR: TickAdd() requires gslc_InitTick()\n","");
+    return false;
+  }
+  gslc_tsPage* pPage = gslc_PageFindById(pGui,nPageId);
+  if (pPage == NULL) {
+    GSLC_DEBUG2_PRINT("ERROR: TickAdd() page (%d) was not found\n",nPageId);
+    return false;
+  }
+
+  // Replace any existing registration for the element
+  gslc_TickRemove(pGui,pElemRef);
+  if (pGui->nTickCnt >= pGui->nTickMax) {
+    GSLC_DEBUG2_PRINT("ERROR: TickAdd() too many ticks. Max=%u\n",pGui->nTickMax);
+    return false;
+  }
+
+  // The first tick is issued by the next gslc_Update()
+  uint16_t     nInd  = pGui->nTickCnt++;
+  gslc_tsTick* pTick = &pGui->asTick[nInd];
+  pTick->pElemRef     = pElemRef;
+  pTick->pPage        = pPage;
+  pTick->nDueMs       = gslc_GetTimeMs();
+  pTick->nPeriodMs    = nPeriodMs;
+  pTick->bVisibleOnly = bVisibleOnly;
+  gslc_TickSiftUp(pGui,nInd);
+  return true;
+}
+
+bool gslc_TickRemove(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef)
+{
+  uint16_t nInd;
+  if ((pGui == NULL) || (pGui->asTick == NULL)) {
+    return false;
+  }
+  for (nInd=0;nInd<pGui->nTickCnt;nInd++) {
+    if (pGui->asTick[nInd].pElemRef == pElemRef) {
+      // Move the last entry into the vacated slot and restore
+      // the heap ordering from there
+      pGui->nTickCnt--;
+      if (nInd < pGui->nTickCnt) {
+        pGui->asTick[nInd] = pGui->asTick[pGui->nTickCnt];
+        gslc_TickSiftUp(pGui,nInd);
+        gslc_TickSiftDown(pGui,nInd);
+      }
+      return true;
+    }
+  }
+  return false;
+}
+
+uint32_t gslc_GetTimeMs()
+{
+  #if defined(GSLC_CFG_LINUX)
+  struct timespec sTime;
+  clock_gettime(CLOCK_MONOTONIC,&sTime);
+  return (uint32_t)((uint64_t)sTime.tv_sec * 1000 + sTime.tv_nsec / 1000000);
+  #else
+  return (uint32_t)millis();
+  #endif
+}
+
+uint32_t gslc_GetTimeUs()
+{
+  #if defined(GSLC_CFG_LINUX)
+  struct timespec sTime;
+  clock_gettime(CLOCK_MONOTONIC,&sTime);
+  return (uint32_t)((uint64_t)sTime.tv_sec * 1000000 + sTime.tv_nsec / 1000);
+  #else
+  return (uint32_t)micros();
+  #endif
+}
+
+void gslc_TickSiftUp(gslc_tsGui* pGui,uint16_t nInd)
+{
+  gslc_tsTick* asTick = pGui->asTick;
+  gslc_tsTick  sTick  = asTick[nInd];
+  while (nInd > 0) {
+    uint16_t nParent = (nInd - 1) / 2;
+    // Compare the due times with wraparound
+    if ((int32_t)(sTick.nDueMs - asTick[nParent].nDueMs) >= 0) {
+      break;
+    }
+    asTick[nInd] = asTick[nParent];
+    nInd = nParent;
+  }
+  asTick[nInd] = sTick;
+}
+
+void gslc_TickSiftDown(gslc_tsGui* pGui,uint16_t nInd)
+{
+  gslc_tsTick* asTick = pGui->asTick;
+  uint16_t     nCnt   = pGui->nTickCnt;
+  gslc_tsTick  sTick  = asTick[nInd];
+  while (true) {
+    uint16_t nChild = 2*nInd + 1;
+    if (nChild >= nCnt) {
+      break;
+    }
+    // Select the earlier of the two children
+    if ((nChild+1 < nCnt) && ((int32_t)(asTick[nChild+1].nDueMs - asTick[nChild].nDueMs) < 0)) {
+      nChild++;
+    }
+    if ((int32_t)(asTick[nChild].nDueMs - sTick.nDueMs) >= 0) {
+      break;
+    }
+    asTick[nInd] = asTick[nChild];
+    nInd = nChild;
+  }
+  asTick[nInd] = sTick;
+}
+
+void gslc_TickDispatch(gslc_tsGui* pGui)
+{
+  uint32_t nNowMs = gslc_GetTimeMs();
+  uint8_t  nStackPage;
+  uint16_t nInd;
+  bool     bPeriodZero = false;
+
+  // Issue ticks until the earliest registration is no longer due
+  // - Each registration is rescheduled into the future before its
+  //   callback is invoked, so every entry ticks at most once here
+  while (pGui->nTickCnt > 0) {
+    gslc_tsTick* pTick = &pGui->asTick[0];
+    if ((int32_t)(nNowMs - pTick->nDueMs) < 0) {
+      break;
+    }
+    gslc_tsElemRef* pElemRef     = pTick->pElemRef;
+    gslc_tsPage*    pPage        = pTick->pPage;
+    bool            bVisibleOnly = pTick->bVisibleOnly;
+
+    // Advance by the period to avoid drift, but skip any ticks
+    // that were missed rather than issuing them in a burst
+    pTick->nDueMs += pTick->nPeriodMs;
+    if ((int32_t)(nNowMs - pTick->nDueMs) >= 0) {
+      pTick->nDueMs = nNowMs + 1;
+    }
+    if (pTick->nPeriodMs == 0) {
+      bPeriodZero = true;
+    }
+    gslc_TickSiftDown(pGui,0);
+
+    if (bVisibleOnly) {
+      bool bVisible = false;
+      for (nStackPage = 0; nStackPage < GSLC_STACK__MAX; nStackPage++) {
+        if (pGui->apPageStack[nStackPage] == pPage) {
+          bVisible = true;
+        }
+      }
+      if (!bVisible) {
+        continue;
+      }
+    }
+    gslc_tsEvent sEvent = gslc_EventCreate(pGui,GSLC_EVT_TICK,0,(void*)pElemRef,NULL);
+    gslc_ElemEvent(pGui,sEvent);
+  }
+
+  // Registrations with a period of 0 are due on every dispatch, even
+  // within the same millisecond. They were moved past the current time
+  // above so that they tick once here, so bring them back now. All
+  // other registrations are due later, so only a sift up is needed.
+  if (bPeriodZero) {
+    for (nInd=0;nInd<pGui->nTickCnt;nInd++) {
+      if (pGui->asTick[nInd].nPeriodMs == 0) {
+        pGui->asTick[nInd].nDueMs = nNowMs;
+        gslc_TickSiftUp(pGui,nInd);
+      }
+    }
+  }
+}
+
+
 // ------------------------------------------------------------------------
 // Graphics General Functions
 // ------------------------------------------------------------------------
@@ -1032,27 +1524,230 @@ gslc_tsImgRef gslc_GetImageFromProg(const unsigned char* pImgBuf,gslc_teImgRefFl
   return sImgRef;
 }
 
-
-// Sine function with optional lookup table
-// - Note that the n64Ang range is limited by 16-bit integers
-//   to an effective degree range of -511 to +511 degrees,
-//   defined by the max integer range: 32767/64.
-int16_t gslc_sinFX(int16_t n64Ang)
+bool gslc_ImagePreload(gslc_tsGui* pGui,const gslc_tsImgRef* asImgRef,uint16_t nNumImg)
 {
-  int16_t   nRetValS;
-
-#if (GSLC_USE_FLOAT)
-  // Use floating-point math library function
+  if ((pGui == NULL) || (asImgRef == NULL)) {
+    static const char GSLC_PMEM FUNCSTR[] = "ImagePreload";
+    GSLC_DEBUG2_PRINT_CONST(ERRSTR_NULL,FUNCSTR);
+    return false;
+  }
+#if defined(DRV_HAS_IMG_PRELOAD) && (DRV_HAS_IMG_PRELOAD)
+  return gslc_DrvImagePreload(pGui,asImgRef,nNumImg);
+#else
+  (void)nNumImg; // Unused
+  return true;
+#endif
+}
 
-  // Calculate angle in radians
-  float fAngRad = n64Ang*GSLC_2PI/(360.0*64.0);
-  // Perform floating point calc
-  float fSin = sin(fAngRad);
-  // Return as fixed point result
-  nRetValS = fSin * 32767.0;
-  return nRetValS;
+#if (GSLC_FEATURE_IMG_CACHE)
 
-#else
+void* gslc_ImgCacheMalloc(uint32_t nBytes)
+{
+  void* pMem = NULL;
+  #if defined(ESP32) && defined(BOARD_HAS_PSRAM)
+  // Prefer PSRAM, leaving the internal RAM for the rest of the sketch
+  pMem = heap_caps_malloc(nBytes,MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+  if (pMem != NULL) {
+    return pMem;
+  }
+  #endif
+  pMem = malloc(nBytes);
+  return pMem;
+}
+
+gslc_tsImgCacheEntry* gslc_ImgCacheFind(gslc_tsGui* pGui,gslc_tsImgRef sImgRef)
+{
+  gslc_tsImgCacheEntry* pEntry;
+  uint8_t               nInd;
+  for (nInd=0;nInd<GSLC_IMG_CACHE_MAX;nInd++) {
+    pEntry = &pGui->asImgCache[nInd];
+    if (pEntry->pPix == NULL) {
+      continue;
+    }
+    if ((pEntry->eImgFlags != sImgRef.eImgFlags) || (pEntry->pImgBuf != sImgRef.pImgBuf)) {
+      continue;
+    }
+    // Compare the pathname contents as the caller's buffer may be reused
+    if ((pEntry->pFname == NULL) || (sImgRef.pFname == NULL)) {
+      if (pEntry->pFname != sImgRef.pFname) {
+        continue;
+      }
+    } else if (strcmp(pEntry->pFname,sImgRef.pFname) != 0) {
+      continue;
+    }
+    pEntry->nLastUse = ++pGui->nImgCacheUse;
+    pGui->sImgCacheStats.nHit++;
+    pGui->sImgCacheStats.nBytesSaved += pEntry->nSrcBytes;
+    return pEntry;
+  }
+  pGui->sImgCacheStats.nMiss++;
+  return NULL;
+}
+
+gslc_tsImgCacheEntry* gslc_ImgCacheAdd(gslc_tsGui* pGui,gslc_tsImgRef sImgRef,uint16_t nW,uint16_t nH,uint32_t nSrcBytes)
+{
+  gslc_tsImgCacheStats* pStats = &pGui->sImgCacheStats;
+  gslc_tsImgCacheEntry* pEntry;
+  gslc_tsImgCacheEntry* pEntryFree;
+  gslc_tsImgCacheEntry* pEntryLru;
+  uint8_t               nInd;
+  uint32_t              nPixBytes   = (uint32_t)nW * nH * sizeof(uint16_t);
+  uint32_t              nFnameBytes = (sImgRef.pFname != NULL)? strlen(sImgRef.pFname)+1 : 0;
+  uint32_t              nBytes      = nPixBytes + nFnameBytes;
+
+  if ((nPixBytes == 0) || (nBytes > pGui->nImgCacheBudget)) {
+    return NULL;
+  }
+
+  // Evict the least recently used images until there is a free
+  // entry and the new image fits within the budget
+  while (1) {
+    pEntryFree = NULL;
+    pEntryLru  = NULL;
+    for (nInd=0;nInd<GSLC_IMG_CACHE_MAX;nInd++) {
+      pEntry = &pGui->asImgCache[nInd];
+      if (pEntry->pPix == NULL) {
+        if (pEntryFree == NULL) {
+          pEntryFree = pEntry;
+        }
+      } else if ((pEntryLru == NULL) || (pEntry->nLastUse - pEntryLru->nLastUse > 0x80000000UL)) {
+        // Compare use counters with wrap-around
+        pEntryLru = pEntry;
+      }
+    }
+    if ((pEntryFree != NULL) && (pStats->nBytesUsed + nBytes <= pGui->nImgCacheBudget)) {
+      break;
+    }
+    // The budget check above guarantees that an image remains to evict
+    gslc_ImgCacheRemove(pGui,pEntryLru);
+    pStats->nEvict++;
+  }
+
+  // Allocate the pixels and pathname copy in a single block
+  pEntry = pEntryFree;
+  pEntry->pPix = (uint16_t*)gslc_ImgCacheMalloc(nBytes);
+  if (pEntry->pPix == NULL) {
+    GSLC_DEBUG2_PRINT("ERROR: ImgCacheAdd() failed to allocate %u bytes\n",(unsigned)nBytes);
+    return NULL;
+  }
+  pEntry->pFname = NULL;
+  if (sImgRef.pFname != NULL) {
+    pEntry->pFname = (char*)pEntry->pPix + nPixBytes;
+    strcpy(pEntry->pFname,sImgRef.pFname);
+  }
+  pEntry->eImgFlags = sImgRef.eImgFlags;
+  pEntry->pImgBuf   = sImgRef.pImgBuf;
+  pEntry->nW        = nW;
+  pEntry->nH        = nH;
+  pEntry->bTrans    = false;
+  pEntry->nTransRaw = 0;
+  pEntry->nBytes    = nBytes;
+  pEntry->nSrcBytes = nSrcBytes;
+  pEntry->nLastUse  = ++pGui->nImgCacheUse;
+  pStats->nCnt++;
+  pStats->nBytesUsed += nBytes;
+  return pEntry;
+}
+
+void gslc_ImgCacheRemove(gslc_tsGui* pGui,gslc_tsImgCacheEntry* pEntry)
+{
+  if ((pEntry == NULL) || (pEntry->pPix == NULL)) {
+    return;
+  }
+  free(pEntry->pPix);
+  pEntry->pPix   = NULL;
+  pEntry->pFname = NULL;
+  pGui->sImgCacheStats.nCnt--;
+  pGui->sImgCacheStats.nBytesUsed -= pEntry->nBytes;
+}
+
+void gslc_ImgCacheSetBudget(gslc_tsGui* pGui,uint32_t nBytes)
+{
+  if (pGui == NULL) {
+    static const char GSLC_PMEM FUNCSTR[] = "ImgCacheSetBudget";
+    GSLC_DEBUG2_PRINT_CONST(ERRSTR_NULL,FUNCSTR);
+    return;
+  }
+  gslc_tsImgCacheEntry* pEntry;
+  gslc_tsImgCacheEntry* pEntryLru;
+  uint8_t               nInd;
+  pGui->nImgCacheBudget = nBytes;
+  while (pGui->sImgCacheStats.nBytesUsed > nBytes) {
+    pEntryLru = NULL;
+    for (nInd=0;nInd<GSLC_IMG_CACHE_MAX;nInd++) {
+      pEntry = &pGui->asImgCache[nInd];
+      if ((pEntry->pPix != NULL) &&
+          ((pEntryLru == NULL) || (pEntry->nLastUse - pEntryLru->nLastUse > 0x80000000UL))) {
+        pEntryLru = pEntry;
+      }
+    }
+    gslc_ImgCacheRemove(pGui,pEntryLru);
+    pGui->sImgCacheStats.nEvict++;
+  }
+}
+
+void gslc_ImgCacheClear(gslc_tsGui* pGui)
+{
+  if (pGui == NULL) {
+    static const char GSLC_PMEM FUNCSTR[] = "ImgCacheClear";
+    GSLC_DEBUG2_PRINT_CONST(ERRSTR_NULL,FUNCSTR);
+    return;
+  }
+  uint8_t nInd;
+  for (nInd=0;nInd<GSLC_IMG_CACHE_MAX;nInd++) {
+    gslc_ImgCacheRemove(pGui,&pGui->asImgCache[nInd]);
+  }
+}
+
+void gslc_ImgCacheGetStats(gslc_tsGui* pGui,gslc_tsImgCacheStats* pStats)
+{
+  if ((pGui == NULL) || (pStats == NULL)) {
+    static const char GSLC_PMEM FUNCSTR[] = "ImgCacheGetStats";
+    GSLC_DEBUG2_PRINT_CONST(ERRSTR_NULL,FUNCSTR);
+    return;
+  }
+  *pStats = pGui->sImgCacheStats;
+  pStats->nBudget = pGui->nImgCacheBudget;
+}
+
+void gslc_ImgCacheResetStats(gslc_tsGui* pGui)
+{
+  if (pGui == NULL) {
+    static const char GSLC_PMEM FUNCSTR[] = "ImgCacheResetStats";
+    GSLC_DEBUG2_PRINT_CONST(ERRSTR_NULL,FUNCSTR);
+    return;
+  }
+  // The occupancy is retained as it reflects the cache contents
+  gslc_tsImgCacheStats* pStats = &pGui->sImgCacheStats;
+  pStats->nHit        = 0;
+  pStats->nMiss       = 0;
+  pStats->nEvict      = 0;
+  pStats->nBytesSaved = 0;
+}
+
+#endif // GSLC_FEATURE_IMG_CACHE
+
+
+// Sine function with optional lookup table
+// - Note that the n64Ang range is limited by 16-bit integers
+//   to an effective degree range of -511 to +511 degrees,
+//   defined by the max integer range: 32767/64.
+int16_t gslc_sinFX(int16_t n64Ang)
+{
+  int16_t   nRetValS;
+
+#if (GSLC_USE_FLOAT)
+  // Use floating-point math library function
+
+  // Calculate angle in radians
+  float fAngRad = n64Ang*GSLC_2PI/(360.0*64.0);
+  // Perform floating point calc
+  float fSin = sin(fAngRad);
+  // Return as fixed point result
+  nRetValS = fSin * 32767.0;
+  return nRetValS;
+
+#else
   // TODO: Clean up excess integer typecasting
 
   // Use lookup tables
@@ -1147,6 +1842,80 @@ void gslc_PolarToXY(uint16_t nRad,int16_t n64Ang,int16_t* nDX,int16_t* nDY)
   *nDY = nTmp / 32767;
 }
 
+void gslc_PolarCacheInit(gslc_tsPolarCache* pCache,gslc_tsPt* asPt,uint16_t nPtMax)
+{
+  if (pCache == NULL) {
+    static const char GSLC_PMEM FUNCSTR[] = "PolarCacheInit";
+    GSLC_DEBUG2_PRINT_CONST(ERRSTR_NULL,FUNCSTR);
+    return;
+  }
+  pCache->asPt = asPt;
+  pCache->nPtMax = (asPt)? nPtMax : 0;
+  pCache->nQuality = 0;
+  pCache->nRadCnt = 0;
+}
+
+void gslc_PolarCacheReset(gslc_tsPolarCache* pCache)
+{
+  if (pCache == NULL) {
+    static const char GSLC_PMEM FUNCSTR[] = "PolarCacheReset";
+    GSLC_DEBUG2_PRINT_CONST(ERRSTR_NULL,FUNCSTR);
+    return;
+  }
+  pCache->nRadCnt = 0;
+}
+
+gslc_tsPt* gslc_PolarCacheGet(gslc_tsPolarCache* pCache,uint16_t nQuality,int16_t nRad)
+{
+  if (pCache == NULL) {
+    static const char GSLC_PMEM FUNCSTR[] = "PolarCacheGet";
+    GSLC_DEBUG2_PRINT_CONST(ERRSTR_NULL,FUNCSTR);
+    return NULL;
+  }
+  // Only integer segment angles repeat on each rotation
+  if ((nQuality == 0) || (360 % nQuality != 0)) {
+    return NULL;
+  }
+  if (pCache->nQuality != nQuality) {
+    pCache->nQuality = nQuality;
+    pCache->nRadCnt = 0;
+  }
+  uint8_t nRadInd;
+  for (nRadInd=0;nRadInd<pCache->nRadCnt;nRadInd++) {
+    if (pCache->anRad[nRadInd] == nRad) {
+      return &pCache->asPt[nRadInd * nQuality];
+    }
+  }
+  // Add the radius if there is space remaining
+  if ((nRadInd >= GSLC_POLAR_CACHE_RAD_MAX) || ((uint32_t)(nRadInd+1) * nQuality > pCache->nPtMax)) {
+    return NULL;
+  }
+  gslc_tsPt*  asRing = &pCache->asPt[nRadInd * nQuality];
+  int16_t     nStep64 = 64 * (360 / nQuality);
+  uint16_t    nSegInd;
+  for (nSegInd=0;nSegInd<nQuality;nSegInd++) {
+    gslc_PolarToXY(nRad,nSegInd * nStep64,&asRing[nSegInd].x,&asRing[nSegInd].y);
+  }
+  pCache->anRad[nRadInd] = nRad;
+  pCache->nRadCnt++;
+  return asRing;
+}
+
+void gslc_PolarSegToXY(gslc_tsPt* asRing,uint16_t nQuality,uint16_t nRad,int16_t nSegInd,int16_t* pnDX,int16_t* pnDY)
+{
+  if (asRing) {
+    // Wrap the segment index into a single rotation
+    int16_t nInd = nSegInd % (int16_t)nQuality;
+    nInd = (nInd < 0)? nInd + nQuality : nInd;
+    *pnDX = asRing[nInd].x;
+    *pnDY = asRing[nInd].y;
+  } else {
+    int16_t nStep64 = 64 * (360 / nQuality);
+    int16_t nAng64 = ((int32_t)nSegInd * nStep64) % (int32_t)(360 * 64);
+    gslc_PolarToXY(nRad,nAng64,pnDX,pnDY);
+  }
+}
+
 // Call with nMidAmt=500 to create simple linear blend between two colors
 gslc_tsColor gslc_ColorBlend2(gslc_tsColor colStart,gslc_tsColor colEnd,uint16_t nMidAmt,uint16_t nBlendAmt)
 {
@@ -1202,6 +1971,129 @@ void gslc_DrawSetPixel(gslc_tsGui* pGui,int16_t nX,int16_t nY,gslc_tsColor nCol)
   gslc_PageFlipSet(pGui,true);
 }
 
+void gslc_DrawPointBatch(gslc_tsGui* pGui,int16_t nX,int16_t nY,gslc_tsColor nCol)
+{
+#if (GSLC_FEATURE_PT_BATCH)
+  gslc_tsPtBatch* pBatch = &pGui->sPtBatch;
+
+  // Draw the pending points if the color changes or the batch is full
+  if (pBatch->nPtCnt > 0) {
+    if ((pBatch->nPtCnt >= GSLC_PT_BATCH_MAX) || (!gslc_ColorEqual(pBatch->nCol,nCol))) {
+      gslc_DrawPointBatchFlush(pGui);
+    }
+  }
+  pBatch->nCol = nCol;
+  pBatch->asPt[pBatch->nPtCnt].x = nX;
+  pBatch->asPt[pBatch->nPtCnt].y = nY;
+  pBatch->nPtCnt++;
+#else
+  gslc_DrawSetPixel(pGui,nX,nY,nCol);
+#endif
+}
+
+void gslc_DrawPointBatchFlush(gslc_tsGui* pGui)
+{
+#if (GSLC_FEATURE_PT_BATCH)
+  gslc_tsPtBatch* pBatch = &pGui->sPtBatch;
+  uint16_t        nPtCnt = pBatch->nPtCnt;
+  if (nPtCnt == 0) {
+    return;
+  }
+  pBatch->nPtCnt = 0;
+
+  #if (DRV_HAS_DRAW_POINTS)
+  // The driver already accepts the points in a single call
+  #elif (DRV_HAS_DRAW_RECT_FILL) || (DRV_HAS_DRAW_LINE)
+  // Draw the horizontal runs, then any vertical runs amongst the
+  // points that remain
+  nPtCnt = gslc_DrawPointBatchRuns(pGui,pBatch->asPt,nPtCnt,false,pBatch->nCol);
+  nPtCnt = gslc_DrawPointBatchRuns(pGui,pBatch->asPt,nPtCnt,true,pBatch->nCol);
+  #endif
+
+  // Draw the remaining single points
+  #if (DRV_HAS_DRAW_POINTS)
+  if (nPtCnt > 0) {
+    gslc_DrvDrawPoints(pGui,pBatch->asPt,nPtCnt,pBatch->nCol);
+  }
+  #elif (DRV_HAS_DRAW_POINT)
+  uint16_t nInd;
+  for (nInd=0;nInd<nPtCnt;nInd++) {
+    gslc_DrvDrawPoint(pGui,pBatch->asPt[nInd].x,pBatch->asPt[nInd].y,pBatch->nCol);
+  }
+  #endif
+
+  gslc_PageFlipSet(pGui,true);
+#else
+  (void)pGui; // Unused
+#endif
+}
+
+#if (GSLC_FEATURE_PT_BATCH)
+uint16_t gslc_DrawPointBatchRuns(gslc_tsGui* pGui,gslc_tsPt* asPt,uint16_t nPtCnt,bool bVert,gslc_tsColor nCol)
+{
+  uint16_t  nInd,nIndSort,nRunStart;
+  uint16_t  nSingleCnt = 0;
+  int16_t   nMaj,nMin,nMinStart;
+  int16_t   nCurMaj,nCurMin;
+  gslc_tsPt sPt;
+
+  // Sort the points by row (or column), then by position along it.
+  // An insertion sort suffices for the small batch, especially as
+  // the primitives tend to emit points in an orderly fashion.
+  for (nInd=1;nInd<nPtCnt;nInd++) {
+    sPt  = asPt[nInd];
+    nMaj = (bVert)? sPt.x : sPt.y;
+    nMin = (bVert)? sPt.y : sPt.x;
+    for (nIndSort=nInd;nIndSort>0;nIndSort--) {
+      nCurMaj = (bVert)? asPt[nIndSort-1].x : asPt[nIndSort-1].y;
+      nCurMin = (bVert)? asPt[nIndSort-1].y : asPt[nIndSort-1].x;
+      if ((nCurMaj < nMaj) || ((nCurMaj == nMaj) && (nCurMin <= nMin))) {
+        break;
+      }
+      asPt[nIndSort] = asPt[nIndSort-1];
+    }
+    asPt[nIndSort] = sPt;
+  }
+
+  // Scan for runs of adjacent (or repeated) points
+  nInd = 0;
+  while (nInd < nPtCnt) {
+    nRunStart = nInd;
+    nMaj      = (bVert)? asPt[nInd].x : asPt[nInd].y;
+    nMinStart = (bVert)? asPt[nInd].y : asPt[nInd].x;
+    nMin      = nMinStart;
+    for (nInd++;nInd<nPtCnt;nInd++) {
+      nCurMaj = (bVert)? asPt[nInd].x : asPt[nInd].y;
+      nCurMin = (bVert)? asPt[nInd].y : asPt[nInd].x;
+      if ((nCurMaj != nMaj) || (nCurMin > nMin+1)) {
+        break;
+      }
+      nMin = nCurMin;
+    }
+
+    if (nMin == nMinStart) {
+      // Retain a single point (dropping any repeats) for the caller.
+      // This never overwrites a point that has yet to be scanned.
+      asPt[nSingleCnt++] = asPt[nRunStart];
+    } else {
+      // Draw the run
+      gslc_tsRect rRun;
+      rRun.x = (bVert)? nMaj : nMinStart;
+      rRun.y = (bVert)? nMinStart : nMaj;
+      rRun.w = (bVert)? 1 : nMin-nMinStart+1;
+      rRun.h = (bVert)? nMin-nMinStart+1 : 1;
+      #if (DRV_HAS_DRAW_RECT_FILL)
+      gslc_DrvDrawFillRect(pGui,rRun,nCol);
+      #elif (DRV_HAS_DRAW_LINE)
+      gslc_DrvDrawLine(pGui,rRun.x,rRun.y,rRun.x+rRun.w-1,rRun.y+rRun.h-1,nCol);
+      #endif
+    }
+  }
+
+  return nSingleCnt;
+}
+#endif // GSLC_FEATURE_PT_BATCH
+
 // Draw an arbitrary line using Bresenham's algorithm
 // - Algorithm reference: https://rosettacode.org/wiki/Bitmap/Bresenham's_line_algorithm#C
 void gslc_DrawLine(gslc_tsGui* pGui,int16_t nX0,int16_t nY0,int16_t nX1,int16_t nY1,gslc_tsColor nCol)
@@ -1247,7 +2139,7 @@ void gslc_DrawLine(gslc_tsGui* pGui,int16_t nX0,int16_t nY0,int16_t nX1,int16_t
   if (!bDone) {
     for (;;) {
       // Set the pixel
-      gslc_DrvDrawPoint(pGui,nX0,nY0,nCol);
+      gslc_DrawPointBatch(pGui,nX0,nY0,nCol);
 
       // Calculate next coordinates
       if ( (nX0 == nX1) && (nY0 == nY1) ) break;
@@ -1255,6 +2147,7 @@ void gslc_DrawLine(gslc_tsGui* pGui,int16_t nX0,int16_t nY0,int16_t nX1,int16_t
       if (nE2 > -nDX) { nErr -= nDY; nX0 += nSX; }
       if (nE2 <  nDY) { nErr += nDX; nY0 += nSY; }
     }
+    gslc_DrawPointBatchFlush(pGui);
   }
   gslc_PageFlipSet(pGui,true);
 #endif
@@ -1266,8 +2159,9 @@ void gslc_DrawLineH(gslc_tsGui* pGui,int16_t nX, int16_t nY, uint16_t nW,gslc_ts
 {
   uint16_t nOffset;
   for (nOffset=0;nOffset<nW;nOffset++) {
-    gslc_DrvDrawPoint(pGui,nX+nOffset,nY,nCol);
+    gslc_DrawPointBatch(pGui,nX+nOffset,nY,nCol);
   }
+  gslc_DrawPointBatchFlush(pGui);
 
   gslc_PageFlipSet(pGui,true);
 }
@@ -1276,8 +2170,9 @@ void gslc_DrawLineV(gslc_tsGui* pGui,int16_t nX, int16_t nY, uint16_t nH,gslc_ts
 {
   uint16_t nOffset;
   for (nOffset=0;nOffset<nH;nOffset++) {
-    gslc_DrvDrawPoint(pGui,nX,nY+nOffset,nCol);
+    gslc_DrawPointBatch(pGui,nX,nY+nOffset,nCol);
   }
+  gslc_DrawPointBatchFlush(pGui);
 
   gslc_PageFlipSet(pGui,true);
 }
@@ -1453,13 +2348,25 @@ void gslc_UnionRect(gslc_tsRect* pRect,gslc_tsRect rAddRect)
 
 }
 
+bool gslc_IsRectOverlap(gslc_tsRect rRect1, gslc_tsRect rRect2)
+{
+  if ((rRect1.w == 0) || (rRect1.h == 0) || (rRect2.w == 0) || (rRect2.h == 0)) {
+    return false;
+  }
+  if ( (rRect1.x >= rRect2.x + (int16_t)rRect2.w) || (rRect2.x >= rRect1.x + (int16_t)rRect1.w) ||
+       (rRect1.y >= rRect2.y + (int16_t)rRect2.h) || (rRect2.y >= rRect1.y + (int16_t)rRect1.h) ) {
+    return false;
+  }
+  return true;
+}
+
 void gslc_InvalidateRgnReset(gslc_tsGui* pGui)
 {
 #if defined(DBG_REDRAW)
   GSLC_DEBUG_PRINT("DBG: InvRgnReset\n", "");
 #endif
   pGui->bInvalidateEn = false;
-  pGui->rInvalidateRect = (gslc_tsRect) { 0, 0, 1, 1 };
+  pGui->nInvalidateRectCnt = 0;
 }
 
 void gslc_InvalidateRgnScreen(gslc_tsGui* pGui)
@@ -1468,7 +2375,8 @@ void gslc_InvalidateRgnScreen(gslc_tsGui* pGui)
   GSLC_DEBUG_PRINT("DBG: InvRgnScreen\n", "");
 #endif
   pGui->bInvalidateEn = true;
-  pGui->rInvalidateRect = (gslc_tsRect) { 0, 0, pGui->nDispW, pGui->nDispH };
+  pGui->arInvalidateRect[0] = (gslc_tsRect) { 0, 0, pGui->nDispW, pGui->nDispH };
+  pGui->nInvalidateRectCnt = 1;
 }
 
 void gslc_InvalidateRgnPage(gslc_tsGui* pGui, gslc_tsPage* pPage)
@@ -1486,13 +2394,131 @@ void gslc_InvalidateRgnPage(gslc_tsGui* pGui, gslc_tsPage* pPage)
 }
 
 
+// Calculate the cost (in pixels) of combining two rect regions
+// - The cost is the area that would be redrawn by the bounding box
+//   of the two regions but is not covered by either of them
+int32_t gslc_InvalidateRgnMergeCost(gslc_tsRect rRect1, gslc_tsRect rRect2)
+{
+  gslc_tsRect rUnion = rRect1;
+  gslc_UnionRect(&rUnion, rRect2);
+  int32_t nCost = (int32_t)rUnion.w * rUnion.h;
+  nCost -= (int32_t)rRect1.w * rRect1.h;
+  nCost -= (int32_t)rRect2.w * rRect2.h;
+
+  // Account for any area shared by the two regions
+  int16_t nX0 = GSLC_MAX(rRect1.x, rRect2.x);
+  int16_t nY0 = GSLC_MAX(rRect1.y, rRect2.y);
+  int16_t nX1 = GSLC_MIN(rRect1.x + (int16_t)rRect1.w, rRect2.x + (int16_t)rRect2.w);
+  int16_t nY1 = GSLC_MIN(rRect1.y + (int16_t)rRect1.h, rRect2.y + (int16_t)rRect2.h);
+  if ((nX1 > nX0) && (nY1 > nY0)) {
+    nCost += (int32_t)(nX1 - nX0) * (nY1 - nY0);
+  }
+  return nCost;
+}
+
 void gslc_InvalidateRgnAdd(gslc_tsGui* pGui, gslc_tsRect rAddRect)
 {
-  if (pGui->bInvalidateEn) {
-    gslc_UnionRect(&(pGui->rInvalidateRect), rAddRect);
-  } else {
+  // Start a new invalidation region if none is active
+  if (!pGui->bInvalidateEn) {
     pGui->bInvalidateEn = true;
-    pGui->rInvalidateRect = rAddRect;
+    pGui->nInvalidateRectCnt = 0;
+  }
+
+  gslc_RectListAdd(pGui->arInvalidateRect, &(pGui->nInvalidateRectCnt), GSLC_INVALIDATE_RECT_MAX, rAddRect);
+}
+
+#if (GSLC_FEATURE_UPDATE_BUDGET)
+bool gslc_InvalidateRgnContains(gslc_tsGui* pGui,gslc_tsRect rRect)
+{
+  uint8_t nInd;
+  if (!pGui->bInvalidateEn) {
+    return false;
+  }
+  // Since the list is kept disjoint, a region that has been added
+  // lies entirely within a single entry
+  for (nInd = 0; nInd < pGui->nInvalidateRectCnt; nInd++) {
+    gslc_tsRect* pRect = &(pGui->arInvalidateRect[nInd]);
+    if ( (rRect.x >= pRect->x) && (rRect.y >= pRect->y) &&
+         (rRect.x + (int16_t)rRect.w <= pRect->x + (int16_t)pRect->w) &&
+         (rRect.y + (int16_t)rRect.h <= pRect->y + (int16_t)pRect->h) ) {
+      return true;
+    }
+  }
+  return false;
+}
+#endif // GSLC_FEATURE_UPDATE_BUDGET
+
+void gslc_RectListAdd(gslc_tsRect* arRect, uint8_t* pnRectCnt, uint8_t nRectMax, gslc_tsRect rAddRect)
+{
+  uint8_t       nInd, nIndB;
+  uint8_t       nBestA, nBestB;
+  int32_t       nCost, nBestCost;
+  gslc_tsRect   rPair;
+
+  // Nothing to add for an empty region
+  if ((rAddRect.w == 0) || (rAddRect.h == 0)) {
+    return;
+  }
+
+  while (1) {
+    // Absorb any existing regions that overlap the new region or are
+    // close enough that an additional redraw pass isn't worthwhile.
+    // - The list is kept disjoint so that any region that has been
+    //   added lies within exactly one entry
+    // - Since the new region grows as entries are absorbed, restart
+    //   the scan after each merge
+    nInd = 0;
+    while (nInd < *pnRectCnt) {
+      if ( gslc_IsRectOverlap(arRect[nInd], rAddRect) ||
+           (gslc_InvalidateRgnMergeCost(arRect[nInd], rAddRect) <= GSLC_INVALIDATE_PASS_COST) ) {
+        gslc_UnionRect(&rAddRect, arRect[nInd]);
+        arRect[nInd] = arRect[--(*pnRectCnt)];
+        nInd = 0;
+      } else {
+        nInd++;
+      }
+    }
+
+    if (*pnRectCnt < nRectMax) {
+      arRect[(*pnRectCnt)++] = rAddRect;
+      return;
+    }
+
+    // The list is full, so combine the pair of regions (including
+    // the new region at index *pnRectCnt) with the lowest cost
+    nBestA = 0;
+    nBestB = *pnRectCnt;
+    nBestCost = gslc_InvalidateRgnMergeCost(arRect[0], rAddRect);
+    for (nInd = 0; nInd < *pnRectCnt; nInd++) {
+      for (nIndB = nInd + 1; nIndB <= *pnRectCnt; nIndB++) {
+        if (nIndB == *pnRectCnt) {
+          nCost = gslc_InvalidateRgnMergeCost(arRect[nInd], rAddRect);
+        } else {
+          nCost = gslc_InvalidateRgnMergeCost(arRect[nInd], arRect[nIndB]);
+        }
+        if (nCost < nBestCost) {
+          nBestCost = nCost;
+          nBestA = nInd;
+          nBestB = nIndB;
+        }
+      }
+    }
+
+    if (nBestB == *pnRectCnt) {
+      // Cheapest to combine the new region with an existing one
+      gslc_UnionRect(&rAddRect, arRect[nBestA]);
+      arRect[nBestA] = arRect[--(*pnRectCnt)];
+    } else {
+      // Cheapest to combine two existing regions. The new region
+      // takes one of the freed slots and the combined pair is then
+      // reinserted (as it may now overlap other regions).
+      rPair = arRect[nBestA];
+      gslc_UnionRect(&rPair, arRect[nBestB]);
+      arRect[nBestB] = arRect[--(*pnRectCnt)];
+      arRect[nBestA] = arRect[--(*pnRectCnt)];
+      arRect[(*pnRectCnt)++] = rAddRect;
+      rAddRect = rPair;
+    }
   }
 }
 
@@ -1536,6 +2562,29 @@ void gslc_DrawFrameCircle(gslc_tsGui* pGui,int16_t nMidX,int16_t nMidY,
         }
       } // while
 
+    #elif (GSLC_FEATURE_PT_BATCH)
+      // Collect the points so that runs are drawn as lines
+      while (nX >= nY)
+      {
+        gslc_DrawPointBatch(pGui,nMidX + nX, nMidY + nY,nCol);
+        gslc_DrawPointBatch(pGui,nMidX + nY, nMidY + nX,nCol);
+        gslc_DrawPointBatch(pGui,nMidX - nY, nMidY + nX,nCol);
+        gslc_DrawPointBatch(pGui,nMidX - nX, nMidY + nY,nCol);
+        gslc_DrawPointBatch(pGui,nMidX - nX, nMidY - nY,nCol);
+        gslc_DrawPointBatch(pGui,nMidX - nY, nMidY - nX,nCol);
+        gslc_DrawPointBatch(pGui,nMidX + nY, nMidY - nX,nCol);
+        gslc_DrawPointBatch(pGui,nMidX + nX, nMidY - nY,nCol);
+
+        nY    += 1;
+        nErr  += 1 + 2*nY;
+        if (2*(nErr-nX) + 1 > 0)
+        {
+            nX -= 1;
+            nErr += 1 - 2*nX;
+        }
+      } // while
+      gslc_DrawPointBatchFlush(pGui);
+
     #elif (DRV_HAS_DRAW_POINT)
       while (nX >= nY)
       {
@@ -1663,78 +2712,13 @@ void gslc_DrawFillTriangle(gslc_tsGui* pGui,int16_t nX0,int16_t nY0,
     gslc_DrvDrawFillTriangle(pGui,nX0,nY0,nX1,nY1,nX2,nY2,nCol);
 
   #else
-    // Emulate triangle fill
-
-    // Algorithm:
-    // - An arbitrary triangle is cut into two portions:
-    //   1) a flat bottom triangle
-    //   2) a flat top triangle
-    // - Sort the vertices in descending vertical position.
-    //   This serves two purposes:
-    //   1) ensures that the division between the flat bottom
-    //      and flat top triangles occurs at Y=Y1
-    //   2) ensure that we avoid division-by-zero in the for loops
-    // - Walk each scan line and determine the intersection
-    //   between triangle side A & B (flat bottom triangle)
-    //   and then C and B (flat top triangle) using line slopes.
-
-    // Sort vertices
-    // - Want nY0 >= nY1 >= nY2
-    if (nY2>nY1) { gslc_SwapCoords(&nX2,&nY2,&nX1,&nY1); }
-    if (nY1>nY0) { gslc_SwapCoords(&nX0,&nY0,&nX1,&nY1); }
-    if (nY2>nY1) { gslc_SwapCoords(&nX2,&nY2,&nX1,&nY1); }
-
-    // TODO: It is more efficient to calculate row endpoints
-    // using incremental additions instead of multiplies/divides
-
-    int16_t nXa,nXb,nXc,nYos;
-    int16_t nX01,nX20,nY01,nY20,nX21,nY21;
-    nX01 = nX0-nX1; nY01 = nY0-nY1;
-    nX20 = nX2-nX0; nY20 = nY2-nY0;
-    nX21 = nX2-nX1; nY21 = nY2-nY1;
-
-    // Flat bottom scenario
-    // NOTE: Due to vertex sorting and loop range, it shouldn't
-    // be possible to enter loop when nY0 == nY1 or nY2
-    for (nYos=0;nYos<nY01;nYos++) {
-      // Determine row endpoints (no rounding)
-      //nXa = (nYos          )*(nX0-nX1)/(nY0-nY1);
-      //nXb = (nYos-(nY0-nY1))*(nX2-nX0)/(nY2-nY0);
-
-      // Determine row endpoints (using rounding)
-      nXa  = 2*(nYos)*nX01;
-      nXa += (nXa>=0)?abs(nY01):-abs(nY01);
-      nXa /= 2*nY01;
-
-      nXb = 2*(nYos-nY01)*nX20;
-      nXb += (nXb>=0)?abs(nY20):-abs(nY20);
-      nXb /= 2*nY20;
-
-      // Draw horizontal line between endpoints
-      gslc_DrawLine(pGui,nX1+nXa,nY1+nYos,nX0+nXb,nY1+nYos,nCol);
-    }
-
-    // Flat top scenario
-    // NOTE: Due to vertex sorting and loop range, it shouldn't
-    // be possible to enter loop when nY2 == nY0 or nY1
-    for (nYos=nY21;nYos<0;nYos++) {
-
-      // Determine row endpoints (no rounding)
-      //nXc = (nYos          )*(nX2-nX1)/(nY2-nY1);
-      //nXb = (nYos-(nY0-nY1))*(nX2-nX0)/(nY2-nY0);
-
-      // Determine row endpoints (using rounding)
-      nXc  = 2*(nYos)*nX21;
-      nXc += (nXc>=0)?abs(nY21):-abs(nY21);
-      nXc /= 2*nY21;
-
-      nXb = 2*(nYos-nY01)*nX20;
-      nXb += (nXb>=0)?abs(nY20):-abs(nY20);
-      nXb /= 2*nY20;
-
-      // Draw horizontal line between endpoints
-      gslc_DrawLine(pGui,nX1+nXc,nY1+nYos,nX0+nXb,nY1+nYos,nCol);
-    }
+    // Emulate triangle fill with the polygon scanline rasterizer
+    // - Pixels on the edges are included, as with the driver fills
+    gslc_tsPt asPt[3];
+    asPt[0] = (gslc_tsPt){nX0,nY0};
+    asPt[1] = (gslc_tsPt){nX1,nY1};
+    asPt[2] = (gslc_tsPt){nX2,nY2};
+    gslc_DrawFillPolygonBase(pGui,asPt,3,nCol,true);
 
   #endif  // DRV_HAS_DRAW_TRI_FILL
 
@@ -1760,11 +2744,15 @@ void gslc_DrawFrameQuad(gslc_tsGui* pGui,gslc_tsPt* psPt,gslc_tsColor nCol)
 }
 
 // Filling a quadrilateral is done by breaking it down into
-// two filled triangles sharing one side. We have to be careful
-// about the triangle fill routine (ie. using rounding) so that
-// we can avoid leaving a thin seam between the two triangles.
+// two filled triangles sharing one side if the driver provides
+// an optimized triangle fill. We have to be careful about the
+// triangle fill routine (ie. using rounding) so that we can
+// avoid leaving a thin seam between the two triangles.
+// Otherwise the quadrilateral is scan converted in a single
+// pass, avoiding the redraw of the shared side.
 void gslc_DrawFillQuad(gslc_tsGui* pGui,gslc_tsPt* psPt,gslc_tsColor nCol)
 {
+#if (DRV_HAS_DRAW_TRI_FILL)
   int16_t nX0,nY0,nX1,nY1,nX2,nY2;
 
   // Break down quadrilateral into two triangles
@@ -1777,28 +2765,269 @@ void gslc_DrawFillQuad(gslc_tsGui* pGui,gslc_tsPt* psPt,gslc_tsColor nCol)
   nX1 = psPt[0].x; nY1 = psPt[0].y;
   nX2 = psPt[3].x; nY2 = psPt[3].y;
   gslc_DrawFillTriangle(pGui,nX0,nY0,nX1,nY1,nX2,nY2,nCol);
+#else
+  gslc_DrawFillPolygonBase(pGui,psPt,4,nCol,true);
+#endif
 
 }
 
-void gslc_DrawFillSectorBase(gslc_tsGui* pGui, int16_t nQuality, int16_t nMidX, int16_t nMidY, int16_t nRad1, int16_t nRad2,
-  gslc_tsColor cArcStart, gslc_tsColor cArcEnd,bool bGradient, int16_t nAngGradStart, int16_t nAngGradRange,int16_t nAngSecStart,int16_t nAngSecEnd)
-{
-  gslc_tsPt anPts[4];
+// Scan convert a polygon using an edge table
+// - The edge table is sorted by the first scanline of each edge.
+//   As the scanline advances, edges move from the edge table into
+//   the active edge list and are retired once passed.
+// - The X intercepts of the active edges are updated incrementally
+//   and sorted to form the spans between pairs of intercepts.
+// - A scanline at Y is considered to pass through the centers of
+//   the pixels in row Y. Edges cover the half-open range of
+//   scanlines [nYMin,nYMax) and spans cover the pixel centers in
+//   the half-open range [nXLeft,nXRight), so adjacent polygons
+//   tile without overlap.
+// - Each intercept is maintained as the next pixel at or beyond
+//   the exact intercept (nXCeil) along with the distance from the
+//   exact intercept in units of 1/nDY (nErr), ie:
+//     X = nX0 + nDX*(Y-nYMin)/nDY = nXCeil - nErr/nDY
+// - With bEdgeIncl, pixel centers that lie exactly on the boundary
+//   are also filled. Intercepts on the right edge are then closed,
+//   and the vertices and horizontal edges on each scanline (which
+//   the half-open ranges skip along the bottom) are added if not
+//   already covered by a span.
+void gslc_DrawFillPolygon(gslc_tsGui* pGui,gslc_tsPt* asPt,uint16_t nNumPt,gslc_tsColor nCol)
+{
+  gslc_DrawFillPolygonBase(pGui,asPt,nNumPt,nCol,false);
+}
+
+void gslc_DrawFillPolygonBase(gslc_tsGui* pGui,gslc_tsPt* asPt,uint16_t nNumPt,gslc_tsColor nCol,bool bEdgeIncl)
+{
+  if ((pGui == NULL) || (asPt == NULL)) {
+    static const char GSLC_PMEM FUNCSTR[] = "DrawFillPolygonBase";
+    GSLC_DEBUG2_PRINT_CONST(ERRSTR_NULL,FUNCSTR);
+    return;
+  }
+  if (nNumPt < 3) {
+    return;
+  }
+  if (nNumPt > GSLC_POLY_VERT_MAX) {
+    GSLC_DEBUG2_PRINT("ERROR: DrawFillPolygon() too many vertices (%u > GSLC_POLY_VERT_MAX)\n",nNumPt);
+    return;
+  }
 
-  // Calculate degrees per step (based on quality setting)
-  int16_t nStepAng = 360 / nQuality;
-  int16_t nStep64 = 64 * nStepAng;
+  gslc_tsPolyEdge asEdge[GSLC_POLY_VERT_MAX];
+  uint16_t        anActive[GSLC_POLY_VERT_MAX];
+  int16_t         anActiveX[GSLC_POLY_VERT_MAX];
+  int16_t         anActiveErr[GSLC_POLY_VERT_MAX];
+  uint16_t        nEdgeCnt = 0;
+  uint16_t        nEdgeNext = 0;
+  uint16_t        nActiveCnt = 0;
+  uint16_t        nInd,nPos;
+  int16_t         nY,nYEnd;
+  gslc_tsPolyEdge sEdge;
+  gslc_tsPolyEdge* pEdge;
+
+  // Build the edge table, ordered by first scanline
+  // - Horizontal edges are omitted as they don't cross a scanline
+  nYEnd = asPt[0].y;
+  for (nInd=0;nInd<nNumPt;nInd++) {
+    gslc_tsPt sPtA = asPt[nInd];
+    gslc_tsPt sPtB = asPt[(nInd+1 < nNumPt)? nInd+1 : 0];
+    if (sPtA.y == sPtB.y) {
+      continue;
+    }
+    if (sPtA.y > sPtB.y) {
+      gslc_tsPt sPtSwap = sPtA;
+      sPtA = sPtB;
+      sPtB = sPtSwap;
+    }
+    sEdge.nYMin  = sPtA.y;
+    sEdge.nYMax  = sPtB.y;
+    sEdge.nX0    = sPtA.x;
+    sEdge.nDX    = sPtB.x - sPtA.x;
+    sEdge.nDY    = sPtB.y - sPtA.y;
+    // Split the slope into whole and fractional parts with the
+    // fractional part in the range [0,nDY)
+    sEdge.nStepQ = sEdge.nDX / sEdge.nDY;
+    sEdge.nStepR = sEdge.nDX % sEdge.nDY;
+    if (sEdge.nStepR < 0) {
+      sEdge.nStepQ--;
+      sEdge.nStepR += sEdge.nDY;
+    }
+    nYEnd = (sEdge.nYMax > nYEnd)? sEdge.nYMax : nYEnd;
+    // Insertion sort by first scanline
+    for (nPos=nEdgeCnt;(nPos>0) && (asEdge[nPos-1].nYMin > sEdge.nYMin);nPos--) {
+      asEdge[nPos] = asEdge[nPos-1];
+    }
+    asEdge[nPos] = sEdge;
+    nEdgeCnt++;
+  }
+  if (nEdgeCnt == 0) {
+    // All vertices lie on one scanline, so only the inclusive
+    // fill covers any pixels (the horizontal extent)
+    if (bEdgeIncl) {
+      int16_t nXMin = asPt[0].x;
+      int16_t nXMax = asPt[0].x;
+      for (nInd=1;nInd<nNumPt;nInd++) {
+        nXMin = (asPt[nInd].x < nXMin)? asPt[nInd].x : nXMin;
+        nXMax = (asPt[nInd].x > nXMax)? asPt[nInd].x : nXMax;
+      }
+      gslc_DrawFillRect(pGui,(gslc_tsRect){nXMin,asPt[0].y,(uint16_t)(nXMax-nXMin+1),1},nCol);
+    }
+    return;
+  }
 
-  int16_t nAng64;
-  int16_t nX, nY;
-  int16_t nSegStart, nSegEnd;
-  gslc_tsColor colSeg;
+  // Restrict the scanlines to the display
+  // - Inclusive edges also cover the last scanline
+  nY = asEdge[0].nYMin;
+  if (nY < 0) {
+    nY = 0;
+  }
+  if (bEdgeIncl) {
+    nYEnd++;
+  }
+  if (nYEnd > (int16_t)pGui->nDispH) {
+    nYEnd = pGui->nDispH;
+  }
 
-  nSegStart = nAngSecStart * (int32_t)nQuality / 360;
-  nSegEnd = nAngSecEnd * (int32_t)nQuality / 360;
+  // Pending span rectangle, used to combine identical spans
+  // on consecutive scanlines into a single driver call
+  gslc_tsRect rSpan = {0,0,0,0};
+  int16_t     nXL,nXR;
 
-  int16_t nSegGradStart, nSegGradRange;
-  nSegGradStart = nAngGradStart * (int32_t)nQuality / 360;
+  for (;nY<nYEnd;nY++) {
+    // Retire edges that end above this scanline
+    for (nInd=0,nPos=0;nInd<nActiveCnt;nInd++) {
+      if (asEdge[anActive[nInd]].nYMax > nY) {
+        anActive[nPos] = anActive[nInd];
+        anActiveX[nPos] = anActiveX[nInd];
+        anActiveErr[nPos] = anActiveErr[nInd];
+        nPos++;
+      }
+    }
+    nActiveCnt = nPos;
+
+    // Activate edges that start at or above this scanline
+    for (;(nEdgeNext<nEdgeCnt) && (asEdge[nEdgeNext].nYMin <= nY);nEdgeNext++) {
+      pEdge = &asEdge[nEdgeNext];
+      if (pEdge->nYMax <= nY) {
+        continue;
+      }
+      // Determine the intercept directly as the edge may
+      // start above the first scanline drawn
+      int32_t nNum = (int32_t)pEdge->nX0 * pEdge->nDY + (int32_t)pEdge->nDX * (nY - pEdge->nYMin);
+      int32_t nXCeil = nNum / pEdge->nDY;
+      if (nXCeil * pEdge->nDY < nNum) {
+        nXCeil++;
+      }
+      anActive[nActiveCnt] = nEdgeNext;
+      anActiveX[nActiveCnt] = (int16_t)nXCeil;
+      anActiveErr[nActiveCnt] = (int16_t)(nXCeil * pEdge->nDY - nNum);
+      nActiveCnt++;
+    }
+
+    // Sort the active edges by X intercept
+    // - The order only changes where edges cross, so an
+    //   insertion sort is nearly linear
+    // - Intercepts within the same pixel are ordered by their exact
+    //   position so that boundary pixels pair with the correct edge
+    for (nInd=1;nInd<nActiveCnt;nInd++) {
+      uint16_t nEdgeInd = anActive[nInd];
+      int16_t  nX = anActiveX[nInd];
+      int16_t  nErr = anActiveErr[nInd];
+      int16_t  nDY = asEdge[nEdgeInd].nDY;
+      for (nPos=nInd;(nPos>0) && ((anActiveX[nPos-1] > nX) || ((anActiveX[nPos-1] == nX) &&
+          ((int32_t)anActiveErr[nPos-1] * nDY < (int32_t)nErr * asEdge[anActive[nPos-1]].nDY)));nPos--) {
+        anActive[nPos] = anActive[nPos-1];
+        anActiveX[nPos] = anActiveX[nPos-1];
+        anActiveErr[nPos] = anActiveErr[nPos-1];
+      }
+      anActive[nPos] = nEdgeInd;
+      anActiveX[nPos] = nX;
+      anActiveErr[nPos] = nErr;
+    }
+
+    // Fill the spans between pairs of intercepts
+    for (nInd=0;nInd+1<nActiveCnt;nInd+=2) {
+      nXL = anActiveX[nInd];
+      nXR = anActiveX[nInd+1];
+      if ((bEdgeIncl) && (anActiveErr[nInd+1] == 0)) {
+        nXR++;
+      }
+      if (nXR <= nXL) {
+        continue;
+      }
+      if ((rSpan.h > 0) && (rSpan.x == nXL) && (rSpan.w == (uint16_t)(nXR-nXL)) && (rSpan.y+(int16_t)rSpan.h == nY)) {
+        rSpan.h++;
+      } else {
+        if (rSpan.h > 0) {
+          gslc_DrawFillRect(pGui,rSpan,nCol);
+        }
+        rSpan = (gslc_tsRect){nXL,nY,(uint16_t)(nXR-nXL),1};
+      }
+    }
+
+    // Add the boundary pixels on this scanline that the spans skip
+    // - Each vertex on the scanline is added as a pixel, or as a
+    //   span if it starts a horizontal edge. A vertex that ends a
+    //   horizontal edge is covered by that edge.
+    for (nInd=0;(bEdgeIncl) && (nInd<nNumPt);nInd++) {
+      gslc_tsPt sPtA = asPt[nInd];
+      gslc_tsPt sPtB = asPt[(nInd+1 < nNumPt)? nInd+1 : 0];
+      gslc_tsPt sPtP = asPt[(nInd > 0)? nInd-1 : nNumPt-1];
+      if (sPtA.y != nY) {
+        continue;
+      }
+      if (sPtB.y == nY) {
+        nXL = (sPtA.x < sPtB.x)? sPtA.x : sPtB.x;
+        nXR = (sPtA.x < sPtB.x)? sPtB.x : sPtA.x;
+      } else if (sPtP.y == nY) {
+        continue;
+      } else {
+        nXL = sPtA.x;
+        nXR = sPtA.x;
+      }
+      nXR++;
+      for (nPos=0;nPos+1<nActiveCnt;nPos+=2) {
+        int16_t nSpanR = anActiveX[nPos+1] + ((anActiveErr[nPos+1] == 0)? 1 : 0);
+        if ((anActiveX[nPos] <= nXL) && (nXR <= nSpanR)) {
+          break;
+        }
+      }
+      if (nPos+1 >= nActiveCnt) {
+        gslc_DrawFillRect(pGui,(gslc_tsRect){nXL,nY,(uint16_t)(nXR-nXL),1},nCol);
+      }
+    }
+
+    // Advance the intercepts to the next scanline
+    for (nInd=0;nInd<nActiveCnt;nInd++) {
+      pEdge = &asEdge[anActive[nInd]];
+      anActiveX[nInd] += pEdge->nStepQ;
+      anActiveErr[nInd] -= pEdge->nStepR;
+      if (anActiveErr[nInd] < 0) {
+        anActiveX[nInd]++;
+        anActiveErr[nInd] += pEdge->nDY;
+      }
+    }
+  }
+  if (rSpan.h > 0) {
+    gslc_DrawFillRect(pGui,rSpan,nCol);
+  }
+
+  gslc_PageFlipSet(pGui,true);
+}
+
+void gslc_DrawFillSectorBase(gslc_tsGui* pGui, int16_t nQuality, int16_t nMidX, int16_t nMidY, int16_t nRad1, int16_t nRad2,
+  gslc_tsColor cArcStart, gslc_tsColor cArcEnd, bool bGradient, int16_t nAngGradStart, int16_t nAngGradRange,
+  int16_t nAngSecStart, int16_t nAngSecEnd, gslc_tsPolarCache* pCache)
+{
+  gslc_tsPt anPts[4];
+
+  int16_t nX, nY;
+  int16_t nSegStart, nSegEnd;
+  gslc_tsColor colSeg;
+
+  nSegStart = nAngSecStart * (int32_t)nQuality / 360;
+  nSegEnd = nAngSecEnd * (int32_t)nQuality / 360;
+
+  int16_t nSegGradStart, nSegGradRange;
+  nSegGradStart = nAngGradStart * (int32_t)nQuality / 360;
   nSegGradRange = nAngGradRange * (int32_t)nQuality / 360;
   nSegGradRange = (nSegGradRange == 0) ? 1 : nSegGradRange; // Guard against div/0
 
@@ -1813,28 +3042,68 @@ void gslc_DrawFillSectorBase(gslc_tsGui* pGui, int16_t nQuality, int16_t nMidX,
     bClockwise = false;
   }
 
+  // Fetch the vertices at each radius from the cache (if provided)
+  // - Vertices are otherwise calculated as needed
+  gslc_tsPt* asRing1 = NULL;
+  gslc_tsPt* asRing2 = NULL;
+  if (pCache) {
+    asRing1 = (nRad1 == 0)? NULL : gslc_PolarCacheGet(pCache, nQuality, nRad1);
+    asRing2 = gslc_PolarCacheGet(pCache, nQuality, nRad2);
+  }
+
   #if defined(DBG_REDRAW)
   //GSLC_DEBUG_PRINT("FillSector: AngSecStart=%d AngSecEnd=%d SegStart=%d SegEnd=%d StepCnt=%d CW=%d\n",
   //  nAngSecStart,nAngSecEnd,nSegStart,nSegEnd,nStepCnt,bClockwise);
   #endif
 
+  #if !(DRV_HAS_DRAW_TRI_FILL)
+  if (!bGradient) {
+    // Flat coloring without an optimized triangle fill
+    // - Rasterize runs of segments as a single polygon, formed by the
+    //   outer arc followed by the inner arc in reverse. This avoids
+    //   rasterizing the sides shared between adjacent segments.
+    gslc_tsPt asPoly[GSLC_POLY_VERT_MAX];
+    uint16_t  nNumPt;
+    int16_t   nSegLo = (bClockwise)? nSegStart : nSegEnd;
+    int16_t   nSegHi = (bClockwise)? nSegEnd : nSegStart;
+    int16_t   nChunkMax = GSLC_POLY_VERT_MAX/2 - 1;
+    int16_t   nChunkLo,nChunkHi;
+    for (nChunkLo = nSegLo; nChunkLo < nSegHi; nChunkLo = nChunkHi) {
+      nChunkHi = (nSegHi - nChunkLo > nChunkMax)? nChunkLo + nChunkMax : nSegHi;
+      nNumPt = 0;
+      for (nSegInd = nChunkLo; nSegInd <= nChunkHi; nSegInd++) {
+        gslc_PolarSegToXY(asRing2, nQuality, nRad2, nSegInd, &nX, &nY);
+        asPoly[nNumPt++] = (gslc_tsPt) { nMidX + nX, nMidY + nY };
+      }
+      if (nRad1 == 0) {
+        asPoly[nNumPt++] = (gslc_tsPt) { nMidX, nMidY };
+      } else {
+        for (nSegInd = nChunkHi; nSegInd >= nChunkLo; nSegInd--) {
+          gslc_PolarSegToXY(asRing1, nQuality, nRad1, nSegInd, &nX, &nY);
+          asPoly[nNumPt++] = (gslc_tsPt) { nMidX + nX, nMidY + nY };
+        }
+      }
+      gslc_DrawFillPolygonBase(pGui, asPoly, nNumPt, cArcStart, true);
+    }
+    return;
+  }
+  #endif // !DRV_HAS_DRAW_TRI_FILL
+
   for (int16_t nStepInd = 0; nStepInd < nStepCnt; nStepInd++) {
     // Remap from the step to the segment index, depending on direction
     nSegInd = (bClockwise)? (nSegStart + nStepInd) : (nSegStart - nStepInd - 1);
 
-    nAng64 = (int32_t)(nSegInd * nStep64) % (int32_t)(360 * 64);
-	
     #if defined(DBG_REDRAW)
-    GSLC_DEBUG2_PRINT("FillSector:  StepInd=%d SegInd=%d (%d..%d) Ang64=%d\n", nStepInd, nSegInd, nSegStart, nSegEnd, nAng64);
+    GSLC_DEBUG2_PRINT("FillSector:  StepInd=%d SegInd=%d (%d..%d)\n", nStepInd, nSegInd, nSegStart, nSegEnd);
     #endif
 
-    gslc_PolarToXY(nRad1, nAng64, &nX, &nY);
+    gslc_PolarSegToXY(asRing1, nQuality, nRad1, nSegInd, &nX, &nY);
     anPts[0] = (gslc_tsPt) { nMidX + nX, nMidY + nY };
-    gslc_PolarToXY(nRad2, nAng64, &nX, &nY);
+    gslc_PolarSegToXY(asRing2, nQuality, nRad2, nSegInd, &nX, &nY);
     anPts[1] = (gslc_tsPt) { nMidX + nX, nMidY + nY };
-    gslc_PolarToXY(nRad2, nAng64 + nStep64, &nX, &nY);
+    gslc_PolarSegToXY(asRing2, nQuality, nRad2, nSegInd + 1, &nX, &nY);
     anPts[2] = (gslc_tsPt) { nMidX + nX, nMidY + nY };
-    gslc_PolarToXY(nRad1, nAng64 + nStep64, &nX, &nY);
+    gslc_PolarSegToXY(asRing1, nQuality, nRad1, nSegInd + 1, &nX, &nY);
     anPts[3] = (gslc_tsPt) { nMidX + nX, nMidY + nY };
 
     if (bGradient) {
@@ -1857,14 +3126,57 @@ void gslc_DrawFillGradSector(gslc_tsGui* pGui, int16_t nQuality, int16_t nMidX,
   gslc_tsColor cArcStart, gslc_tsColor cArcEnd, int16_t nAngSecStart, int16_t nAngSecEnd, int16_t nAngGradStart, int16_t nAngGradRange)
 {
   gslc_DrawFillSectorBase(pGui, nQuality, nMidX, nMidY, nRad1, nRad2, cArcStart, cArcEnd, true,
-    nAngGradStart, nAngGradRange, nAngSecStart, nAngSecEnd);
+    nAngGradStart, nAngGradRange, nAngSecStart, nAngSecEnd, NULL);
 }
 
 void gslc_DrawFillSector(gslc_tsGui* pGui, int16_t nQuality, int16_t nMidX, int16_t nMidY, int16_t nRad1, int16_t nRad2,
   gslc_tsColor cArc, int16_t nAngSecStart, int16_t nAngSecEnd)
 {
   gslc_DrawFillSectorBase(pGui, nQuality, nMidX, nMidY, nRad1, nRad2, cArc, cArc, false,
-    0, 0, nAngSecStart, nAngSecEnd);
+    0, 0, nAngSecStart, nAngSecEnd, NULL);
+}
+
+bool gslc_DrawImageMonoOpaque(gslc_tsGui* pGui,int16_t nDstX,int16_t nDstY,gslc_tsImgRef sImgRef,gslc_tsColor colBg)
+{
+  if ((pGui == NULL) || (sImgRef.pImgBuf == NULL)) {
+    static const char GSLC_PMEM FUNCSTR[] = "DrawImageMonoOpaque";
+    GSLC_DEBUG2_PRINT_CONST(ERRSTR_NULL,FUNCSTR);
+    return false;
+  }
+  gslc_teImgRefFlags eSrc = (gslc_teImgRefFlags)(sImgRef.eImgFlags & GSLC_IMGREF_SRC);
+  if (((sImgRef.eImgFlags & GSLC_IMGREF_FMT) != GSLC_IMGREF_FMT_RAW1) ||
+      ((eSrc != GSLC_IMGREF_SRC_RAM) && (eSrc != GSLC_IMGREF_SRC_PROG))) {
+    GSLC_DEBUG2_PRINT("ERROR: DrawImageMonoOpaque() requires a RAW1 image in RAM or PROGMEM\n","");
+    return false;
+  }
+  bool bProgMem = (eSrc == GSLC_IMGREF_SRC_PROG);
+
+#if defined(DRV_HAS_DRAW_MONO_OPAQUE) && (DRV_HAS_DRAW_MONO_OPAQUE)
+  // Call optimized driver implementation
+  gslc_DrvDrawMonoFromMemOpaque(pGui,nDstX,nDstY,sImgRef.pImgBuf,bProgMem,colBg);
+#else
+  // Emulate it by filling the image region before drawing the set bits
+  const unsigned char* pBitmap = sImgRef.pImgBuf;
+  uint16_t nW, nH;
+  #if (GSLC_USE_PROGMEM)
+  if (bProgMem) {
+    nW = ((uint16_t)pgm_read_byte(pBitmap+0) << 8) | pgm_read_byte(pBitmap+1);
+    nH = ((uint16_t)pgm_read_byte(pBitmap+2) << 8) | pgm_read_byte(pBitmap+3);
+  } else
+  #endif
+  {
+    nW = ((uint16_t)pBitmap[0] << 8) | pBitmap[1];
+    nH = ((uint16_t)pBitmap[2] << 8) | pBitmap[3];
+  }
+  (void)bProgMem; // Unused without PROGMEM
+  gslc_DrawFillRect(pGui,(gslc_tsRect){nDstX,nDstY,nW,nH},colBg);
+  if (!gslc_DrvDrawImage(pGui,nDstX,nDstY,sImgRef)) {
+    return false;
+  }
+#endif
+
+  gslc_PageFlipSet(pGui,true);
+  return true;
 }
 
 
@@ -2226,26 +3538,49 @@ bool gslc_PageRedrawGet(gslc_tsGui* pGui)
   return pGui->bScreenNeedRedraw;
 }
 
+uint32_t gslc_PageRedrawPixGet(gslc_tsGui* pGui)
+{
+  if (pGui == NULL) {
+    return 0;
+  }
+
+  return pGui->nRedrawPixCnt;
+}
+
 // Check the redraw flag on all elements on the current page and update
 // the redraw status if additional redraws are required (or the
 // entire page should be marked as requiring redraw).
 // - The typical case for this being required is when an element
-//   requires redraw but it is marked as being transparent. Therefore,
-//   the lower level elements should be redrawn.
-// - For now, just mark the entire page as requiring redraw.
-// TODO: Determine which elements underneath should be redrawn based
-//       on the region exposed by the transparent element.
+//   requires redraw but it is marked as being transparent (or has
+//   been hidden). Therefore, the region underneath the element is
+//   exposed and the background plus any lower level elements
+//   overlapping the region should be redrawn.
+// - The exposed regions are recorded in arExposeRect[] so that the
+//   background can be redrawn with the clipping limited to them.
+// - Elements overlapping an exposed region are marked for full redraw,
+//   including elements above it in the z-order (as they would
+//   otherwise be overwritten). If any of these are also transparent
+//   then their region is exposed as well, so the process repeats
+//   until no further elements are affected.
+// - If an exposed region overlaps a page in the stack that has
+//   redraw disabled, fall back to a full page redraw.
 void gslc_PageRedrawCalc(gslc_tsGui* pGui)
 {
   uint16_t          nInd;
+  uint16_t          nIter, nIterCnt;
+  uint8_t           nExposeInd;
   int               nStackPage;
-  gslc_tsElem*      pElem = NULL;
   gslc_tsElemRef*   pElemRef = NULL;
   gslc_tsCollect*   pCollect = NULL;
+  gslc_tsRect       rElem;
+  uint16_t          nFeatures;
 
   bool  bRedrawFullPage = false;  // Does entire page require redraw?
+  bool  bChanged;
   gslc_tsPage*  pPage = NULL;
 
+  pGui->nExposeRectCnt = 0;
+
   // Work on each enabled page in the stack
   for (nStackPage=0;nStackPage<GSLC_STACK__MAX;nStackPage++) {
     // Select the page collection to process
@@ -2254,31 +3589,38 @@ void gslc_PageRedrawCalc(gslc_tsGui* pGui)
       // If this stack page is not enabled, skip to next stack page
       continue;
     }
-    if (!pGui->abPageStackDoDraw[nStackPage]) {
-      // If this stack page has redraw disabled, skip full-page redraw check
-      continue;
-    }
     pCollect = &pPage->sCollect;
 
-    for (nInd=0;nInd<pCollect->nElemRefCnt;nInd++) {
+    // Only check the elements that have been marked for redraw
+    nIterCnt = gslc_CollectDirtyGetCnt(pCollect);
+    for (nIter=0;nIter<nIterCnt;nIter++) {
+      nInd = gslc_CollectDirtyGetInd(pCollect,nIter);
       pElemRef = &pCollect->asElemRef[nInd];
       gslc_teElemRefFlags eFlags = pElemRef->eElemFlags;
-      pElem = gslc_GetElemFromRef(pGui,pElemRef);
-      //GSLC_DEBUG2_PRINT("PageRedrawCalc: Ind=%u ID=%u redraw=%u flags_old=%u fea=%u\n",nInd,pElem->nId,
-      //        (eFlags & GSLC_ELEMREF_REDRAW_MASK),eFlags,pElem->nFeatures);
+      if (!pGui->abPageStackDoDraw[nStackPage]) {
+        // If this stack page has redraw disabled, skip full-page redraw
+        // check, except for any elements that have just been hidden
+        if ( ((eFlags & GSLC_ELEMREF_REDRAW_MASK) != GSLC_ELEMREF_REDRAW_NONE) &&
+             (!(eFlags & GSLC_ELEMREF_VISIBLE)) ) {
+          bRedrawFullPage = true;
+          break;
+        }
+        continue;
+      }
       if ((eFlags & GSLC_ELEMREF_REDRAW_MASK) != GSLC_ELEMREF_REDRAW_NONE) {
 
         // We found at least one item requiring redraw
 
         // If partial redraw is supported, then we
-        // look out for transparent elements which may
-        // still warrant full page redraw.
+        // look out for transparent or hidden elements which
+        // expose the region underneath them.
         if (pGui->bRedrawPartialEn) {
-          // Is the element transparent?
-          // FIXME: Instead of forcing full page redraw, consider
-          // using clipping region for partial redraw
-          if (!(pElem->nFeatures & GSLC_ELEM_FEA_FILL_EN)) {
-            bRedrawFullPage = true;
+          if (!gslc_GetElemRectFeatFromRef(pGui,pElemRef,&rElem,&nFeatures)) {
+            continue;
+          }
+          if ( (!(nFeatures & GSLC_ELEM_FEA_FILL_EN)) ||
+               (!(eFlags & GSLC_ELEMREF_VISIBLE)) ) {
+            gslc_RectListAdd(pGui->arExposeRect, &(pGui->nExposeRectCnt), GSLC_INVALIDATE_RECT_MAX, rElem);
           }
         } else {
           bRedrawFullPage = true;
@@ -2295,55 +3637,93 @@ void gslc_PageRedrawCalc(gslc_tsGui* pGui)
 
   } // nStackPage
 
+  // Mark any elements that overlap the exposed regions for redraw
+  bChanged = (pGui->nExposeRectCnt > 0);
+  while ((bChanged) && (!bRedrawFullPage)) {
+    bChanged = false;
+    for (nStackPage=0;nStackPage<GSLC_STACK__MAX;nStackPage++) {
+      pPage = pGui->apPageStack[nStackPage];
+      if (!pPage) {
+        continue;
+      }
+      pCollect = &pPage->sCollect;
+
+      for (nInd=0;nInd<pCollect->nElemRefCnt;nInd++) {
+        pElemRef = &pCollect->asElemRef[nInd];
+        gslc_teElemRefFlags eFlags = pElemRef->eElemFlags;
+        if (!(eFlags & GSLC_ELEMREF_VISIBLE)) {
+          continue;
+        }
+        if ((eFlags & GSLC_ELEMREF_REDRAW_MASK) == GSLC_ELEMREF_REDRAW_FULL) {
+          // Already marked (and exposed if transparent)
+          continue;
+        }
+        if (!gslc_GetElemRectFeatFromRef(pGui,pElemRef,&rElem,&nFeatures)) {
+          continue;
+        }
+        bool bTransparent = !(nFeatures & GSLC_ELEM_FEA_FILL_EN);
+
+        for (nExposeInd=0;nExposeInd<pGui->nExposeRectCnt;nExposeInd++) {
+          if (gslc_IsRectOverlap(rElem, pGui->arExposeRect[nExposeInd])) {
+            break;
+          }
+        }
+        if (nExposeInd >= pGui->nExposeRectCnt) {
+          // No overlap with any exposed region
+          continue;
+        }
+
+        if (!pGui->abPageStackDoDraw[nStackPage]) {
+          // The exposed region overlaps a page that has redraw
+          // disabled, so resort to a full page redraw
+          bRedrawFullPage = true;
+          break;
+        }
+
+        gslc_ElemSetRedraw(pGui,pElemRef,GSLC_REDRAW_FULL);
+        if (bTransparent) {
+          gslc_RectListAdd(pGui->arExposeRect, &(pGui->nExposeRectCnt), GSLC_INVALIDATE_RECT_MAX, rElem);
+        }
+        bChanged = true;
+      }
+
+      if (bRedrawFullPage) {
+        break;
+      }
+    } // nStackPage
+  }
+
   if (bRedrawFullPage) {
     // Mark the entire screen as requiring redraw
+    pGui->nExposeRectCnt = 0;
     gslc_PageRedrawSet(pGui,true);
   }
 
 }
 
-// Redraw the active page
-// - If the page has been marked as needing redraw, then all
-//   elements are rendered
-// - If the entire page has not been marked as needing redraw then only
-//   the elements that have been marked as needing redraw
-//   are rendered.
-void gslc_PageRedrawGo(gslc_tsGui* pGui)
+// Prepare a redraw pass and draw the background within it
+void gslc_PageRedrawPass(gslc_tsGui* pGui,gslc_tsRect* pPass,bool bPageRedraw,gslc_tsRect* arExpose,uint8_t nExposeCnt)
 {
-  // Update any page redraw status that may be required
-  // - Note that this routine handles cases where an element
-  //   marked as requiring update is semi-transparent which can
-  //   cause other elements to be redrawn as well.
-  gslc_PageRedrawCalc(pGui);
+  uint8_t nExposeInd;
 
-  // Determine final state of full-screen redraw
-  bool  bPageRedraw = gslc_PageRedrawGet(pGui);
-
-  // Set the clipping based on the current invalidated region
-  if (pGui->bInvalidateEn) {
-    #if defined(DBG_REDRAW)
-    // Note that this will still outline the invalidation region
-    // even if we later discover that the changed element is on
-    // a page in the stack that has been disabled through
-    // abPageStackDoDraw[] = false.
-    GSLC_DEBUG_PRINT("DBG: PageRedrawGo() InvRgn: En=%d (%d,%u)-(%d,%d) PageRedraw=%d\n",
-      pGui->bInvalidateEn, pGui->rInvalidateRect.x, pGui->rInvalidateRect.y,
-      pGui->rInvalidateRect.x + pGui->rInvalidateRect.w - 1,
-      pGui->rInvalidateRect.y + pGui->rInvalidateRect.h - 1, bPageRedraw);
-
-    // Mark the invalidation region
-    gslc_DrvDrawFrameRect(pGui, pGui->rInvalidateRect, GSLC_COL_RED);
-
-    // Slow down rendering
-    delay(1000);
-    #endif // DBG_REDRAW
+  if (pPass) {
+    pGui->bRedrawPassEn = true;
+    pGui->rRedrawPass = *pPass;
+    gslc_SetClipRect(pGui, pPass);
 
-    gslc_SetClipRect(pGui, &(pGui->rInvalidateRect));
+    // Account for the area of the region that lies on the display
+    int16_t nX0 = GSLC_MAX(pPass->x, 0);
+    int16_t nY0 = GSLC_MAX(pPass->y, 0);
+    int16_t nX1 = GSLC_MIN(pPass->x + (int16_t)pPass->w, (int16_t)pGui->nDispW);
+    int16_t nY1 = GSLC_MIN(pPass->y + (int16_t)pPass->h, (int16_t)pGui->nDispH);
+    if ((nX1 > nX0) && (nY1 > nY0)) {
+      pGui->nRedrawPixCnt += (uint32_t)(nX1 - nX0) * (nY1 - nY0);
+    }
   }
   else {
-    // No invalidation region defined, so default the
-    // clipping region to the entire display
+    pGui->bRedrawPassEn = false;
     gslc_SetClipRect(pGui, NULL);
+    pGui->nRedrawPixCnt += (uint32_t)pGui->nDispW * pGui->nDispH;
   }
 
   // If a full page redraw is required, then start by
@@ -2360,6 +3740,61 @@ void gslc_PageRedrawGo(gslc_tsGui* pGui)
   if (bPageRedraw) {
     gslc_DrvDrawBkgnd(pGui);
     gslc_PageFlipSet(pGui,true);
+  } else {
+    // Otherwise only redraw the background within any regions
+    // that have been exposed by transparent or hidden elements.
+    // The elements overlapping these regions have already been
+    // marked for redraw by gslc_PageRedrawCalc().
+    for (nExposeInd = 0; nExposeInd < nExposeCnt; nExposeInd++) {
+      gslc_tsRect rExpose = arExpose[nExposeInd];
+      if ((pPass) && (!gslc_ClipRect(pPass, &rExpose))) {
+        continue;
+      }
+      gslc_SetClipRect(pGui, &rExpose);
+      gslc_DrvDrawBkgnd(pGui);
+      gslc_PageFlipSet(pGui,true);
+      gslc_SetClipRect(pGui, pPass);
+    }
+  }
+}
+
+// Redraw the active page
+// - If the page has been marked as needing redraw, then all
+//   elements are rendered
+// - If the entire page has not been marked as needing redraw then only
+//   the elements that have been marked as needing redraw
+//   are rendered.
+void gslc_PageRedrawGo(gslc_tsGui* pGui)
+{
+  #if (GSLC_FEATURE_UPDATE_BUDGET)
+  // Complete any redraw started by gslc_UpdateBudget()
+  while (gslc_PageRedrawStep(pGui)) { }
+  #endif
+
+  // Update any page redraw status that may be required
+  // - Note that this routine handles cases where an element
+  //   marked as requiring update is semi-transparent which can
+  //   cause other elements to be redrawn as well.
+  gslc_PageRedrawCalc(pGui);
+
+  // Determine final state of full-screen redraw
+  bool  bPageRedraw = gslc_PageRedrawGet(pGui);
+
+  // Take a copy of the current invalidated regions
+  // - Each region is redrawn in a separate pass with the clipping
+  //   set to the region
+  // - A copy is used since drawing an element may invalidate
+  //   additional regions
+  // - If no invalidation region is defined, a single pass is made
+  //   with the clipping set to the entire display
+  gslc_tsRect arPass[GSLC_INVALIDATE_RECT_MAX];
+  uint8_t     nPassCnt = 1;
+  uint8_t     nPass;
+  if (pGui->bInvalidateEn) {
+    nPassCnt = pGui->nInvalidateRectCnt;
+    for (nPass = 0; nPass < nPassCnt; nPass++) {
+      arPass[nPass] = pGui->arInvalidateRect[nPass];
+    }
   }
 
   // Draw other elements (as needed, unless forced page redraw)
@@ -2367,35 +3802,68 @@ void gslc_PageRedrawGo(gslc_tsGui* pGui)
   uint32_t nSubType = (bPageRedraw)?GSLC_EVTSUB_DRAW_FORCE:GSLC_EVTSUB_DRAW_NEEDED;
   void*    pvData = NULL;
 
-  // TODO: Consider creating a flag that indicates whether any elements
-  // on the page have requested redraw. This would enable us to skip
-  // over this exhaustive search every time we call Update()
+  pGui->nRedrawPixCnt = 0;
 
-  // Issue page redraw events to all pages in stack
-  // - Start from bottom page in stack first
-  for (int nStackPage = 0; nStackPage < GSLC_STACK__MAX; nStackPage++) {
-    gslc_tsPage* pStackPage = pGui->apPageStack[nStackPage];
-    if (!pStackPage) {
-      continue;
+  for (nPass = 0; nPass < nPassCnt; nPass++) {
+
+    #if defined(DBG_REDRAW)
+    if (pGui->bInvalidateEn) {
+      // Note that this will still outline the invalidation region
+      // even if we later discover that the changed element is on
+      // a page in the stack that has been disabled through
+      // abPageStackDoDraw[] = false.
+      GSLC_DEBUG_PRINT("DBG: PageRedrawGo() InvRgn: Pass=%u/%u (%d,%d)-(%d,%d) PageRedraw=%d\n",
+        nPass+1, nPassCnt, arPass[nPass].x, arPass[nPass].y,
+        arPass[nPass].x + arPass[nPass].w - 1,
+        arPass[nPass].y + arPass[nPass].h - 1, bPageRedraw);
+
+      // Mark the invalidation region
+      gslc_DrvDrawFrameRect(pGui, arPass[nPass], GSLC_COL_RED);
+
+      // Slow down rendering
+      delay(1000);
     }
-    if (!bPageRedraw && !pGui->abPageStackDoDraw[nStackPage]) {
-      // When doing a full page redraw, proceed as normal
-      // When only doing a parital page redraw, check to see if
-      // the page has been marked as redraw-disabled. If so, skip
-      // updating the elements on the page.
-      //
-      // The redraw-disabled mode is useful to prevent "show-through"
-      // from dynamically-updating elements in lower layers of the
-      // page stack (this may occur with popup dialogs). If the overlay
-      // page does not overlap dynamically-updating elements, then
-      // DoDraw can be set to true, enabling background updates to occur.
-      continue;
+    #endif // DBG_REDRAW
+
+    // Set the clipping based on the current invalidated region
+    // (or the entire display if no invalidation region is defined)
+    // and redraw the background as needed
+    gslc_PageRedrawPass(pGui, (pGui->bInvalidateEn) ? &(arPass[nPass]) : NULL,
+      bPageRedraw, pGui->arExposeRect, pGui->nExposeRectCnt);
+
+    // Issue page redraw events to all pages in stack
+    // - Start from bottom page in stack first
+    for (int nStackPage = 0; nStackPage < GSLC_STACK__MAX; nStackPage++) {
+      gslc_tsPage* pStackPage = pGui->apPageStack[nStackPage];
+      if (!pStackPage) {
+        continue;
+      }
+      if (!bPageRedraw && !pGui->abPageStackDoDraw[nStackPage]) {
+        // When doing a full page redraw, proceed as normal
+        // When only doing a parital page redraw, check to see if
+        // the page has been marked as redraw-disabled. If so, skip
+        // updating the elements on the page.
+        //
+        // The redraw-disabled mode is useful to prevent "show-through"
+        // from dynamically-updating elements in lower layers of the
+        // page stack (this may occur with popup dialogs). If the overlay
+        // page does not overlap dynamically-updating elements, then
+        // DoDraw can be set to true, enabling background updates to occur.
+        continue;
+      }
+      pvData = (void*)(pStackPage);
+      gslc_tsEvent sEvent = gslc_EventCreate(pGui,GSLC_EVT_DRAW,nSubType,pvData,NULL);
+      gslc_PageEvent(pGui,sEvent);
     }
-    pvData = (void*)(pStackPage);
-    gslc_tsEvent sEvent = gslc_EventCreate(pGui,GSLC_EVT_DRAW,nSubType,pvData,NULL);
-    gslc_PageEvent(pGui,sEvent);
-  }
 
+  } // nPass
+
+  pGui->bRedrawPassEn = false;
+  pGui->nExposeRectCnt = 0;
+
+  #if defined(DBG_REDRAW)
+  GSLC_DEBUG_PRINT("DBG: PageRedrawGo() Passes=%u Pixels=%u\n", nPassCnt, (unsigned)pGui->nRedrawPixCnt);
+  #endif
 
   // Clear the page redraw flag
   gslc_PageRedrawSet(pGui,false);
@@ -2416,6 +3884,186 @@ void gslc_PageRedrawGo(gslc_tsGui* pGui)
 
 }
 
+#if (GSLC_FEATURE_UPDATE_BUDGET)
+void gslc_PageRedrawBegin(gslc_tsGui* pGui)
+{
+  uint8_t nInd;
+
+  // Update any page redraw status that may be required
+  gslc_PageRedrawCalc(pGui);
+
+  // Capture the regions to redraw
+  // - The redraw may span several calls to gslc_UpdateBudget(), during
+  //   which the input handlers may modify elements. The live regions
+  //   are reset so that these changes are collected for the next redraw.
+  pGui->bRedrawStepPage = gslc_PageRedrawGet(pGui);
+  pGui->bRedrawStepClip = pGui->bInvalidateEn;
+  pGui->nRedrawStepPassCnt = 1;
+  if (pGui->bInvalidateEn) {
+    pGui->nRedrawStepPassCnt = pGui->nInvalidateRectCnt;
+    for (nInd = 0; nInd < pGui->nInvalidateRectCnt; nInd++) {
+      pGui->arRedrawStepPass[nInd] = pGui->arInvalidateRect[nInd];
+    }
+  }
+  pGui->nRedrawStepExposeCnt = pGui->nExposeRectCnt;
+  for (nInd = 0; nInd < pGui->nExposeRectCnt; nInd++) {
+    pGui->arRedrawStepExpose[nInd] = pGui->arExposeRect[nInd];
+  }
+
+  gslc_PageRedrawSet(pGui,false);
+  gslc_InvalidateRgnReset(pGui);
+  pGui->nExposeRectCnt = 0;
+  pGui->bRedrawNeeded = false;
+
+  pGui->nRedrawPixCnt = 0;
+  pGui->nRedrawStepPass = 0;
+  pGui->nRedrawStepStack = 0;
+  pGui->nRedrawStepElem = 0;
+  pGui->bRedrawStepScan = false;
+  pGui->bRedrawStepBkgnd = true;
+  pGui->bRedrawStepActive = true;
+  pGui->nRedrawStepStartUs = gslc_GetTimeUs();
+}
+
+bool gslc_PageRedrawStep(gslc_tsGui* pGui)
+{
+  if (!pGui->bRedrawStepActive) {
+    return false;
+  }
+
+  // A full page redraw requested since the redraw began
+  // supersedes the remainder of it, so start again, carrying
+  // over the regions that have yet to be redrawn
+  if (gslc_PageRedrawGet(pGui)) {
+    if (pGui->bRedrawStepClip) {
+      uint8_t nPass;
+      for (nPass = pGui->nRedrawStepPass; nPass < pGui->nRedrawStepPassCnt; nPass++) {
+        gslc_InvalidateRgnAdd(pGui, pGui->arRedrawStepPass[nPass]);
+      }
+    } else {
+      gslc_InvalidateRgnReset(pGui);
+    }
+    gslc_PageRedrawBegin(pGui);
+  }
+
+  bool          bPageRedraw = pGui->bRedrawStepPage;
+  gslc_tsRect*  pPass = (pGui->bRedrawStepClip)? &(pGui->arRedrawStepPass[pGui->nRedrawStepPass]) : NULL;
+  uint32_t      nSubType = (bPageRedraw)? GSLC_EVTSUB_DRAW_FORCE : GSLC_EVTSUB_DRAW_NEEDED;
+
+  if (pGui->bRedrawStepBkgnd) {
+    pGui->bRedrawStepBkgnd = false;
+    gslc_PageRedrawPass(pGui, pPass, bPageRedraw, pGui->arRedrawStepExpose, pGui->nRedrawStepExposeCnt);
+    return true;
+  }
+
+  // Restore the pass state, which is released between calls
+  if (pPass) {
+    pGui->bRedrawPassEn = true;
+    pGui->rRedrawPass = *pPass;
+  } else {
+    pGui->bRedrawPassEn = false;
+  }
+  gslc_SetClipRect(pGui, pPass);
+
+  // Locate the next element to draw, in the same order as gslc_PageRedrawGo()
+  while (pGui->nRedrawStepStack < GSLC_STACK__MAX) {
+    gslc_tsPage* pStackPage = pGui->apPageStack[pGui->nRedrawStepStack];
+    if ((!pStackPage) || (!bPageRedraw && !pGui->abPageStackDoDraw[pGui->nRedrawStepStack])) {
+      pGui->nRedrawStepStack++;
+      continue;
+    }
+    gslc_tsCollect* pCollect = &(pStackPage->sCollect);
+
+    // As in gslc_CollectEvent(), only the elements in the dirty list
+    // are visited. A full page redraw, or a dirty list that has
+    // overflowed, visits every element instead, re-adding those that
+    // still require redraw to the dirty list.
+    if (pGui->nRedrawStepElem == 0) {
+      pGui->bRedrawStepScan = bPageRedraw;
+      #if (GSLC_COLLECT_DIRTY_MAX > 0)
+      if (pCollect->bElemRefDirtyAll) {
+        pGui->bRedrawStepScan = true;
+      }
+      if (pGui->bRedrawStepScan) {
+        pCollect->nElemRefDirtyCnt = 0;
+        pCollect->bElemRefDirtyAll = false;
+      }
+      #endif
+    }
+
+    while (pGui->nRedrawStepElem < pCollect->nElemRefCnt) {
+      uint16_t          nInd = pGui->nRedrawStepElem;
+      gslc_tsElemRef*   pElemRef;
+      gslc_tsRect       rElem;
+      uint16_t          nFeatures;
+
+      if (!pGui->bRedrawStepScan) {
+        // Skip ahead to the next element in the dirty list
+        nInd = gslc_CollectDirtyGetNext(pCollect,nInd);
+        if (nInd >= pCollect->nElemRefCnt) {
+          break;
+        }
+      }
+      pGui->nRedrawStepElem = nInd + 1;
+      pElemRef = &(pCollect->asElemRef[nInd]);
+
+      if ((!bPageRedraw) && ((pElemRef->eElemFlags & GSLC_ELEMREF_REDRAW_MASK) == GSLC_ELEMREF_REDRAW_NONE)) {
+        if (!pGui->bRedrawStepScan) {
+          gslc_CollectDirtyRemove(pCollect,nInd);
+        }
+        continue;
+      }
+      // An element within the live invalidation region was changed
+      // after the redraw began, so the background beneath it may not
+      // have been redrawn. Leave it marked for the next redraw.
+      bool bDefer = (!bPageRedraw) &&
+        gslc_GetElemRectFeatFromRef(pGui, pElemRef, &rElem, &nFeatures) &&
+        gslc_InvalidateRgnContains(pGui, rElem);
+      if (!bDefer) {
+        gslc_tsEvent sEvent = gslc_EventCreate(pGui,GSLC_EVT_DRAW,nSubType,(void*)pElemRef,NULL);
+        gslc_ElemEvent(pGui,sEvent);
+      }
+      if ((pElemRef->eElemFlags & GSLC_ELEMREF_REDRAW_MASK) != GSLC_ELEMREF_REDRAW_NONE) {
+        gslc_CollectDirtyAdd(pCollect,nInd);
+      } else if (!pGui->bRedrawStepScan) {
+        gslc_CollectDirtyRemove(pCollect,nInd);
+      }
+      if (!bDefer) {
+        return true;
+      }
+    }
+    pGui->nRedrawStepStack++;
+    pGui->nRedrawStepElem = 0;
+  }
+
+  // Proceed to the next pass
+  pGui->nRedrawStepPass++;
+  if (pGui->nRedrawStepPass < pGui->nRedrawStepPassCnt) {
+    pGui->nRedrawStepStack = 0;
+    pGui->nRedrawStepElem = 0;
+    pGui->bRedrawStepBkgnd = true;
+    return true;
+  }
+
+  gslc_PageRedrawEnd(pGui);
+  return false;
+}
+
+void gslc_PageRedrawEnd(gslc_tsGui* pGui)
+{
+  pGui->bRedrawStepActive = false;
+  pGui->bRedrawPassEn = false;
+
+  // Restore the clipping region to the entire display
+  gslc_SetClipRect(pGui, NULL);
+
+  gslc_PageFlipGo(pGui);
+
+  gslc_LatencyAdd(pGui->sLatencyStats.anFrame,&(pGui->sLatencyStats.nFrameMaxUs),
+    gslc_GetTimeUs()-pGui->nRedrawStepStartUs);
+}
+#endif // GSLC_FEATURE_UPDATE_BUDGET
+
 
 void gslc_PageFlipSet(gslc_tsGui* pGui,bool bNeeded)
 {
@@ -2498,18 +4146,54 @@ gslc_tsElemRef* gslc_PageFindElemById(gslc_tsGui* pGui,int16_t nPageId,int16_t n
   return pElemRef;
 }
 
-/* UNUSED
-void gslc_PageSetEventFunc(gslc_tsGui* pGui,gslc_tsPage* pPage,GSLC_CB_EVENT funcCb)
+#if (GSLC_FEATURE_HIT_GRID)
+bool gslc_PageSetHitGrid(gslc_tsGui* pGui,int16_t nPageId,gslc_tsHitGrid* pHitGrid,
+  uint8_t* pCellBuf,uint16_t nCellBufSize,uint8_t nCols,uint8_t nRows)
 {
-  if ((pPage == NULL) || (funcCb == NULL)) {
-    static const char GSLC_PMEM FUNCSTR[] = "PageSetEventFunc";
+  if ((pGui == NULL) || (pHitGrid == NULL) || (pCellBuf == NULL)) {
+    static const char GSLC_PMEM FUNCSTR[] = "PageSetHitGrid";
     GSLC_DEBUG2_PRINT_CONST(ERRSTR_NULL,FUNCSTR);
-    return;
+    return false;
   }
-  pPage->pfuncXEvent       = funcCb;
-}
-*/
-
+  gslc_tsPage* pPage = gslc_PageFindById(pGui,nPageId);
+  if (pPage == NULL) {
+    GSLC_DEBUG2_PRINT("ERROR: PageSetHitGrid() can't find page (ID=%d)\n",nPageId);
+    return false;
+  }
+  gslc_tsCollect* pCollect = &pPage->sCollect;
+  if ((nCols == 0) || (nRows == 0)) {
+    GSLC_DEBUG2_PRINT("ERROR: PageSetHitGrid() invalid grid size (%ux%u)\n",nCols,nRows);
+    return false;
+  }
+  if (nCellBufSize < GSLC_HITGRID_BUF_SIZE((uint32_t)nCols,nRows,pCollect->nElemRefMax)) {
+    GSLC_DEBUG2_PRINT("ERROR: PageSetHitGrid() buffer too small (%u < %u)\n",nCellBufSize,
+      (unsigned)GSLC_HITGRID_BUF_SIZE((uint32_t)nCols,nRows,pCollect->nElemRefMax));
+    return false;
+  }
+
+  pHitGrid->pCellBuf    = pCellBuf;
+  pHitGrid->nCellBytes  = (pCollect->nElemRefMax + 7) / 8;
+  pHitGrid->nCols       = nCols;
+  pHitGrid->nRows       = nRows;
+  pCollect->pHitGrid    = pHitGrid;
+
+  gslc_CollectHitGridBuild(pGui,pCollect);
+  return true;
+}
+#endif // GSLC_FEATURE_HIT_GRID
+
+/* UNUSED
+void gslc_PageSetEventFunc(gslc_tsGui* pGui,gslc_tsPage* pPage,GSLC_CB_EVENT funcCb)
+{
+  if ((pPage == NULL) || (funcCb == NULL)) {
+    static const char GSLC_PMEM FUNCSTR[] = "PageSetEventFunc";
+    GSLC_DEBUG2_PRINT_CONST(ERRSTR_NULL,FUNCSTR);
+    return;
+  }
+  pPage->pfuncXEvent       = funcCb;
+}
+*/
+
 
 // ------------------------------------------------------------------------
 // Element General Functions
@@ -2575,11 +4259,30 @@ gslc_tsElem* gslc_GetElemFromRef(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef)
   // temporary element instead so that further accesses can
   // be direct.
   if ((eFlags & GSLC_ELEMREF_SRC) == GSLC_ELEMREF_SRC_PROG) {
-    // TODO: Optimize by checking to see if we already cached this element
-    // - Can probably do this by comparing the bValid and nId
     #if (GSLC_USE_PROGMEM)
-    memcpy_P(&pGui->sElemTmpProg,pElem,sizeof(gslc_tsElem));
-    pElem = &pGui->sElemTmpProg;
+    // Look for the element in the cache, otherwise replace
+    // the least-recently used entry
+    // - The cache is keyed by the Flash address since the
+    //   contents at that address never change
+    uint8_t nInd;
+    uint8_t nIndLru = 0;
+    pGui->nElemProgCacheStamp++;
+    for (nInd=0;nInd<GSLC_ELEM_PROG_CACHE_MAX;nInd++) {
+      if (pGui->apElemProgCacheSrc[nInd] == pElem) {
+        pGui->anElemProgCacheUse[nInd] = pGui->nElemProgCacheStamp;
+        pGui->nElemProgCacheHit++;
+        return &pGui->asElemProgCache[nInd];
+      }
+      if ((uint16_t)(pGui->nElemProgCacheStamp - pGui->anElemProgCacheUse[nInd]) >
+          (uint16_t)(pGui->nElemProgCacheStamp - pGui->anElemProgCacheUse[nIndLru])) {
+        nIndLru = nInd;
+      }
+    }
+    memcpy_P(&pGui->asElemProgCache[nIndLru],pElem,sizeof(gslc_tsElem));
+    pGui->apElemProgCacheSrc[nIndLru] = pElem;
+    pGui->anElemProgCacheUse[nIndLru] = pGui->nElemProgCacheStamp;
+    pGui->nElemProgCacheMiss++;
+    pElem = &pGui->asElemProgCache[nIndLru];
     #endif
   } else if ((eFlags & GSLC_ELEMREF_SRC) == GSLC_ELEMREF_SRC_CONST) {
     // We are running on device that may support FLASH storage
@@ -2595,6 +4298,59 @@ gslc_tsElem* gslc_GetElemFromRef(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef)
   return pElem;
 }
 
+bool gslc_GetElemRectFeatFromRef(gslc_tsGui* pGui, gslc_tsElemRef* pElemRef, gslc_tsRect* prElem, uint16_t* pnFeatures)
+{
+  if (!pElemRef) {
+    static const char GSLC_PMEM FUNCSTR[] = "GetElemRectFeatFromRef";
+    GSLC_DEBUG2_PRINT_CONST(ERRSTR_NULL,FUNCSTR);
+    return false;
+  }
+  #if (GSLC_USE_PROGMEM)
+  if ((pElemRef->eElemFlags & GSLC_ELEMREF_SRC) == GSLC_ELEMREF_SRC_PROG) {
+    // Read only the required fields from FLASH
+    const gslc_tsElem* pElemProg = pElemRef->pElem;
+    memcpy_P(prElem,&(pElemProg->rElem),sizeof(gslc_tsRect));
+    memcpy_P(pnFeatures,&(pElemProg->nFeatures),sizeof(uint16_t));
+    return true;
+  }
+  #endif
+  gslc_tsElem* pElem = gslc_GetElemFromRef(pGui,pElemRef);
+  if (!pElem) {
+    return false;
+  }
+  *prElem     = pElem->rElem;
+  *pnFeatures = pElem->nFeatures;
+  return true;
+}
+
+void gslc_ElemProgCacheGetStats(gslc_tsGui* pGui, uint32_t* pnHit, uint32_t* pnMiss)
+{
+  #if (GSLC_USE_PROGMEM)
+  *pnHit  = pGui->nElemProgCacheHit;
+  *pnMiss = pGui->nElemProgCacheMiss;
+  #else
+  (void)pGui; // Unused
+  *pnHit  = 0;
+  *pnMiss = 0;
+  #endif
+}
+
+void gslc_ElemProgCacheReset(gslc_tsGui* pGui)
+{
+  #if (GSLC_USE_PROGMEM)
+  uint8_t nInd;
+  for (nInd=0;nInd<GSLC_ELEM_PROG_CACHE_MAX;nInd++) {
+    pGui->apElemProgCacheSrc[nInd] = NULL;
+    pGui->anElemProgCacheUse[nInd] = 0;
+  }
+  pGui->nElemProgCacheStamp = 0;
+  pGui->nElemProgCacheHit   = 0;
+  pGui->nElemProgCacheMiss  = 0;
+  #else
+  (void)pGui; // Unused
+  #endif
+}
+
 // Fetch element from reference, with debug
 gslc_tsElem* gslc_GetElemFromRefD(gslc_tsGui* pGui, gslc_tsElemRef* pElemRef, int16_t nLineNum)
 {
@@ -2886,6 +4642,14 @@ bool gslc_ElemEvent(void* pvGui,gslc_tsEvent sEvent)
       pElemRef = (gslc_tsElemRef*)(pvScope);
       pElem = gslc_GetElemFromRefD(pGui, pElemRef, __LINE__);
 
+      // When the invalidated regions are redrawn in separate passes,
+      // skip any element that lies outside of the current pass region
+      if ((pGui->bRedrawPassEn) && (pElem)) {
+        if (!gslc_IsRectOverlap(pElem->rElem, pGui->rRedrawPass)) {
+          return true;
+        }
+      }
+
       // Determine if redraw is needed
       gslc_teRedrawType eRedraw = gslc_ElemGetRedraw(pGui,pElemRef);
 
@@ -2893,16 +4657,26 @@ bool gslc_ElemEvent(void* pvGui,gslc_tsEvent sEvent)
         // Despite the current pending redraw state of the element,
         // we will force a full redraw as requested.
         //GSLC_DEBUG_PRINT("DBG: ElemEvent(Draw) nId=%d eRedraw=%d: force to FULL\n",pElem->nId,eRedraw);
-        return gslc_ElemDrawByRef(pGui,pElemRef,GSLC_REDRAW_FULL);
+        eRedraw = GSLC_REDRAW_FULL;
       } else if (eRedraw != GSLC_REDRAW_NONE) {
         // There is a pending redraw for the element. It may
         // either be an incremental or full redraw.
         //GSLC_DEBUG_PRINT("DBG: ElemEvent(Draw) nId=%d eRedraw=%d\n",pElem->nId,eRedraw);
-        return gslc_ElemDrawByRef(pGui,pElemRef,eRedraw);
       } else {
         // No redraw needed pending
         return true;
       }
+      #if (GSLC_FEATURE_DRV_STATS)
+      {
+        // Attribute the driver calls to the element being drawn
+        gslc_DrvStatsSetScope(pGui,(pElem)? pElem->nId : GSLC_ID_NONE,eRedraw);
+        bool bOk = gslc_ElemDrawByRef(pGui,pElemRef,eRedraw);
+        gslc_DrvStatsSetScope(pGui,GSLC_ID_NONE,GSLC_REDRAW_NONE);
+        return bOk;
+      }
+      #else
+      return gslc_ElemDrawByRef(pGui,pElemRef,eRedraw);
+      #endif
       break;
 
     case GSLC_EVT_TOUCH:
@@ -2988,6 +4762,13 @@ void gslc_ElemDraw(gslc_tsGui* pGui,int16_t nPageId,int16_t nElemId)
 void gslc_DrawTxtBase(gslc_tsGui* pGui, char* pStrBuf,gslc_tsRect rTxt,gslc_tsFont* pTxtFont,gslc_teTxtFlags eTxtFlags,
   int8_t eTxtAlign,gslc_tsColor colTxt,gslc_tsColor colBg,int16_t nMarginW,int16_t nMarginH)
 {
+  gslc_DrawTxtBaseCache(pGui,pStrBuf,rTxt,pTxtFont,eTxtFlags,eTxtAlign,colTxt,colBg,nMarginW,nMarginH,NULL);
+}
+
+bool gslc_DrawTxtCalcOrigin(gslc_tsGui* pGui, char* pStrBuf,gslc_tsRect rTxt,gslc_tsFont* pTxtFont,gslc_teTxtFlags eTxtFlags,
+  int8_t eTxtAlign,int16_t nMarginW,int16_t nMarginH,gslc_tsTxtExtCache* pTxtExtCache,int16_t* pnTxtX,int16_t* pnTxtY)
+{
+#if (DRV_HAS_DRAW_TEXT) && !(DRV_OVERRIDE_TXT_ALIGN)
   int16_t   nElemX,nElemY;
   uint16_t  nElemW,nElemH;
 
@@ -2996,6 +4777,103 @@ void gslc_DrawTxtBase(gslc_tsGui* pGui, char* pStrBuf,gslc_tsRect rTxt,gslc_tsFo
   nElemW    = rTxt.w;
   nElemH    = rTxt.h;
 
+  // Fetch the size of the text to allow for justification
+  // NOTE: For multi-line text strings, the following call will
+  //       return the maximum dimensions of the entire block of
+  //       text, thus alignment will be based on the outer dimensions
+  //       not individual rows of text. As a result, the overall
+  //       text block will be rendered with the requested alignment
+  //       but individual rows will render like GSLC_ALIGNH_LEFT
+  //       within the aligned text block. In order to support per-line
+  //       horizontal justification, a pre-scan and alignment calculation
+  //       for each text row would need to be performed.
+  int16_t       nTxtOffsetX=0;
+  int16_t       nTxtOffsetY=0;
+  uint16_t      nTxtSzW=0;
+  uint16_t      nTxtSzH=0;
+
+  // Reuse the previous measurement if the text, font and
+  // flags are unchanged since it was taken
+  // - Only the flags that affect the rendered text are compared
+  uint8_t       eTxtFlagsKey = eTxtFlags & (GSLC_TXT_MEM | GSLC_TXT_ENC);
+  uint8_t       eFontModeKey = (pTxtFont) ? (uint8_t)(pTxtFont->eFontRefMode) : 0;
+  const void*   pvFontKey    = (pTxtFont) ? pTxtFont->pvFont : NULL;
+  uint16_t      nFontSizeKey = (pTxtFont) ? pTxtFont->nSize : 0;
+  uint32_t      nHash = 0;
+  bool          bCached = false;
+  if (pTxtExtCache) {
+    nHash = gslc_StrHash(pStrBuf,eTxtFlags);
+    if ((pTxtExtCache->bValid) && (pTxtExtCache->pFont == pTxtFont) &&
+        (pTxtExtCache->pvFont == pvFontKey) && (pTxtExtCache->nFontSize == nFontSizeKey) &&
+        (pTxtExtCache->eFontRefMode == eFontModeKey) &&
+        (pTxtExtCache->eTxtFlags == eTxtFlagsKey) && (pTxtExtCache->nHash == nHash)) {
+      nTxtOffsetX = pTxtExtCache->nTxtOffsetX;
+      nTxtOffsetY = pTxtExtCache->nTxtOffsetY;
+      nTxtSzW     = pTxtExtCache->nTxtSzW;
+      nTxtSzH     = pTxtExtCache->nTxtSzH;
+      bCached = true;
+    }
+  }
+  if (!bCached) {
+    gslc_DrvGetTxtSize(pGui,pTxtFont,pStrBuf,eTxtFlags,&nTxtOffsetX,&nTxtOffsetY,&nTxtSzW,&nTxtSzH);
+    if (pTxtExtCache) {
+      pTxtExtCache->bValid       = true;
+      pTxtExtCache->pFont        = pTxtFont;
+      pTxtExtCache->pvFont       = pvFontKey;
+      pTxtExtCache->nFontSize    = nFontSizeKey;
+      pTxtExtCache->eFontRefMode = eFontModeKey;
+      pTxtExtCache->eTxtFlags    = eTxtFlagsKey;
+      pTxtExtCache->nHash        = nHash;
+      pTxtExtCache->nTxtOffsetX  = nTxtOffsetX;
+      pTxtExtCache->nTxtOffsetY  = nTxtOffsetY;
+      pTxtExtCache->nTxtSzW      = nTxtSzW;
+      pTxtExtCache->nTxtSzH      = nTxtSzH;
+    }
+  }
+
+  // Calculate the text alignment
+  int16_t       nTxtX,nTxtY;
+
+  // Check for ALIGNH_LEFT & ALIGNH_RIGHT. Default to ALIGNH_MID
+  if      (eTxtAlign & GSLC_ALIGNH_LEFT)     { nTxtX = nElemX+nMarginW; }
+  else if (eTxtAlign & GSLC_ALIGNH_RIGHT)    { nTxtX = nElemX+nElemW-nMarginW-nTxtSzW; }
+  else                                       { nTxtX = nElemX+(nElemW/2)-(nTxtSzW/2); }
+
+  // Check for ALIGNV_TOP & ALIGNV_BOT. Default to ALIGNV_MID
+  if      (eTxtAlign & GSLC_ALIGNV_TOP)      { nTxtY = nElemY+nMarginH; }
+  else if (eTxtAlign & GSLC_ALIGNV_BOT)      { nTxtY = nElemY+nElemH-nMarginH-nTxtSzH; }
+  else                                       { nTxtY = nElemY+(nElemH/2)-(nTxtSzH/2); }
+
+  // Now correct for offset from text bounds
+  // - This is used by the driver (such as Adafruit-GFX) to provide an
+  //   adjustment for baseline height, etc.
+  nTxtX -= nTxtOffsetX;
+  nTxtY -= nTxtOffsetY;
+
+  *pnTxtX = nTxtX;
+  *pnTxtY = nTxtY;
+  return true;
+#else
+  // The driver performs the text alignment (or has no text support)
+  (void)pGui; // Unused
+  (void)pStrBuf; // Unused
+  (void)rTxt; // Unused
+  (void)pTxtFont; // Unused
+  (void)eTxtFlags; // Unused
+  (void)eTxtAlign; // Unused
+  (void)nMarginW; // Unused
+  (void)nMarginH; // Unused
+  (void)pTxtExtCache; // Unused
+  (void)pnTxtX; // Unused
+  (void)pnTxtY; // Unused
+  return false;
+#endif
+}
+
+void gslc_DrawTxtBaseCache(gslc_tsGui* pGui, char* pStrBuf,gslc_tsRect rTxt,gslc_tsFont* pTxtFont,gslc_teTxtFlags eTxtFlags,
+  int8_t eTxtAlign,gslc_tsColor colTxt,gslc_tsColor colBg,int16_t nMarginW,int16_t nMarginH,
+  gslc_tsTxtExtCache* pTxtExtCache)
+{
   // Overlay the text
   bool bRenderTxt = true;
   // Skip text render if buffer pointer not allocated
@@ -3021,11 +4899,12 @@ void gslc_DrawTxtBase(gslc_tsGui* pGui, char* pStrBuf,gslc_tsRect rTxt,gslc_tsFo
     // calculations.
 
     // Provide bounding box and alignment flag to driver to calculate
-    int16_t nX0 = nElemX + nMarginW;
-    int16_t nY0 = nElemY + nMarginH;
-    int16_t nX1 = nX0 + nElemW - 2*nMarginW;
-    int16_t nY1 = nY0 + nElemH - 2*nMarginH;
+    int16_t nX0 = rTxt.x + nMarginW;
+    int16_t nY0 = rTxt.y + nMarginH;
+    int16_t nX1 = nX0 + rTxt.w - 2*nMarginW;
+    int16_t nY1 = nY0 + rTxt.h - 2*nMarginH;
 
+    (void)pTxtExtCache; // Unused as driver measures the text
     gslc_DrvDrawTxtAlign(pGui,nX0,nY0,nX1,nY1,eTxtAlign,pTxtFont,
             pStrBuf,eTxtFlags,colTxt,colBg);
 
@@ -3034,41 +4913,9 @@ void gslc_DrawTxtBase(gslc_tsGui* pGui, char* pStrBuf,gslc_tsRect rTxt,gslc_tsFo
     // GUIslice will ask the driver for the text dimensions and calculate
     // the appropriate positioning to support the requested text
     // alignment mode.
-
-    // Fetch the size of the text to allow for justification
-    // NOTE: For multi-line text strings, the following call will
-    //       return the maximum dimensions of the entire block of
-    //       text, thus alignment will be based on the outer dimensions
-    //       not individual rows of text. As a result, the overall
-    //       text block will be rendered with the requested alignment
-    //       but individual rows will render like GSLC_ALIGNH_LEFT
-    //       within the aligned text block. In order to support per-line
-    //       horizontal justification, a pre-scan and alignment calculation
-    //       for each text row would need to be performed.
-    int16_t       nTxtOffsetX=0;
-    int16_t       nTxtOffsetY=0;
-    uint16_t      nTxtSzW=0;
-    uint16_t      nTxtSzH=0;
-    gslc_DrvGetTxtSize(pGui,pTxtFont,pStrBuf,eTxtFlags,&nTxtOffsetX,&nTxtOffsetY,&nTxtSzW,&nTxtSzH);
-
-    // Calculate the text alignment
     int16_t       nTxtX,nTxtY;
-
-    // Check for ALIGNH_LEFT & ALIGNH_RIGHT. Default to ALIGNH_MID
-    if      (eTxtAlign & GSLC_ALIGNH_LEFT)     { nTxtX = nElemX+nMarginW; }
-    else if (eTxtAlign & GSLC_ALIGNH_RIGHT)    { nTxtX = nElemX+nElemW-nMarginW-nTxtSzW; }
-    else                                       { nTxtX = nElemX+(nElemW/2)-(nTxtSzW/2); }
-
-    // Check for ALIGNV_TOP & ALIGNV_BOT. Default to ALIGNV_MID
-    if      (eTxtAlign & GSLC_ALIGNV_TOP)      { nTxtY = nElemY+nMarginH; }
-    else if (eTxtAlign & GSLC_ALIGNV_BOT)      { nTxtY = nElemY+nElemH-nMarginH-nTxtSzH; }
-    else                                       { nTxtY = nElemY+(nElemH/2)-(nTxtSzH/2); }
-
-    // Now correct for offset from text bounds
-    // - This is used by the driver (such as Adafruit-GFX) to provide an
-    //   adjustment for baseline height, etc.
-    nTxtX -= nTxtOffsetX;
-    nTxtY -= nTxtOffsetY;
+    gslc_DrawTxtCalcOrigin(pGui,pStrBuf,rTxt,pTxtFont,eTxtFlags,eTxtAlign,nMarginW,nMarginH,
+      pTxtExtCache,&nTxtX,&nTxtY);
 
     // Call the driver text rendering routine
     gslc_DrvDrawTxt(pGui,nTxtX,nTxtY,pTxtFont,pStrBuf,eTxtFlags,colTxt,colBg);
@@ -3077,6 +4924,7 @@ void gslc_DrawTxtBase(gslc_tsGui* pGui, char* pStrBuf,gslc_tsRect rTxt,gslc_tsFo
 
 #else // DRV_HAS_DRAW_TEXT
     // No text support in driver, so skip
+    (void)pTxtExtCache; // Unused
 #endif // DRV_HAS_DRAW_TEXT
   }
 }
@@ -3169,6 +5017,21 @@ bool gslc_ElemDrawByRef(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_teRedrawT
     return true;
   }
 
+  #if (GSLC_FEATURE_TXT_INCR)
+  // --------------------------------------------------------------------------
+  // Incremental text update
+  // --------------------------------------------------------------------------
+
+  // If the element tracks its displayed text, an incremental redraw
+  // only needs to repaint the characters that have changed
+  if ((eRedraw == GSLC_REDRAW_INC) && (pElem->pTxtIncr)) {
+    if (gslc_ElemDrawTxtIncr(pGui,pElemRef,&sState)) {
+      gslc_ElemSetRedraw(pGui,pElemRef,GSLC_REDRAW_NONE);
+      return true;
+    }
+  }
+  #endif // GSLC_FEATURE_TXT_INCR
+
 
   // --------------------------------------------------------------------------
   // Background
@@ -3241,9 +5104,23 @@ bool gslc_ElemDrawByRef(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_teRedrawT
 
     // Note that we use the "inner" region for text placement to
     // avoid overlapping any frame
-    gslc_DrawTxtBase(pGui, pElem->pStrBuf, sState.rInner, pElem->pTxtFont, pElem->eTxtFlags,
-      pElem->eTxtAlign, sState.colTxtFore, sState.colTxtBack, nMarginX, nMarginY);
+    // The text extent is only retained for elements in RAM
+    gslc_tsTxtExtCache* pTxtExtCache = NULL;
+    #if (GSLC_FEATURE_TXT_EXT_CACHE)
+    if ((pElemRef->eElemFlags & GSLC_ELEMREF_SRC) == GSLC_ELEMREF_SRC_RAM) {
+      pTxtExtCache = &pElem->sTxtExtCache;
+    }
+    #endif
+    gslc_DrawTxtBaseCache(pGui, pElem->pStrBuf, sState.rInner, pElem->pTxtFont, pElem->eTxtFlags,
+      pElem->eTxtAlign, sState.colTxtFore, sState.colTxtBack, nMarginX, nMarginY, pTxtExtCache);
+  }
+
+  #if (GSLC_FEATURE_TXT_INCR)
+  // Capture the displayed text for subsequent incremental updates
+  if (pElem->pTxtIncr) {
+    gslc_ElemTxtIncrSave(pGui,pElemRef,&sState);
   }
+  #endif // GSLC_FEATURE_TXT_INCR
 
   // --------------------------------------------------------------------------
 
@@ -3356,6 +5233,19 @@ int gslc_ElemGetGroup(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef)
   return pElem->nGroup;
 }
 
+#if (GSLC_FEATURE_HIT_GRID)
+// Refresh the hit-test grid entry of an element if it
+// belongs to a page with a grid
+void gslc_ElemHitGridUpdate(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef)
+{
+  uint16_t nElemRefInd;
+  gslc_tsCollect* pCollect = gslc_PageFindCollectFromElemRef(pGui,pElemRef,&nElemRefInd);
+  if ((pCollect) && (pCollect->pHitGrid)) {
+    gslc_CollectHitGridUpdate(pGui,pCollect,nElemRefInd);
+  }
+}
+#endif // GSLC_FEATURE_HIT_GRID
+
 void gslc_ElemSetRect(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_tsRect rElem)
 {
   gslc_tsElem* pElem = gslc_GetElemFromRefD(pGui, pElemRef, __LINE__);
@@ -3372,6 +5262,10 @@ void gslc_ElemSetRect(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_tsRect rEle
   pElem->rElem           = rElem;
 
   gslc_ElemSetRedraw(pGui,pElemRef,GSLC_REDRAW_FULL);
+
+  #if (GSLC_FEATURE_HIT_GRID)
+  gslc_ElemHitGridUpdate(pGui,pElemRef);
+  #endif
 }
 
 gslc_tsRect gslc_ElemGetRect(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef)
@@ -3412,6 +5306,32 @@ void gslc_ElemSetTxtMarginXY(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,int8_t nM
   gslc_ElemSetRedraw(pGui,pElemRef,GSLC_REDRAW_FULL);
 }
 
+// Calculate a hash (FNV-1a) of a string
+uint32_t gslc_StrHash(const char* pStr,gslc_teTxtFlags eTxtFlags)
+{
+  uint32_t  nHash = 2166136261UL;
+  bool      bProg = ((eTxtFlags & GSLC_TXT_MEM) == GSLC_TXT_MEM_PROG);
+  uint8_t   nCh;
+  if (pStr == NULL) {
+    return nHash;
+  }
+  (void)bProg; // Unused if PROGMEM is not supported
+  while (1) {
+    #if (GSLC_USE_PROGMEM)
+    nCh = (bProg) ? pgm_read_byte(pStr) : (uint8_t)(*pStr);
+    #else
+    nCh = (uint8_t)(*pStr);
+    #endif
+    if (nCh == 0) {
+      break;
+    }
+    nHash ^= nCh;
+    nHash *= 16777619UL;
+    pStr++;
+  }
+  return nHash;
+}
+
 // Perform a deep copy with termination
 void gslc_StrCopy(char* pDstStr,const char* pSrcStr,uint16_t nDstLen)
 {
@@ -3446,6 +5366,7 @@ void gslc_ElemSetTxtStr(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,const char* pS
 
   if (strncmp(pElem->pStrBuf,pStr,pElem->nStrBufMax)) {
     gslc_StrCopy(pElem->pStrBuf,pStr,pElem->nStrBufMax);
+    gslc_ElemTxtExtInvalidate(pElem);
     gslc_ElemSetRedraw(pGui,pElemRef,GSLC_REDRAW_INC);
   }
 }
@@ -3457,6 +5378,28 @@ char* gslc_ElemGetTxtStr(gslc_tsGui* pGui, gslc_tsElemRef* pElemRef)
   return pElem->pStrBuf;
 }
 
+#if (GSLC_FEATURE_TXT_INCR)
+bool gslc_ElemSetTxtIncr(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_tsTxtIncr* pTxtIncr)
+{
+  gslc_tsElem* pElem = gslc_GetElemFromRefD(pGui, pElemRef, __LINE__);
+  if (!pElem) return false;
+
+  // The state pointer is stored in the element, so it must be writable
+  if ((pElemRef->eElemFlags & GSLC_ELEMREF_SRC) != GSLC_ELEMREF_SRC_RAM) {
+    GSLC_DEBUG2_PRINT("ERROR: ElemSetTxtIncr() requires element in RAM\n","");
+    return false;
+  }
+  if (pTxtIncr) {
+    pTxtIncr->bValid = false;
+  }
+  pElem->pTxtIncr = pTxtIncr;
+
+  // The state is captured by the next full redraw
+  gslc_ElemSetRedraw(pGui,pElemRef,GSLC_REDRAW_FULL);
+  return true;
+}
+#endif // GSLC_FEATURE_TXT_INCR
+
 void gslc_ElemSetTxtCol(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_tsColor colVal)
 {
   gslc_tsElem* pElem = gslc_GetElemFromRefD(pGui, pElemRef, __LINE__);
@@ -3487,6 +5430,7 @@ void gslc_ElemSetTxtMem(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_teTxtFlag
   }
   gslc_teTxtFlags eFlagsCur = pElem->eTxtFlags;
   pElem->eTxtFlags = (eFlagsCur & ~GSLC_TXT_MEM) | (eFlags & GSLC_TXT_MEM);
+  gslc_ElemTxtExtInvalidate(pElem);
 }
 
 void gslc_ElemSetTxtEnc(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_teTxtFlags eFlags)
@@ -3496,6 +5440,7 @@ void gslc_ElemSetTxtEnc(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_teTxtFlag
 
   gslc_teTxtFlags eFlagsCur = pElem->eTxtFlags;
   pElem->eTxtFlags = (eFlagsCur & ~GSLC_TXT_ENC) | (eFlags & GSLC_TXT_ENC);
+  gslc_ElemTxtExtInvalidate(pElem);
 }
 
 void gslc_ElemUpdateFont(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,int nFontId)
@@ -3504,6 +5449,7 @@ void gslc_ElemUpdateFont(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,int nFontId)
   if (!pElem) return;
 
   pElem->pTxtFont = gslc_FontGet(pGui,nFontId);
+  gslc_ElemTxtExtInvalidate(pElem);
   gslc_ElemSetRedraw(pGui,pElemRef,GSLC_REDRAW_FULL);
 }
 
@@ -3567,6 +5513,18 @@ void gslc_ElemSetRedraw(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_teRedrawT
     if (gslc_ElemGetOnScreen(pGui,pElemRef)) {
       gslc_InvalidateRgnAdd(pGui, pElem->rElem);
     }
+
+    #if (GSLC_COLLECT_DIRTY_MAX > 0)
+    // Record the element in the dirty list of the page collection
+    // that contains it
+    // - Elements in other collections (eg. within compound elements)
+    //   are not tracked as their parent is marked instead
+    uint16_t nElemRefInd;
+    gslc_tsCollect* pCollect = gslc_PageFindCollectFromElemRef(pGui,pElemRef,&nElemRefInd);
+    if (pCollect) {
+      gslc_CollectDirtyAdd(pCollect,nElemRefInd);
+    }
+    #endif // GSLC_COLLECT_DIRTY_MAX
   }
 
   // Update the redraw state
@@ -3760,10 +5718,13 @@ void gslc_ElemSetVisible(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,bool bVisible
       // Since we are hiding an element, we need to invalidate
       // the region underneath the element, so that it can
       // be redrawn.
+      // - gslc_PageRedrawCalc() detects the hidden element and
+      //   redraws the background and any overlapping elements
       gslc_InvalidateRgnAdd(pGui, pElem->rElem);
-      // Mark the page as having a redraw pending
-      gslc_PageRedrawSet(pGui,true);
      }
+    #if (GSLC_FEATURE_HIT_GRID)
+    gslc_ElemHitGridUpdate(pGui,pElemRef);
+    #endif
   }
 
 }
@@ -3876,6 +5837,10 @@ void gslc_ElemSetClickEn(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,bool bClickEn
     pElem->nFeatures &= ~GSLC_ELEM_FEA_CLICK_EN;
   }
 
+  #if (GSLC_FEATURE_HIT_GRID)
+  gslc_ElemHitGridUpdate(pGui,pElemRef);
+  #endif
+
   #if (GSLC_FEATURE_INPUT)
   // For now, associate accepting click events as also accepting focus
   // We call this API since it also takes care of resizing 
@@ -4125,13 +6090,16 @@ bool gslc_ElemOwnsCoord(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,int16_t nX,int
   // If no element was provided, return gracefully
   if (!pElemRef) return false;
 
-  gslc_tsElem* pElem = gslc_GetElemFromRefD(pGui, pElemRef, __LINE__);
-  if (!pElem) return false;
+  // Only the rect and features are needed, so avoid
+  // fetching the entire element
+  gslc_tsRect rElem;
+  uint16_t    nFeatures;
+  if (!gslc_GetElemRectFeatFromRef(pGui, pElemRef, &rElem, &nFeatures)) return false;
 
-  if (bOnlyClickEn && !(pElem->nFeatures & GSLC_ELEM_FEA_CLICK_EN) ) {
+  if (bOnlyClickEn && !(nFeatures & GSLC_ELEM_FEA_CLICK_EN) ) {
     return false;
   }
-  return gslc_IsInRect(nX,nY,pElem->rElem);
+  return gslc_IsInRect(nX,nY,rElem);
 }
 
 #if !defined(DRV_TOUCH_NONE)
@@ -4965,10 +6933,9 @@ void gslc_TrackTouch(gslc_tsGui* pGui,gslc_tsPage* pPage,int16_t nX,int16_t nY,u
 
   // Determine the transitions in the touch events based
   // on the previous touch pressure state
-  // TODO: Provide hysteresis thresholds for the touch
-  //       pressure levels in case a display outputs a
-  //       variable range (eg. 15..200) that doesn't
-  //       go to zero when touch is removed.
+  // - Displays that output a variable pressure range (eg. 15..200)
+  //   that doesn't go to zero when touch is removed can be handled
+  //   by the hysteresis in the touch filter (see gslc_SetTouchFilterPress)
   gslc_teTouch  eTouch = GSLC_TOUCH_NONE;
   if ((pGui->nTouchLastPress == 0) && (nPress > 0)) {
     eTouch = GSLC_TOUCH_DOWN;
@@ -5145,6 +7112,183 @@ void gslc_SetTouchRemapYX(gslc_tsGui* pGui, bool bSwap)
   }
   pGui->bTouchRemapYX = bSwap;
 }
+
+#if (GSLC_FEATURE_TOUCH_FILTER)
+void gslc_SetTouchFilterPos(gslc_tsGui* pGui,uint8_t nMedianLen,uint8_t nSmoothShift,uint8_t nMoveMin)
+{
+  if (pGui == NULL) {
+    static const char GSLC_PMEM FUNCSTR[] = "SetTouchFilterPos";
+    GSLC_DEBUG2_PRINT_CONST(ERRSTR_NULL, FUNCSTR);
+    return;
+  }
+  if ((nMedianLen == 0) || (nMedianLen > GSLC_TOUCH_FILTER_MEDIAN_MAX)) {
+    GSLC_DEBUG2_PRINT("ERROR: SetTouchFilterPos() median length %u exceeds GSLC_TOUCH_FILTER_MEDIAN_MAX\n",nMedianLen);
+    nMedianLen = (nMedianLen == 0)? 1 : GSLC_TOUCH_FILTER_MEDIAN_MAX;
+  }
+  gslc_tsTouchFilter* pFilter = &(pGui->sTouchFilter);
+  pFilter->nMedianLen   = nMedianLen;
+  pFilter->nSmoothShift = nSmoothShift;
+  pFilter->nMoveMin     = nMoveMin;
+  gslc_TouchFilterReset(pGui);
+}
+
+void gslc_SetTouchFilterPress(gslc_tsGui* pGui,uint16_t nPressOn,uint16_t nPressOff,uint16_t nDebounceMs)
+{
+  if (pGui == NULL) {
+    static const char GSLC_PMEM FUNCSTR[] = "SetTouchFilterPress";
+    GSLC_DEBUG2_PRINT_CONST(ERRSTR_NULL, FUNCSTR);
+    return;
+  }
+  if ((nPressOn == 0) || (nPressOff >= nPressOn)) {
+    GSLC_DEBUG2_PRINT("ERROR: SetTouchFilterPress() requires 0 <= PressOff < PressOn\n","");
+    return;
+  }
+  gslc_tsTouchFilter* pFilter = &(pGui->sTouchFilter);
+  pFilter->nPressOn     = nPressOn;
+  pFilter->nPressOff    = nPressOff;
+  pFilter->nDebounceMs  = nDebounceMs;
+  gslc_TouchFilterReset(pGui);
+}
+
+void gslc_TouchFilterReset(gslc_tsGui* pGui)
+{
+  gslc_tsTouchFilter* pFilter = &(pGui->sTouchFilter);
+  pFilter->nMedCnt    = 0;
+  pFilter->nMedInd    = 0;
+  pFilter->nSmoothX   = 0;
+  pFilter->nSmoothY   = 0;
+  pFilter->bPressed   = false;
+  pFilter->nOutX      = 0;
+  pFilter->nOutY      = 0;
+  pFilter->bPend      = false;
+  pFilter->nPendMs    = 0;
+  pFilter->nPendX     = 0;
+  pFilter->nPendY     = 0;
+  pFilter->nPendPress = 0;
+}
+
+int16_t gslc_TouchFilterMedian(int16_t* anVal,uint8_t nCnt)
+{
+  int16_t anSort[GSLC_TOUCH_FILTER_MEDIAN_MAX];
+  uint8_t nInd, nIndB;
+  // Insertion sort of the (few) samples
+  for (nInd = 0; nInd < nCnt; nInd++) {
+    int16_t nVal = anVal[nInd];
+    for (nIndB = nInd; (nIndB > 0) && (anSort[nIndB-1] > nVal); nIndB--) {
+      anSort[nIndB] = anSort[nIndB-1];
+    }
+    anSort[nIndB] = nVal;
+  }
+  return anSort[nCnt/2];
+}
+
+bool gslc_TouchFilter(gslc_tsGui* pGui,bool bSample,int16_t* pnX,int16_t* pnY,uint16_t* pnPress)
+{
+  gslc_tsTouchFilter* pFilter = &(pGui->sTouchFilter);
+  bool                bDown;
+
+  if (bSample) {
+    // Determine the touch state with hysteresis on the pressure
+    if (pFilter->bPressed) {
+      bDown = (*pnPress > pFilter->nPressOff);
+    } else {
+      bDown = (*pnPress >= pFilter->nPressOn);
+    }
+  } else {
+    // No new sample, so only a pending transition can complete
+    if (!pFilter->bPend) {
+      return false;
+    }
+    bDown = !pFilter->bPressed;
+  }
+
+  if (bDown != pFilter->bPressed) {
+    // Debounce the transition
+    if (!pFilter->bPend) {
+      pFilter->bPend = true;
+      pFilter->nPendMs = gslc_GetTimeMs();
+    }
+    if (bSample && bDown) {
+      // Start the touch from the latest sample once accepted
+      pFilter->nPendX     = *pnX;
+      pFilter->nPendY     = *pnY;
+      pFilter->nPendPress = *pnPress;
+    }
+    if ((gslc_GetTimeMs() - pFilter->nPendMs) < pFilter->nDebounceMs) {
+      return false;
+    }
+    pFilter->bPend = false;
+    pFilter->bPressed = bDown;
+
+    if (!bDown) {
+      // Report the release at the last reported position
+      *pnX     = pFilter->nOutX;
+      *pnY     = pFilter->nOutY;
+      *pnPress = 0;
+      return true;
+    }
+
+    // Restart the position filters from the first sample of the touch
+    pFilter->anMedX[0] = pFilter->nPendX;
+    pFilter->anMedY[0] = pFilter->nPendY;
+    pFilter->nMedCnt   = 1;
+    pFilter->nMedInd   = (pFilter->nMedianLen > 1)? 1 : 0;
+    pFilter->nSmoothX  = (int32_t)pFilter->nPendX << 4;
+    pFilter->nSmoothY  = (int32_t)pFilter->nPendY << 4;
+    pFilter->nOutX     = pFilter->nPendX;
+    pFilter->nOutY     = pFilter->nPendY;
+    *pnX     = pFilter->nPendX;
+    *pnY     = pFilter->nPendY;
+    *pnPress = pFilter->nPendPress;
+    return true;
+  }
+
+  // The state is unchanged, so cancel any transition that didn't persist
+  pFilter->bPend = false;
+
+  if (!bDown) {
+    // Pass through samples while not touched (eg. mouse hover)
+    *pnPress = 0;
+    return true;
+  }
+
+  // Median filter
+  int16_t nX = *pnX;
+  int16_t nY = *pnY;
+  if (pFilter->nMedianLen > 1) {
+    pFilter->anMedX[pFilter->nMedInd] = nX;
+    pFilter->anMedY[pFilter->nMedInd] = nY;
+    pFilter->nMedInd = (pFilter->nMedInd + 1) % pFilter->nMedianLen;
+    if (pFilter->nMedCnt < pFilter->nMedianLen) {
+      pFilter->nMedCnt++;
+    }
+    nX = gslc_TouchFilterMedian(pFilter->anMedX,pFilter->nMedCnt);
+    nY = gslc_TouchFilterMedian(pFilter->anMedY,pFilter->nMedCnt);
+  }
+
+  // Exponential smoothing in fixed point
+  if (pFilter->nSmoothShift > 0) {
+    pFilter->nSmoothX += (((int32_t)nX << 4) - pFilter->nSmoothX) >> pFilter->nSmoothShift;
+    pFilter->nSmoothY += (((int32_t)nY << 4) - pFilter->nSmoothY) >> pFilter->nSmoothShift;
+    nX = (int16_t)((pFilter->nSmoothX + 8) >> 4);
+    nY = (int16_t)((pFilter->nSmoothY + 8) >> 4);
+  }
+
+  // Suppress small moves
+  int16_t nDX = nX - pFilter->nOutX;
+  int16_t nDY = nY - pFilter->nOutY;
+  if (nDX < 0) { nDX = -nDX; }
+  if (nDY < 0) { nDY = -nDY; }
+  if ((nDX < pFilter->nMoveMin) && (nDY < pFilter->nMoveMin)) {
+    return false;
+  }
+  pFilter->nOutX = nX;
+  pFilter->nOutY = nY;
+  *pnX = nX;
+  *pnY = nY;
+  return true;
+}
+#endif // GSLC_FEATURE_TOUCH_FILTER
 void gslc_SetTouchEn(gslc_tsGui* pGui, bool bEn)
 {
   if (pGui == NULL) {
@@ -5342,8 +7486,51 @@ bool gslc_CollectEvent(void* pvGui,gslc_tsEvent sEvent)
     return true;
     #endif  // !DRV_TOUCH_NONE
 
-  } else if ( (sEvent.eType == GSLC_EVT_DRAW) || (sEvent.eType == GSLC_EVT_TICK) ) {
-    // DRAW and TICK are propagated down to all elements in collection
+  } else if (sEvent.eType == GSLC_EVT_DRAW) {
+    // DRAW is propagated down to the elements in the collection that
+    // require redraw (or all elements if the redraw is forced)
+    // - Elements are visited in z-order
+    uint16_t nIterCnt = pCollect->nElemRefCnt;
+    uint16_t nIter;
+
+    #if (GSLC_COLLECT_DIRTY_MAX > 0)
+    // Take a copy of the dirty list and then clear it. Any elements
+    // that still require redraw after the event (eg. outside of the
+    // current redraw pass) or are marked during the event get re-added.
+    uint16_t anDirty[GSLC_COLLECT_DIRTY_MAX];
+    bool     bDirtyList = (sEvent.nSubType != GSLC_EVTSUB_DRAW_FORCE) && (!pCollect->bElemRefDirtyAll);
+    if (bDirtyList) {
+      nIterCnt = pCollect->nElemRefDirtyCnt;
+      memcpy(anDirty,pCollect->anElemRefDirty,nIterCnt*sizeof(uint16_t));
+    }
+    pCollect->nElemRefDirtyCnt = 0;
+    pCollect->bElemRefDirtyAll = false;
+    #endif // GSLC_COLLECT_DIRTY_MAX
+
+    for (nIter=0;nIter<nIterCnt;nIter++) {
+      nInd = nIter;
+      #if (GSLC_COLLECT_DIRTY_MAX > 0)
+      if (bDirtyList) {
+        nInd = anDirty[nIter];
+      }
+      #endif
+      pElemRef = &(pCollect->asElemRef[nInd]);
+
+      // Copy event so we can modify it in the loop
+      gslc_tsEvent sEventNew = sEvent;
+      sEventNew.pvScope = (void*)(pElemRef);
+
+      // Propagate the event to the element
+      gslc_ElemEvent(pvGui,sEventNew);
+
+      if ((pElemRef->eElemFlags & GSLC_ELEMREF_REDRAW_MASK) != GSLC_ELEMREF_REDRAW_NONE) {
+        gslc_CollectDirtyAdd(pCollect,nInd);
+      }
+
+    } // nIter
+
+  } else if (sEvent.eType == GSLC_EVT_TICK) {
+    // TICK is propagated down to all elements in collection
 
     for (nInd=0;nInd<pCollect->nElemRefCnt;nInd++) {
       pElemRef = &(pCollect->asElemRef[nInd]);
@@ -5440,18 +7627,14 @@ gslc_tsElemRef* gslc_CollectElemAdd(gslc_tsGui* pGui,gslc_tsCollect* pCollect,co
     // External reference
     // - Pointer (pElem) links to an element stored in FLASH (must be declared statically)
 
-    // Fetch a RAM copy of the FLASH element
-    #if (GSLC_USE_PROGMEM)
-    memcpy_P(&pGui->sElemTmpProg,pElem,sizeof(gslc_tsElem));
-    #endif
-
     #if defined(DBG_LOG)
-      const gslc_tsElem* pElemRam = pElem; // Local element in RAM
+      int16_t nElemId = pElem->nId;
       #if (GSLC_USE_PROGMEM)
-        pElemRam = &pGui->sElemTmpProg;
+        // Fetch the ID from the FLASH element
+        memcpy_P(&nElemId,&(pElem->nId),sizeof(int16_t));
       #endif
     GSLC_DEBUG_PRINT("INFO:   Add elem to collection: ElemRef=%d/%d, ElemId=%u (FLASH)\n",
-            pCollect->nElemRefCnt+1,pCollect->nElemRefMax,pElemRam->nId);
+            pCollect->nElemRefCnt+1,pCollect->nElemRefMax,nElemId);
     #endif
 
     // Add a reference
@@ -5544,6 +7727,13 @@ gslc_tsElemRef* gslc_ElemAdd(gslc_tsGui* pGui,int16_t nPageId,gslc_tsElem* pElem
   // Update the page's bounding rect
   gslc_UnionRect(&(pPage->rBounds), pElemLocal->rElem);
 
+  #if (GSLC_FEATURE_HIT_GRID)
+  // Add the element to the page's hit-test grid (if any)
+  if (pCollect->pHitGrid) {
+    gslc_CollectHitGridUpdate(pGui,pCollect,(uint16_t)(pElemRefAdd - pCollect->asElemRef));
+  }
+  #endif
+
   return pElemRefAdd;
 }
 
@@ -5639,12 +7829,25 @@ bool gslc_GuiRotate(gslc_tsGui* pGui, uint8_t nRotation)
   // Invalidate the new screen dimensions
   gslc_InvalidateRgnScreen(pGui);
 
+  #if (GSLC_FEATURE_HIT_GRID)
+  // Rebuild any hit-test grids as the cell dimensions
+  // depend upon the display dimensions
+  uint8_t nPageInd;
+  for (nPageInd=0;nPageInd<pGui->nPageCnt;nPageInd++) {
+    gslc_tsCollect* pCollect = &(pGui->asPage[nPageInd].sCollect);
+    if (pCollect->pHitGrid) {
+      gslc_CollectHitGridBuild(pGui,pCollect);
+    }
+  }
+  #endif
+
   return bOk;
 }
 
 // Trigger a touch event on an element
-// - These events are put into the deferred state to be caught on the next update loop
-// - If there is already a deferred event waiting, then it is issued immediately.
+// - These events are put into the deferred event queue to be issued by gslc_Update()
+// - If the queue is full, a queued move event for the same element is
+//   discarded or else the oldest event is issued immediately.
 bool gslc_ElemSendEventTouch(gslc_tsGui* pGui,gslc_tsElemRef* pElemRefTracked,
         gslc_teTouch eTouch,int16_t nX,int16_t nY)
 {
@@ -5656,51 +7859,160 @@ bool gslc_ElemSendEventTouch(gslc_tsGui* pGui,gslc_tsElemRef* pElemRefTracked,
     return false; //FIXME: Need to add this check!
   }
 
-  // Check to see if the deferred event queue is available
-  if (pGui->bEventPending) {
-    // If the pending slot already has an event, then
-    // service it now and then save the new event into
-    // the pending slot.
-    gslc_ElemEvent((void*)pGui,pGui->sEventPend);
+  gslc_tsEventQueueStats* pStats = &pGui->sEvtQueueStats;
+  bool bMove = gslc_EventTouchIsMove(eTouch);
+  gslc_tsEventQueueEntry* pEntry;
+
+  // Coalesce consecutive moves of the same element
+  // - Only the latest position of the move needs to be reported
+  if ((bMove) && (pGui->nEvtQueueCnt > 0)) {
+    pEntry = &pGui->asEvtQueue[(pGui->nEvtQueueHead + pGui->nEvtQueueCnt - 1) % GSLC_EVENT_QUEUE_MAX];
+    if ((pEntry->sTouch.eTouch == eTouch) && (pEntry->sEvent.pvScope == (void*)pElemRefTracked)) {
+      pEntry->sTouch.nX = nX;
+      pEntry->sTouch.nY = nY;
+      pStats->nCoalesced++;
+      return true;
+    }
+  }
+
+  // Make room in the queue if it is full
+  // - A queued move can be discarded in favor of a newer move
+  //   of the same element
+  // - Otherwise the oldest event is issued now
+  if (pGui->nEvtQueueCnt >= GSLC_EVENT_QUEUE_MAX) {
+    if ((bMove) && (gslc_EventQueueDropMove(pGui,(void*)pElemRefTracked))) {
+      pStats->nDropped++;
+    } else {
+      gslc_EventQueueIssueHead(pGui);
+      pStats->nForced++;
+    }
+  }
+
+  // Append the event
+  // - The touch data pointer is assigned when the event is issued
+  pEntry = &pGui->asEvtQueue[(pGui->nEvtQueueHead + pGui->nEvtQueueCnt) % GSLC_EVENT_QUEUE_MAX];
+  pEntry->sTouch.eTouch = eTouch;
+  pEntry->sTouch.nX     = nX;
+  pEntry->sTouch.nY     = nY;
+  pEntry->sEvent = gslc_EventCreate(pGui,GSLC_EVT_TOUCH,0,(void*)pElemRefTracked,NULL);
+  pGui->nEvtQueueCnt++;
+  if (!bMove) {
+    pGui->nEvtQueueHighCnt++;
+  }
+  pStats->nQueued++;
+  if (pGui->nEvtQueueCnt > pStats->nDepthMax) {
+    pStats->nDepthMax = pGui->nEvtQueueCnt;
   }
-  // Now we can save the new event into the pending slot
-  pGui->sEventTouchPend.eTouch = eTouch;
-  pGui->sEventTouchPend.nX = nX;
-  pGui->sEventTouchPend.nY = nY;
-  pGui->sEventPend = gslc_EventCreate(pGui,GSLC_EVT_TOUCH,0,(void*)pElemRefTracked,&(pGui->sEventTouchPend));
-  pGui->bEventPending = true;
 
   return true;
 #endif // !DRV_TOUCH_NONE
 }
 
-// Initialize the element struct to all zeros
-void gslc_ResetElem(gslc_tsElem* pElem)
+bool gslc_EventTouchIsMove(gslc_teTouch eTouch)
 {
-  if (pElem == NULL) {
-    static const char GSLC_PMEM FUNCSTR[] = "ResetElem";
-    GSLC_DEBUG2_PRINT_CONST(ERRSTR_NULL,FUNCSTR);
-    return;
+  // Moves into or out of an element change its state and are
+  // therefore not treated as moves
+  return (eTouch == GSLC_TOUCH_MOVE);
+}
+
+bool gslc_EventQueueIssueHead(gslc_tsGui* pGui)
+{
+  if (pGui->nEvtQueueCnt == 0) {
+    return false;
   }
-  pElem->nFeatures        = GSLC_ELEM_FEA_NONE;
-  pElem->nFeatures       &= ~GSLC_ELEM_FEA_VALID; // Init with Valid=false
-  pElem->nFeatures       &= ~GSLC_ELEM_FEA_CLICK_EN;
-  pElem->nFeatures       &= ~GSLC_ELEM_FEA_GLOW_EN;
-  pElem->nFeatures       &= ~GSLC_ELEM_FEA_FRAME_EN;
-  pElem->nFeatures       &= ~GSLC_ELEM_FEA_FILL_EN;
-  pElem->nId              = GSLC_ID_NONE;
-  pElem->nType            = GSLC_TYPE_BOX;
-  pElem->nGroup           = GSLC_GROUP_ID_NONE;
-  pElem->rElem            = (gslc_tsRect){0,0,0,0};
-  pElem->sImgRefNorm      = gslc_ResetImage();
-  pElem->sImgRefGlow      = gslc_ResetImage();
-  pElem->colElemFrame     = GSLC_COL_WHITE;
-  pElem->colElemFill      = GSLC_COL_WHITE;
-  pElem->colElemFrameGlow = GSLC_COL_WHITE;
-  pElem->colElemFillGlow  = GSLC_COL_WHITE;
-  pElem->eTxtFlags        = GSLC_TXT_DEFAULT;
-  #if (GSLC_LOCAL_STR)
-    pElem->pStrBuf[0]       = '\0';
+
+  // Take a copy of the entry before issuing it as the handler
+  // may add further events to the queue
+  gslc_tsEventQueueEntry sEntry = pGui->asEvtQueue[pGui->nEvtQueueHead];
+  pGui->nEvtQueueHead = (pGui->nEvtQueueHead + 1) % GSLC_EVENT_QUEUE_MAX;
+  pGui->nEvtQueueCnt--;
+  if (!gslc_EventTouchIsMove(sEntry.sTouch.eTouch)) {
+    pGui->nEvtQueueHighCnt--;
+  }
+
+  sEntry.sEvent.pvData = (void*)&sEntry.sTouch;
+  gslc_ElemEvent((void*)pGui,sEntry.sEvent);
+  return true;
+}
+
+void gslc_EventQueueDrain(gslc_tsGui* pGui)
+{
+  while (gslc_EventQueueIssueHead(pGui)) {
+  }
+}
+
+bool gslc_EventQueueDropMove(gslc_tsGui* pGui,void* pvScope)
+{
+  uint8_t nInd,nPos,nNext;
+  for (nInd=0;nInd<pGui->nEvtQueueCnt;nInd++) {
+    nPos = (pGui->nEvtQueueHead + nInd) % GSLC_EVENT_QUEUE_MAX;
+    if (!gslc_EventTouchIsMove(pGui->asEvtQueue[nPos].sTouch.eTouch)) {
+      continue;
+    }
+    if (pGui->asEvtQueue[nPos].sEvent.pvScope != pvScope) {
+      continue;
+    }
+    // Close the gap by shifting the newer entries towards the head
+    for (;nInd+1<pGui->nEvtQueueCnt;nInd++) {
+      nNext = (nPos + 1) % GSLC_EVENT_QUEUE_MAX;
+      pGui->asEvtQueue[nPos] = pGui->asEvtQueue[nNext];
+      nPos = nNext;
+    }
+    pGui->nEvtQueueCnt--;
+    return true;
+  }
+  return false;
+}
+
+void gslc_EventQueueGetStats(gslc_tsGui* pGui,gslc_tsEventQueueStats* pStats)
+{
+  if ((pGui == NULL) || (pStats == NULL)) {
+    static const char GSLC_PMEM FUNCSTR[] = "EventQueueGetStats";
+    GSLC_DEBUG2_PRINT_CONST(ERRSTR_NULL,FUNCSTR);
+    return;
+  }
+  *pStats = pGui->sEvtQueueStats;
+  pStats->nDepth = pGui->nEvtQueueCnt;
+}
+
+void gslc_EventQueueResetStats(gslc_tsGui* pGui)
+{
+  gslc_tsEventQueueStats* pStats = &pGui->sEvtQueueStats;
+  pStats->nDepth     = 0;
+  pStats->nDepthMax  = pGui->nEvtQueueCnt;
+  pStats->nQueued    = 0;
+  pStats->nCoalesced = 0;
+  pStats->nDropped   = 0;
+  pStats->nForced    = 0;
+}
+
+// Initialize the element struct to all zeros
+void gslc_ResetElem(gslc_tsElem* pElem)
+{
+  if (pElem == NULL) {
+    static const char GSLC_PMEM FUNCSTR[] = "ResetElem";
+    GSLC_DEBUG2_PRINT_CONST(ERRSTR_NULL,FUNCSTR);
+    return;
+  }
+  pElem->nFeatures        = GSLC_ELEM_FEA_NONE;
+  pElem->nFeatures       &= ~GSLC_ELEM_FEA_VALID; // Init with Valid=false
+  pElem->nFeatures       &= ~GSLC_ELEM_FEA_CLICK_EN;
+  pElem->nFeatures       &= ~GSLC_ELEM_FEA_GLOW_EN;
+  pElem->nFeatures       &= ~GSLC_ELEM_FEA_FRAME_EN;
+  pElem->nFeatures       &= ~GSLC_ELEM_FEA_FILL_EN;
+  pElem->nId              = GSLC_ID_NONE;
+  pElem->nType            = GSLC_TYPE_BOX;
+  pElem->nGroup           = GSLC_GROUP_ID_NONE;
+  pElem->rElem            = (gslc_tsRect){0,0,0,0};
+  pElem->sImgRefNorm      = gslc_ResetImage();
+  pElem->sImgRefGlow      = gslc_ResetImage();
+  pElem->colElemFrame     = GSLC_COL_WHITE;
+  pElem->colElemFill      = GSLC_COL_WHITE;
+  pElem->colElemFrameGlow = GSLC_COL_WHITE;
+  pElem->colElemFillGlow  = GSLC_COL_WHITE;
+  pElem->eTxtFlags        = GSLC_TXT_DEFAULT;
+  #if (GSLC_LOCAL_STR)
+    pElem->pStrBuf[0]       = '\0';
     pElem->nStrBufMax       = GSLC_LOCAL_STR_LEN;
   #else
     pElem->pStrBuf          = NULL;
@@ -5721,9 +8033,265 @@ void gslc_ResetElem(gslc_tsElem* pElem)
 #if (GSLC_FEATURE_COMPOUND)
   pElem->pElemRefParent   = NULL;
 #endif
+#if (GSLC_FEATURE_TXT_INCR)
+  pElem->pTxtIncr         = NULL;
+#endif
+
+  gslc_ElemTxtExtInvalidate(pElem);
+}
+
+void gslc_ElemTxtExtInvalidate(gslc_tsElem* pElem)
+{
+  #if (GSLC_FEATURE_TXT_EXT_CACHE)
+  pElem->sTxtExtCache.bValid = false;
+  #else
+  (void)pElem; // Unused
+  #endif
+}
+
+#if (GSLC_FEATURE_TXT_INCR)
+
+// Incremental text redraw requires that GUIslice positions the text
+// and that the driver clips the rendered text to the clipping region
+// - Drivers without DRV_HAS_DRAW_TXT_CLIP only clip the text that they
+//   render through the glyph buffer (DRV_HAS_DRAW_TXT_GLYPHBUF)
+#if defined(DRV_HAS_DRAW_TXT_CLIP)
+  #if (DRV_HAS_DRAW_TEXT) && (DRV_HAS_DRAW_TXT_CLIP) && !(DRV_OVERRIDE_TXT_ALIGN)
+    #define GSLC_TXT_INCR_SUPPORT 1
+  #endif
+#endif
+#if defined(DRV_HAS_DRAW_TXT_GLYPHBUF) && !defined(GSLC_TXT_INCR_SUPPORT)
+  #if (DRV_HAS_DRAW_TEXT) && (DRV_HAS_DRAW_TXT_GLYPHBUF) && (GSLC_CLIP_EN) && !(DRV_OVERRIDE_TXT_ALIGN)
+    #define GSLC_TXT_INCR_SUPPORT 1
+  #endif
+#endif
+#if !defined(GSLC_TXT_INCR_SUPPORT)
+  #define GSLC_TXT_INCR_SUPPORT 0
+#endif
+
+#if (GSLC_TXT_INCR_SUPPORT)
+// Determine whether an element's current appearance permits an
+// incremental text update. Returns the string length (or -1 if not).
+int16_t gslc_ElemTxtIncrLen(gslc_tsElem* pElem)
+{
+  bool bFillEn   = pElem->nFeatures & GSLC_ELEM_FEA_FILL_EN;
+  bool bRoundEn  = pElem->nFeatures & GSLC_ELEM_FEA_ROUND_EN;
+
+  // The changed characters are erased with the element fill color
+  if ((!bFillEn) || (bRoundEn)) { return -1; }
+  if (pElem->sImgRefNorm.eImgFlags != GSLC_IMGREF_NONE) { return -1; }
+  const char* pStr = pElem->pStrBuf;
+  if ((pStr == NULL) || (pElem->pTxtFont == NULL)) { return -1; }
+  if ((pElem->eTxtFlags & GSLC_TXT_ALLOC) == GSLC_TXT_ALLOC_NONE) { return -1; }
+  if ((pElem->eTxtFlags & GSLC_TXT_MEM) != GSLC_TXT_MEM_RAM) { return -1; }
+
+  // Only single-line strings that fit in the state are tracked
+  int16_t nLen;
+  for (nLen = 0; pStr[nLen] != '\0'; nLen++) {
+    if ((pStr[nLen] == '\n') || (nLen >= GSLC_TXT_INCR_LEN-1)) { return -1; }
+  }
+  return nLen;
+}
+
+// Determine whether the driver clips the text of an element
+// to the clipping region
+bool gslc_ElemTxtIncrClip(gslc_tsFont* pFont,gslc_tsColor colTxt,gslc_tsColor colBg)
+{
+  #if defined(DRV_HAS_DRAW_TXT_CLIP) && (DRV_HAS_DRAW_TXT_CLIP)
+  (void)pFont; // Unused
+  (void)colTxt; // Unused
+  (void)colBg; // Unused
+  return true;
+  #else
+  // Only opaque text in a glyph buffer font is clipped
+  return (pFont->eFontRefMode == DRV_FONTREF_MODE_GLYPHBUF) && (pFont->eFontRefType == GSLC_FONTREF_PTR) &&
+    (pFont->pvFont != NULL) && (!gslc_ColorEqual(colTxt,colBg));
+  #endif
+}
+
+// Measure the right edge of each character in a string relative to
+// its text origin. Edges of the first nStart characters are not updated.
+void gslc_ElemTxtIncrEdges(gslc_tsGui* pGui,gslc_tsElem* pElem,int16_t nStart,int16_t nLen,int16_t* anEdgeX)
+{
+  char      acPrefix[GSLC_TXT_INCR_LEN];
+  int16_t   nTxtOffsetX,nTxtOffsetY;
+  uint16_t  nTxtSzW,nTxtSzH;
+  int16_t   nInd;
+
+  // The right edge of each prefix of the string marks the end of
+  // its last character, which accounts for kerning and proportional
+  // advances without requiring per-glyph metrics from the driver
+  memcpy(acPrefix,pElem->pStrBuf,nStart);
+  for (nInd = nStart; nInd < nLen; nInd++) {
+    acPrefix[nInd]   = pElem->pStrBuf[nInd];
+    acPrefix[nInd+1] = '\0';
+    nTxtOffsetX = 0;
+    nTxtSzW = 0;
+    gslc_DrvGetTxtSize(pGui,pElem->pTxtFont,acPrefix,pElem->eTxtFlags,&nTxtOffsetX,&nTxtOffsetY,&nTxtSzW,&nTxtSzH);
+    anEdgeX[nInd] = nTxtOffsetX + (int16_t)nTxtSzW;
+  }
+}
+#endif // GSLC_TXT_INCR_SUPPORT
+
+void gslc_ElemTxtIncrSave(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_tsRectState* pState)
+{
+  gslc_tsElem* pElem = gslc_GetElemFromRefD(pGui, pElemRef, __LINE__);
+  if ((!pElem) || (!pElem->pTxtIncr)) return;
+  gslc_tsTxtIncr* pTxtIncr = pElem->pTxtIncr;
+  pTxtIncr->bValid = false;
+
+  #if (GSLC_TXT_INCR_SUPPORT)
+  int16_t nLen = gslc_ElemTxtIncrLen(pElem);
+  if (nLen < 0) return;
+  if (!gslc_ElemTxtIncrClip(pElem->pTxtFont,pState->colTxtFore,pState->colTxtBack)) return;
+
+  // Record the text origin as calculated by the text draw
+  if (!gslc_DrawTxtCalcOrigin(pGui,pElem->pStrBuf,pState->rInner,pElem->pTxtFont,pElem->eTxtFlags,
+      pElem->eTxtAlign,pElem->nTxtMarginX,pElem->nTxtMarginY,
+      #if (GSLC_FEATURE_TXT_EXT_CACHE)
+      &pElem->sTxtExtCache,
+      #else
+      NULL,
+      #endif
+      &pTxtIncr->nTxtX,&pTxtIncr->nTxtY)) {
+    return;
+  }
 
+  gslc_ElemTxtIncrEdges(pGui,pElem,0,nLen,pTxtIncr->anEdgeX);
+  memcpy(pTxtIncr->acStr,pElem->pStrBuf,nLen+1);
+  pTxtIncr->rInner = pState->rInner;
+  pTxtIncr->pFont  = pElem->pTxtFont;
+  pTxtIncr->colTxt = pState->colTxtFore;
+  pTxtIncr->colBg  = pState->colInner;
+  pTxtIncr->colFrm   = pState->colFrm;
+  pTxtIncr->colFocus = pState->colFocus;
+  pTxtIncr->bGlowing = gslc_ElemGetGlowEn(pGui,pElemRef) && gslc_ElemGetGlow(pGui,pElemRef);
+  pTxtIncr->bFocused = gslc_ElemGetFocusEn(pGui,pElemRef) && gslc_ElemGetFocus(pGui,pElemRef);
+  pTxtIncr->bEditing = gslc_ElemGetEdit(pGui,pElemRef);
+  pTxtIncr->bValid = true;
+  #else
+  (void)pState; // Unused
+  #endif // GSLC_TXT_INCR_SUPPORT
 }
 
+bool gslc_ElemDrawTxtIncr(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_tsRectState* pState)
+{
+  gslc_tsElem* pElem = gslc_GetElemFromRefD(pGui, pElemRef, __LINE__);
+  if ((!pElem) || (!pElem->pTxtIncr)) return false;
+  gslc_tsTxtIncr* pTxtIncr = pElem->pTxtIncr;
+  if (!pTxtIncr->bValid) return false;
+
+  #if (GSLC_TXT_INCR_SUPPORT)
+  int16_t nLenNew = gslc_ElemTxtIncrLen(pElem);
+  if (nLenNew < 0) return false;
+  if (!gslc_ElemTxtIncrClip(pElem->pTxtFont,pState->colTxtFore,pState->colTxtBack)) return false;
+
+  // Any change in the element's appearance requires a full redraw
+  gslc_tsRect rInner = pState->rInner;
+  if ((rInner.x != pTxtIncr->rInner.x) || (rInner.y != pTxtIncr->rInner.y) ||
+      (rInner.w != pTxtIncr->rInner.w) || (rInner.h != pTxtIncr->rInner.h)) {
+    return false;
+  }
+  if ((pElem->pTxtFont != pTxtIncr->pFont) ||
+      (!gslc_ColorEqual(pState->colTxtFore,pTxtIncr->colTxt)) ||
+      (!gslc_ColorEqual(pState->colInner,pTxtIncr->colBg)) ||
+      (!gslc_ColorEqual(pState->colFrm,pTxtIncr->colFrm)) ||
+      (!gslc_ColorEqual(pState->colFocus,pTxtIncr->colFocus))) {
+    return false;
+  }
+  // A glow, focus or edit change may alter the frame or image
+  // even if the colors above are unchanged
+  bool bGlowing = gslc_ElemGetGlowEn(pGui,pElemRef) && gslc_ElemGetGlow(pGui,pElemRef);
+  bool bFocused = gslc_ElemGetFocusEn(pGui,pElemRef) && gslc_ElemGetFocus(pGui,pElemRef);
+  bool bEditing = gslc_ElemGetEdit(pGui,pElemRef);
+  if ((bGlowing != pTxtIncr->bGlowing) || (bFocused != pTxtIncr->bFocused) ||
+      (bEditing != pTxtIncr->bEditing)) {
+    return false;
+  }
+
+  // The unchanged characters can only be retained if the text is
+  // drawn from the same origin (eg. left-aligned or fixed width)
+  int16_t nTxtX,nTxtY;
+  if (!gslc_DrawTxtCalcOrigin(pGui,pElem->pStrBuf,rInner,pElem->pTxtFont,pElem->eTxtFlags,
+      pElem->eTxtAlign,pElem->nTxtMarginX,pElem->nTxtMarginY,
+      #if (GSLC_FEATURE_TXT_EXT_CACHE)
+      &pElem->sTxtExtCache,
+      #else
+      NULL,
+      #endif
+      &nTxtX,&nTxtY)) {
+    return false;
+  }
+  if ((nTxtX != pTxtIncr->nTxtX) || (nTxtY != pTxtIncr->nTxtY)) {
+    return false;
+  }
+
+  const char* pStrOld = pTxtIncr->acStr;
+  const char* pStrNew = pElem->pStrBuf;
+  int16_t     nLenOld = (int16_t)strlen(pStrOld);
+
+  // Find the leading characters that are unchanged
+  int16_t nPrefix = 0;
+  while ((nPrefix < nLenOld) && (nPrefix < nLenNew) && (pStrOld[nPrefix] == pStrNew[nPrefix])) {
+    nPrefix++;
+  }
+  if ((nPrefix == nLenOld) && (nPrefix == nLenNew)) {
+    // Text is unchanged
+    return true;
+  }
+
+  // Measure the characters that follow the unchanged prefix
+  int16_t anEdgeNew[GSLC_TXT_INCR_LEN];
+  memcpy(anEdgeNew,pTxtIncr->anEdgeX,nPrefix*sizeof(int16_t));
+  gslc_ElemTxtIncrEdges(pGui,pElem,nPrefix,nLenNew,anEdgeNew);
+
+  // Find the trailing characters that are unchanged and that
+  // remain in the same position
+  int16_t nSuffix = 0;
+  while ((nSuffix < nLenOld-nPrefix) && (nSuffix < nLenNew-nPrefix)) {
+    int16_t nIndOld = nLenOld-1-nSuffix;
+    int16_t nIndNew = nLenNew-1-nSuffix;
+    if ((nIndOld == 0) || (nIndNew == 0)) { break; }
+    if (pStrOld[nIndOld] != pStrNew[nIndNew]) { break; }
+    if (pTxtIncr->anEdgeX[nIndOld] != anEdgeNew[nIndNew]) { break; }
+    if (pTxtIncr->anEdgeX[nIndOld-1] != anEdgeNew[nIndNew-1]) { break; }
+    nSuffix++;
+  }
+
+  // Determine the span covering the old and new changed characters
+  // - Changes at the start or end of the string extend to the edge
+  //   of the element so that any characters removed are erased
+  int16_t nSpanX0 = (nPrefix > 0) ? nTxtX + anEdgeNew[nPrefix-1] : rInner.x;
+  int16_t nSpanX1 = (nSuffix > 0) ? nTxtX + anEdgeNew[nLenNew-1-nSuffix] : rInner.x + (int16_t)rInner.w;
+  if (nSpanX1 > nSpanX0) {
+    gslc_tsRect rSpan;
+    rSpan.x = nSpanX0;
+    rSpan.y = rInner.y;
+    rSpan.w = (uint16_t)(nSpanX1-nSpanX0);
+    rSpan.h = rInner.h;
+    gslc_tsRect rClipOld = gslc_GetClipRect(pGui);
+    if ((gslc_ClipRect(&rInner,&rSpan)) && (gslc_ClipRect(&rClipOld,&rSpan))) {
+      // Erase the span and redraw the text clipped to it
+      gslc_SetClipRect(pGui,&rSpan);
+      gslc_DrawFillRect(pGui,rSpan,pState->colInner);
+      gslc_DrvDrawTxt(pGui,nTxtX,nTxtY,pElem->pTxtFont,pElem->pStrBuf,pElem->eTxtFlags,
+        pState->colTxtFore,pState->colTxtBack);
+      gslc_SetClipRect(pGui,&rClipOld);
+    }
+  }
+
+  // Retain the displayed text
+  memcpy(pTxtIncr->acStr,pStrNew,nLenNew+1);
+  memcpy(pTxtIncr->anEdgeX,anEdgeNew,nLenNew*sizeof(int16_t));
+  return true;
+  #else
+  (void)pState; // Unused
+  return false;
+  #endif // GSLC_TXT_INCR_SUPPORT
+}
+
+#endif // GSLC_FEATURE_TXT_INCR
+
 // Initialize the font struct to all zeros
 void gslc_ResetFont(gslc_tsFont* pFont)
 {
@@ -5828,6 +8396,10 @@ void gslc_GuiDestruct(gslc_tsGui* pGui)
     pGui->sImgRefBkgnd = gslc_ResetImage();
   }
 
+  #if (GSLC_FEATURE_IMG_CACHE)
+  gslc_ImgCacheClear(pGui);
+  #endif
+
   // Close all fonts
   gslc_DrvFontsDestruct(pGui);
 
@@ -5875,8 +8447,201 @@ void gslc_CollectReset(gslc_tsCollect* pCollect,gslc_tsElem* asElem,uint16_t nEl
   // Reset touch / input tracking
   pCollect->pElemRefTracked = NULL;
   pCollect->nElemIndTracked = GSLC_IND_NONE;
+
+  // Reset redraw tracking
+  #if (GSLC_COLLECT_DIRTY_MAX > 0)
+  pCollect->nElemRefDirtyCnt = 0;
+  pCollect->bElemRefDirtyAll = false;
+  #endif
+
+  #if (GSLC_FEATURE_HIT_GRID)
+  pCollect->pHitGrid = NULL;
+  #endif
+}
+
+
+void gslc_CollectDirtyAdd(gslc_tsCollect* pCollect,uint16_t nElemRefInd)
+{
+  #if (GSLC_COLLECT_DIRTY_MAX > 0)
+  uint16_t nInd;
+  if (pCollect->bElemRefDirtyAll) {
+    return;
+  }
+  // Find the insertion point that maintains the z-order
+  for (nInd=0;nInd<pCollect->nElemRefDirtyCnt;nInd++) {
+    if (pCollect->anElemRefDirty[nInd] == nElemRefInd) {
+      // Already in the list
+      return;
+    }
+    if (pCollect->anElemRefDirty[nInd] > nElemRefInd) {
+      break;
+    }
+  }
+  if (pCollect->nElemRefDirtyCnt >= GSLC_COLLECT_DIRTY_MAX) {
+    // List is full, so all elements will need to be checked
+    pCollect->bElemRefDirtyAll = true;
+    return;
+  }
+  memmove(&(pCollect->anElemRefDirty[nInd+1]),&(pCollect->anElemRefDirty[nInd]),
+    (pCollect->nElemRefDirtyCnt-nInd)*sizeof(uint16_t));
+  pCollect->anElemRefDirty[nInd] = nElemRefInd;
+  pCollect->nElemRefDirtyCnt++;
+  #endif // GSLC_COLLECT_DIRTY_MAX
+}
+
+void gslc_CollectDirtyRemove(gslc_tsCollect* pCollect,uint16_t nElemRefInd)
+{
+  #if (GSLC_COLLECT_DIRTY_MAX > 0)
+  uint16_t nInd;
+  if (pCollect->bElemRefDirtyAll) {
+    return;
+  }
+  for (nInd=0;nInd<pCollect->nElemRefDirtyCnt;nInd++) {
+    if (pCollect->anElemRefDirty[nInd] == nElemRefInd) {
+      memmove(&(pCollect->anElemRefDirty[nInd]),&(pCollect->anElemRefDirty[nInd+1]),
+        (pCollect->nElemRefDirtyCnt-nInd-1)*sizeof(uint16_t));
+      pCollect->nElemRefDirtyCnt--;
+      return;
+    }
+  }
+  #endif // GSLC_COLLECT_DIRTY_MAX
+}
+
+uint16_t gslc_CollectDirtyGetNext(gslc_tsCollect* pCollect,uint16_t nElemRefInd)
+{
+  #if (GSLC_COLLECT_DIRTY_MAX > 0)
+  uint16_t nInd;
+  if (!pCollect->bElemRefDirtyAll) {
+    for (nInd=0;nInd<pCollect->nElemRefDirtyCnt;nInd++) {
+      if (pCollect->anElemRefDirty[nInd] >= nElemRefInd) {
+        return pCollect->anElemRefDirty[nInd];
+      }
+    }
+    return pCollect->nElemRefCnt;
+  }
+  #endif
+  return nElemRefInd;
+}
+
+uint16_t gslc_CollectDirtyGetCnt(gslc_tsCollect* pCollect)
+{
+  #if (GSLC_COLLECT_DIRTY_MAX > 0)
+  if (!pCollect->bElemRefDirtyAll) {
+    return pCollect->nElemRefDirtyCnt;
+  }
+  #endif
+  return pCollect->nElemRefCnt;
+}
+
+uint16_t gslc_CollectDirtyGetInd(gslc_tsCollect* pCollect,uint16_t nDirtyInd)
+{
+  #if (GSLC_COLLECT_DIRTY_MAX > 0)
+  if (!pCollect->bElemRefDirtyAll) {
+    return pCollect->anElemRefDirty[nDirtyInd];
+  }
+  #endif
+  return nDirtyInd;
+}
+
+
+gslc_tsCollect* gslc_PageFindCollectFromElemRef(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,uint16_t* pnElemRefInd)
+{
+  uint8_t nPageInd;
+  for (nPageInd=0;nPageInd<pGui->nPageCnt;nPageInd++) {
+    gslc_tsCollect* pCollect = &(pGui->asPage[nPageInd].sCollect);
+    if ((pElemRef >= pCollect->asElemRef) && (pElemRef < pCollect->asElemRef + pCollect->nElemRefCnt)) {
+      *pnElemRefInd = (uint16_t)(pElemRef - pCollect->asElemRef);
+      return pCollect;
+    }
+  }
+  return NULL;
+}
+
+
+#if (GSLC_FEATURE_HIT_GRID)
+
+void gslc_CollectHitGridBuild(gslc_tsGui* pGui,gslc_tsCollect* pCollect)
+{
+  gslc_tsHitGrid* pHitGrid = pCollect->pHitGrid;
+  if (pHitGrid == NULL) {
+    return;
+  }
+
+  // Determine the cell dimensions, rounding up so that
+  // the grid covers the entire display
+  pHitGrid->nCellW = (pGui->nDispW + pHitGrid->nCols - 1) / pHitGrid->nCols;
+  pHitGrid->nCellH = (pGui->nDispH + pHitGrid->nRows - 1) / pHitGrid->nRows;
+  if (pHitGrid->nCellW == 0) { pHitGrid->nCellW = 1; }
+  if (pHitGrid->nCellH == 0) { pHitGrid->nCellH = 1; }
+
+  memset(pHitGrid->pCellBuf,0,(uint16_t)pHitGrid->nCols*pHitGrid->nRows*pHitGrid->nCellBytes);
+
+  uint16_t nInd;
+  for (nInd=0;nInd<pCollect->nElemRefCnt;nInd++) {
+    gslc_CollectHitGridUpdate(pGui,pCollect,nInd);
+  }
 }
 
+void gslc_CollectHitGridUpdate(gslc_tsGui* pGui,gslc_tsCollect* pCollect,uint16_t nElemRefInd)
+{
+  gslc_tsHitGrid* pHitGrid = pCollect->pHitGrid;
+  if (pHitGrid == NULL) {
+    return;
+  }
+  if (nElemRefInd >= pHitGrid->nCellBytes*8) {
+    // Element was added beyond the capacity of the grid
+    GSLC_DEBUG2_PRINT("ERROR: CollectHitGridUpdate() ElemRef index %u exceeds grid capacity\n",nElemRefInd);
+    return;
+  }
+
+  uint16_t  nByte = nElemRefInd / 8;
+  uint8_t   nMask = (uint8_t)(1 << (nElemRefInd % 8));
+  uint16_t  nCellCnt = (uint16_t)pHitGrid->nCols * pHitGrid->nRows;
+  uint16_t  nCell;
+
+  // Remove the element from all cells
+  for (nCell=0;nCell<nCellCnt;nCell++) {
+    pHitGrid->pCellBuf[nCell*pHitGrid->nCellBytes + nByte] &= ~nMask;
+  }
+
+  // Only visible elements that accept touch can be hit
+  gslc_tsElemRef* pElemRef = &(pCollect->asElemRef[nElemRefInd]);
+  if (!gslc_ElemGetVisible(pGui,pElemRef)) {
+    return;
+  }
+  gslc_tsRect rElem;
+  uint16_t    nFeatures;
+  if (!gslc_GetElemRectFeatFromRef(pGui,pElemRef,&rElem,&nFeatures)) {
+    return;
+  }
+  if (!(nFeatures & GSLC_ELEM_FEA_CLICK_EN)) {
+    return;
+  }
+
+  // Add the element to each cell that overlaps its rect
+  // - The range is inclusive of (x+w,y+h) to match gslc_IsInRect()
+  int32_t nX0 = GSLC_MAX(rElem.x,0);
+  int32_t nY0 = GSLC_MAX(rElem.y,0);
+  int32_t nX1 = (int32_t)rElem.x + rElem.w;
+  int32_t nY1 = (int32_t)rElem.y + rElem.h;
+  if ((nX1 < 0) || (nY1 < 0)) {
+    return;
+  }
+  int32_t nCol0 = nX0 / pHitGrid->nCellW;
+  int32_t nRow0 = nY0 / pHitGrid->nCellH;
+  int32_t nCol1 = GSLC_MIN(nX1 / pHitGrid->nCellW,pHitGrid->nCols-1);
+  int32_t nRow1 = GSLC_MIN(nY1 / pHitGrid->nCellH,pHitGrid->nRows-1);
+  int32_t nRow,nCol;
+  for (nRow=nRow0;nRow<=nRow1;nRow++) {
+    for (nCol=nCol0;nCol<=nCol1;nCol++) {
+      nCell = (uint16_t)(nRow*pHitGrid->nCols + nCol);
+      pHitGrid->pCellBuf[nCell*pHitGrid->nCellBytes + nByte] |= nMask;
+    }
+  }
+}
+
+#endif // GSLC_FEATURE_HIT_GRID
+
 
 // Search internal element array for one with a particular ID
 gslc_tsElemRef* gslc_CollectFindElemById(gslc_tsGui* pGui,gslc_tsCollect* pCollect,int16_t nElemId)
@@ -5949,6 +8714,46 @@ gslc_tsElemRef* gslc_CollectFindElemFromCoord(gslc_tsGui* pGui,gslc_tsCollect* p
   *pnElemInd = GSLC_IND_NONE;
 
   if (pCollect->nElemRefCnt == 0) { return NULL; }
+
+  #if (GSLC_FEATURE_HIT_GRID)
+  // If a hit-test grid is available, only examine the
+  // elements recorded in the cell containing the coordinate
+  gslc_tsHitGrid* pHitGrid = pCollect->pHitGrid;
+  if ((pHitGrid) && (nX >= 0) && (nY >= 0)) {
+    int16_t nCol = nX / pHitGrid->nCellW;
+    int16_t nRow = nY / pHitGrid->nCellH;
+    if ((nCol < pHitGrid->nCols) && (nRow < pHitGrid->nRows)) {
+      uint8_t*  pCell = &(pHitGrid->pCellBuf[(nRow*pHitGrid->nCols + nCol)*pHitGrid->nCellBytes]);
+      int16_t   nByte;
+      int8_t    nBit;
+      // Scan in decreasing Z-order
+      for (nByte=pHitGrid->nCellBytes-1;nByte>=0;nByte--) {
+        if (pCell[nByte] == 0) {
+          continue;
+        }
+        for (nBit=7;nBit>=0;nBit--) {
+          if (!(pCell[nByte] & (1 << nBit))) {
+            continue;
+          }
+          nInd = nByte*8 + nBit;
+          if (nInd >= (int16_t)pCollect->nElemRefCnt) {
+            continue;
+          }
+          pElemRef = &(pCollect->asElemRef[nInd]);
+          if (!gslc_ElemGetVisible(pGui, pElemRef)) {
+            continue;
+          }
+          if (gslc_ElemOwnsCoord(pGui,pElemRef,nX,nY,true)) {
+            *pnElemInd = nInd;
+            return pElemRef;
+          }
+        }
+      }
+      return NULL;
+    }
+  }
+  #endif // GSLC_FEATURE_HIT_GRID
+
   for (nInd=pCollect->nElemRefCnt-1;nInd>=0;nInd--) {
     pElemRef  = &(pCollect->asElemRef[nInd]);
 
@@ -6004,6 +8809,372 @@ void gslc_CollectSetEventFunc(gslc_tsGui* pGui,gslc_tsCollect* pCollect,GSLC_CB_
 }
 */
 
+// ================================
+// Driver Instrumentation
+
+#if (GSLC_FEATURE_DRV_STATS)
+
+// Remove the redirection of the driver APIs (see GUIslice_drv.h)
+// so that the following wrappers call the driver directly
+#undef gslc_DrvDrawPoint
+#undef gslc_DrvDrawPoints
+#undef gslc_DrvDrawLine
+#undef gslc_DrvDrawFrameRect
+#undef gslc_DrvDrawFillRect
+#undef gslc_DrvDrawFrameRoundRect
+#undef gslc_DrvDrawFillRoundRect
+#undef gslc_DrvDrawFrameCircle
+#undef gslc_DrvDrawFillCircle
+#undef gslc_DrvDrawFrameTriangle
+#undef gslc_DrvDrawFillTriangle
+#undef gslc_DrvDrawTxt
+#undef gslc_DrvDrawTxtAlign
+#undef gslc_DrvDrawImage
+#undef gslc_DrvDrawBkgnd
+#undef gslc_DrvPageFlipNow
+
+uint32_t gslc_DrvStatsGetTimeUs()
+{
+  return gslc_GetTimeUs();
+}
+
+void gslc_DrvStatsGet(gslc_tsGui* pGui,gslc_tsDrvStats* pStats)
+{
+  if ((pGui == NULL) || (pStats == NULL)) {
+    static const char GSLC_PMEM FUNCSTR[] = "DrvStatsGet";
+    GSLC_DEBUG2_PRINT_CONST(ERRSTR_NULL,FUNCSTR);
+    return;
+  }
+  *pStats = pGui->sDrvStats;
+}
+
+void gslc_DrvStatsReset(gslc_tsGui* pGui)
+{
+  if (pGui == NULL) {
+    static const char GSLC_PMEM FUNCSTR[] = "DrvStatsReset";
+    GSLC_DEBUG2_PRINT_CONST(ERRSTR_NULL,FUNCSTR);
+    return;
+  }
+  memset(&pGui->sDrvStats,0,sizeof(gslc_tsDrvStats));
+  pGui->sDrvStats.nStartUs = gslc_DrvStatsGetTimeUs();
+}
+
+void gslc_DrvStatsDump(gslc_tsGui* pGui)
+{
+  if (pGui == NULL) {
+    static const char GSLC_PMEM FUNCSTR[] = "DrvStatsDump";
+    GSLC_DEBUG2_PRINT_CONST(ERRSTR_NULL,FUNCSTR);
+    return;
+  }
+  // Labels for the report
+  static const char* const  asPrimName[GSLC_DRV_STAT__MAX] = {
+    "point","line","frame","fill","txt","img","bkgnd","flip" };
+  static const char* const  asRedrawName[GSLC_REDRAW_FOCUS+1] = {
+    "none","full","inc","focus" };
+
+  gslc_tsDrvStats*  pStats = &pGui->sDrvStats;
+  gslc_tsDrvStat*   pStat;
+  uint32_t          nElapsedMs = (gslc_DrvStatsGetTimeUs() - pStats->nStartUs) / 1000;
+  uint8_t           nInd;
+
+  GSLC_DEBUG_PRINT("DrvStats: %u ms, %u updates, %u flips\n",
+    (unsigned)nElapsedMs,(unsigned)pStats->nUpdateCnt,(unsigned)pStats->asPrim[GSLC_DRV_STAT_FLIP].nCalls);
+  for (nInd=0;nInd<GSLC_DRV_STAT__MAX;nInd++) {
+    pStat = &pStats->asPrim[nInd];
+    if (pStat->nCalls == 0) { continue; }
+    GSLC_DEBUG_PRINT("  prim %s: calls=%u pix=%u img=%u us=%u\n",asPrimName[nInd],
+      (unsigned)pStat->nCalls,(unsigned)pStat->nPixels,(unsigned)pStat->nImgBytes,(unsigned)pStat->nTimeUs);
+  }
+  for (nInd=0;nInd<=GSLC_REDRAW_FOCUS;nInd++) {
+    pStat = &pStats->asRedraw[nInd];
+    if (pStat->nCalls == 0) { continue; }
+    GSLC_DEBUG_PRINT("  redraw %s: calls=%u pix=%u img=%u us=%u\n",asRedrawName[nInd],
+      (unsigned)pStat->nCalls,(unsigned)pStat->nPixels,(unsigned)pStat->nImgBytes,(unsigned)pStat->nTimeUs);
+  }
+  for (nInd=0;nInd<pStats->nElemCnt;nInd++) {
+    pStat = &pStats->asElem[nInd].sStat;
+    GSLC_DEBUG_PRINT("  elem %d: calls=%u pix=%u img=%u us=%u\n",pStats->asElem[nInd].nElemId,
+      (unsigned)pStat->nCalls,(unsigned)pStat->nPixels,(unsigned)pStat->nImgBytes,(unsigned)pStat->nTimeUs);
+  }
+  pStat = &pStats->sElemOther;
+  if (pStat->nCalls > 0) {
+    GSLC_DEBUG_PRINT("  elem other: calls=%u pix=%u img=%u us=%u\n",
+      (unsigned)pStat->nCalls,(unsigned)pStat->nPixels,(unsigned)pStat->nImgBytes,(unsigned)pStat->nTimeUs);
+  }
+}
+
+void gslc_DrvStatsSetScope(gslc_tsGui* pGui,int16_t nElemId,gslc_teRedrawType eRedraw)
+{
+  pGui->nDrvStatElemId = nElemId;
+  pGui->eDrvStatRedraw = eRedraw;
+}
+
+void gslc_DrvStatsAdd(gslc_tsGui* pGui,gslc_teDrvStatPrim ePrim,uint32_t nStartUs,uint32_t nPixels,uint32_t nImgBytes)
+{
+  uint32_t          nTimeUs = gslc_DrvStatsGetTimeUs() - nStartUs;
+  gslc_tsDrvStats*  pStats = &pGui->sDrvStats;
+  gslc_tsDrvStat*   apStat[3];
+  uint8_t           nStatCnt = 0;
+  uint8_t           nInd;
+
+  apStat[nStatCnt++] = &pStats->asPrim[ePrim];
+  apStat[nStatCnt++] = &pStats->asRedraw[pGui->eDrvStatRedraw];
+
+  // Locate the element's counters, adding the element if not found
+  if (pGui->nDrvStatElemId != GSLC_ID_NONE) {
+    gslc_tsDrvStat* pStatElem = &pStats->sElemOther;
+    for (nInd=0;nInd<pStats->nElemCnt;nInd++) {
+      if (pStats->asElem[nInd].nElemId == pGui->nDrvStatElemId) {
+        pStatElem = &pStats->asElem[nInd].sStat;
+        break;
+      }
+    }
+    if ((nInd == pStats->nElemCnt) && (pStats->nElemCnt < GSLC_DRV_STATS_ELEM_MAX)) {
+      pStats->asElem[nInd].nElemId = pGui->nDrvStatElemId;
+      pStatElem = &pStats->asElem[nInd].sStat;
+      pStats->nElemCnt++;
+    }
+    apStat[nStatCnt++] = pStatElem;
+  }
+
+  for (nInd=0;nInd<nStatCnt;nInd++) {
+    apStat[nInd]->nCalls++;
+    apStat[nInd]->nPixels   += nPixels;
+    apStat[nInd]->nImgBytes += nImgBytes;
+    apStat[nInd]->nTimeUs   += nTimeUs;
+  }
+}
+
+void gslc_DrvStatsImgSize(gslc_tsImgRef sImgRef,uint32_t* pnPixels,uint32_t* pnBytes)
+{
+  *pnPixels = 0;
+  *pnBytes = 0;
+  gslc_teImgRefFlags eImgSrc = sImgRef.eImgFlags & GSLC_IMGREF_SRC;
+  gslc_teImgRefFlags eImgFmt = sImgRef.eImgFlags & GSLC_IMGREF_FMT;
+  if (((eImgSrc != GSLC_IMGREF_SRC_RAM) && (eImgSrc != GSLC_IMGREF_SRC_PROG)) || (sImgRef.pImgBuf == NULL)) {
+    return;
+  }
+
+  // Fetch the image header
+  uint8_t anHdr[6];
+  uint8_t nInd;
+  for (nInd=0;nInd<6;nInd++) {
+    #if (GSLC_USE_PROGMEM)
+    anHdr[nInd] = (eImgSrc == GSLC_IMGREF_SRC_PROG)? pgm_read_byte(&sImgRef.pImgBuf[nInd]) : sImgRef.pImgBuf[nInd];
+    #else
+    anHdr[nInd] = sImgRef.pImgBuf[nInd];
+    #endif
+  }
+
+  uint32_t nW,nH;
+  if (eImgFmt == GSLC_IMGREF_FMT_BMP24) {
+    // Header of 16-bit height and width (native byte order),
+    // followed by RGB565 pixels
+    uint16_t anDim[2];
+    memcpy(anDim,anHdr,sizeof(anDim));
+    nH = anDim[0];
+    nW = anDim[1];
+    *pnPixels = nW * nH;
+    *pnBytes  = 4 + nW * nH * 2;
+  } else if (eImgFmt == GSLC_IMGREF_FMT_RAW1) {
+    // Header of 16-bit width and height (big-endian) and color,
+    // followed by 1-bit pixels with rows padded to a byte
+    nW = ((uint32_t)anHdr[0] << 8) | anHdr[1];
+    nH = ((uint32_t)anHdr[2] << 8) | anHdr[3];
+    *pnPixels = nW * nH;
+    *pnBytes  = 7 + nH * ((nW + 7) / 8);
+  } else if (eImgFmt == GSLC_IMGREF_FMT_RLE16) {
+    // Header of 16-bit height, width and run word count (native
+    // byte order), followed by the runs
+    uint16_t anDim[3];
+    memcpy(anDim,anHdr,sizeof(anDim));
+    nH = anDim[0];
+    nW = anDim[1];
+    *pnPixels = nW * nH;
+    *pnBytes  = 6 + (uint32_t)anDim[2] * 2;
+  }
+}
+
+#if (DRV_HAS_DRAW_POINT)
+bool gslc_DrvStatsDrawPoint(gslc_tsGui* pGui,int16_t nX,int16_t nY,gslc_tsColor nCol)
+{
+  uint32_t nStartUs = gslc_DrvStatsGetTimeUs();
+  bool bOk = gslc_DrvDrawPoint(pGui,nX,nY,nCol);
+  gslc_DrvStatsAdd(pGui,GSLC_DRV_STAT_POINT,nStartUs,1,0);
+  return bOk;
+}
+#endif
+
+#if (DRV_HAS_DRAW_POINTS)
+bool gslc_DrvStatsDrawPoints(gslc_tsGui* pGui,gslc_tsPt* asPt,uint16_t nNumPt,gslc_tsColor nCol)
+{
+  uint32_t nStartUs = gslc_DrvStatsGetTimeUs();
+  bool bOk = gslc_DrvDrawPoints(pGui,asPt,nNumPt,nCol);
+  gslc_DrvStatsAdd(pGui,GSLC_DRV_STAT_POINT,nStartUs,nNumPt,0);
+  return bOk;
+}
+#endif
+
+#if (DRV_HAS_DRAW_LINE)
+bool gslc_DrvStatsDrawLine(gslc_tsGui* pGui,int16_t nX0,int16_t nY0,int16_t nX1,int16_t nY1,gslc_tsColor nCol)
+{
+  uint32_t nStartUs = gslc_DrvStatsGetTimeUs();
+  bool bOk = gslc_DrvDrawLine(pGui,nX0,nY0,nX1,nY1,nCol);
+  uint32_t nDX = (nX1 > nX0)? nX1-nX0 : nX0-nX1;
+  uint32_t nDY = (nY1 > nY0)? nY1-nY0 : nY0-nY1;
+  gslc_DrvStatsAdd(pGui,GSLC_DRV_STAT_LINE,nStartUs,GSLC_MAX(nDX,nDY)+1,0);
+  return bOk;
+}
+#endif
+
+#if (DRV_HAS_DRAW_RECT_FRAME)
+bool gslc_DrvStatsDrawFrameRect(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColor nCol)
+{
+  uint32_t nStartUs = gslc_DrvStatsGetTimeUs();
+  bool bOk = gslc_DrvDrawFrameRect(pGui,rRect,nCol);
+  gslc_DrvStatsAdd(pGui,GSLC_DRV_STAT_FRAME,nStartUs,2*((uint32_t)rRect.w+rRect.h),0);
+  return bOk;
+}
+#endif
+
+#if (DRV_HAS_DRAW_RECT_FILL)
+bool gslc_DrvStatsDrawFillRect(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColor nCol)
+{
+  uint32_t nStartUs = gslc_DrvStatsGetTimeUs();
+  bool bOk = gslc_DrvDrawFillRect(pGui,rRect,nCol);
+  gslc_DrvStatsAdd(pGui,GSLC_DRV_STAT_FILL,nStartUs,(uint32_t)rRect.w*rRect.h,0);
+  return bOk;
+}
+#endif
+
+#if (DRV_HAS_DRAW_RECT_ROUND_FRAME)
+bool gslc_DrvStatsDrawFrameRoundRect(gslc_tsGui* pGui,gslc_tsRect rRect,int16_t nRadius,gslc_tsColor nCol)
+{
+  uint32_t nStartUs = gslc_DrvStatsGetTimeUs();
+  bool bOk = gslc_DrvDrawFrameRoundRect(pGui,rRect,nRadius,nCol);
+  gslc_DrvStatsAdd(pGui,GSLC_DRV_STAT_FRAME,nStartUs,2*((uint32_t)rRect.w+rRect.h),0);
+  return bOk;
+}
+#endif
+
+#if (DRV_HAS_DRAW_RECT_ROUND_FILL)
+bool gslc_DrvStatsDrawFillRoundRect(gslc_tsGui* pGui,gslc_tsRect rRect,int16_t nRadius,gslc_tsColor nCol)
+{
+  uint32_t nStartUs = gslc_DrvStatsGetTimeUs();
+  bool bOk = gslc_DrvDrawFillRoundRect(pGui,rRect,nRadius,nCol);
+  gslc_DrvStatsAdd(pGui,GSLC_DRV_STAT_FILL,nStartUs,(uint32_t)rRect.w*rRect.h,0);
+  return bOk;
+}
+#endif
+
+#if (DRV_HAS_DRAW_CIRCLE_FRAME)
+bool gslc_DrvStatsDrawFrameCircle(gslc_tsGui* pGui,int16_t nMidX,int16_t nMidY,uint16_t nRadius,gslc_tsColor nCol)
+{
+  uint32_t nStartUs = gslc_DrvStatsGetTimeUs();
+  bool bOk = gslc_DrvDrawFrameCircle(pGui,nMidX,nMidY,nRadius,nCol);
+  // Approximate the circumference as 2*pi*r
+  gslc_DrvStatsAdd(pGui,GSLC_DRV_STAT_FRAME,nStartUs,(uint32_t)nRadius*710/113,0);
+  return bOk;
+}
+#endif
+
+#if (DRV_HAS_DRAW_CIRCLE_FILL)
+bool gslc_DrvStatsDrawFillCircle(gslc_tsGui* pGui,int16_t nMidX,int16_t nMidY,uint16_t nRadius,gslc_tsColor nCol)
+{
+  uint32_t nStartUs = gslc_DrvStatsGetTimeUs();
+  bool bOk = gslc_DrvDrawFillCircle(pGui,nMidX,nMidY,nRadius,nCol);
+  // Approximate the area as pi*r^2
+  gslc_DrvStatsAdd(pGui,GSLC_DRV_STAT_FILL,nStartUs,(uint32_t)nRadius*nRadius*355/113,0);
+  return bOk;
+}
+#endif
+
+#if (DRV_HAS_DRAW_TRI_FRAME)
+bool gslc_DrvStatsDrawFrameTriangle(gslc_tsGui* pGui,int16_t nX0,int16_t nY0,
+        int16_t nX1,int16_t nY1,int16_t nX2,int16_t nY2,gslc_tsColor nCol)
+{
+  uint32_t nStartUs = gslc_DrvStatsGetTimeUs();
+  bool bOk = gslc_DrvDrawFrameTriangle(pGui,nX0,nY0,nX1,nY1,nX2,nY2,nCol);
+  // Approximate the perimeter by the longer axis of each edge
+  uint32_t nPixels = GSLC_MAX(abs(nX1-nX0),abs(nY1-nY0)) + GSLC_MAX(abs(nX2-nX1),abs(nY2-nY1)) +
+    GSLC_MAX(abs(nX0-nX2),abs(nY0-nY2));
+  gslc_DrvStatsAdd(pGui,GSLC_DRV_STAT_FRAME,nStartUs,nPixels,0);
+  return bOk;
+}
+#endif
+
+#if (DRV_HAS_DRAW_TRI_FILL)
+bool gslc_DrvStatsDrawFillTriangle(gslc_tsGui* pGui,int16_t nX0,int16_t nY0,
+        int16_t nX1,int16_t nY1,int16_t nX2,int16_t nY2,gslc_tsColor nCol)
+{
+  uint32_t nStartUs = gslc_DrvStatsGetTimeUs();
+  bool bOk = gslc_DrvDrawFillTriangle(pGui,nX0,nY0,nX1,nY1,nX2,nY2,nCol);
+  // Area from the cross product of two edges
+  int32_t nArea2 = (int32_t)(nX1-nX0)*(nY2-nY0) - (int32_t)(nX2-nX0)*(nY1-nY0);
+  gslc_DrvStatsAdd(pGui,GSLC_DRV_STAT_FILL,nStartUs,(uint32_t)((nArea2 < 0)? -nArea2 : nArea2)/2,0);
+  return bOk;
+}
+#endif
+
+#if (DRV_HAS_DRAW_TEXT)
+bool gslc_DrvStatsDrawTxt(gslc_tsGui* pGui,int16_t nTxtX,int16_t nTxtY,gslc_tsFont* pFont,const char* pStr,
+        gslc_teTxtFlags eTxtFlags,gslc_tsColor colTxt,gslc_tsColor colBg)
+{
+  uint32_t nStartUs = gslc_DrvStatsGetTimeUs();
+  bool bOk = gslc_DrvDrawTxt(pGui,nTxtX,nTxtY,pFont,pStr,eTxtFlags,colTxt,colBg);
+  // Measuring the text would cost as much as drawing it on some
+  // drivers, so text is not included in the pixel counts
+  gslc_DrvStatsAdd(pGui,GSLC_DRV_STAT_TXT,nStartUs,0,0);
+  return bOk;
+}
+#endif
+
+#if (DRV_OVERRIDE_TXT_ALIGN)
+bool gslc_DrvStatsDrawTxtAlign(gslc_tsGui* pGui,int16_t nX0,int16_t nY0,int16_t nX1,int16_t nY1,int8_t eTxtAlign,
+        gslc_tsFont* pFont,const char* pStr,gslc_teTxtFlags eTxtFlags,gslc_tsColor colTxt,gslc_tsColor colBg)
+{
+  uint32_t nStartUs = gslc_DrvStatsGetTimeUs();
+  bool bOk = gslc_DrvDrawTxtAlign(pGui,nX0,nY0,nX1,nY1,eTxtAlign,pFont,pStr,eTxtFlags,colTxt,colBg);
+  // Measuring the text would cost as much as drawing it on some
+  // drivers, so text is not included in the pixel counts
+  gslc_DrvStatsAdd(pGui,GSLC_DRV_STAT_TXT,nStartUs,0,0);
+  return bOk;
+}
+#endif
+
+bool gslc_DrvStatsDrawImage(gslc_tsGui* pGui,int16_t nDstX,int16_t nDstY,gslc_tsImgRef sImgRef)
+{
+  uint32_t nPixels,nImgBytes;
+  gslc_DrvStatsImgSize(sImgRef,&nPixels,&nImgBytes);
+  uint32_t nStartUs = gslc_DrvStatsGetTimeUs();
+  bool bOk = gslc_DrvDrawImage(pGui,nDstX,nDstY,sImgRef);
+  gslc_DrvStatsAdd(pGui,GSLC_DRV_STAT_IMG,nStartUs,nPixels,nImgBytes);
+  return bOk;
+}
+
+void gslc_DrvStatsDrawBkgnd(gslc_tsGui* pGui)
+{
+  uint32_t nPixels,nImgBytes;
+  gslc_DrvStatsImgSize(pGui->sImgRefBkgnd,&nPixels,&nImgBytes);
+  if (nPixels == 0) {
+    // Flat color or file-based background covers the display
+    nPixels = (uint32_t)pGui->nDispW * pGui->nDispH;
+  }
+  uint32_t nStartUs = gslc_DrvStatsGetTimeUs();
+  gslc_DrvDrawBkgnd(pGui);
+  gslc_DrvStatsAdd(pGui,GSLC_DRV_STAT_BKGND,nStartUs,nPixels,nImgBytes);
+}
+
+void gslc_DrvStatsPageFlipNow(gslc_tsGui* pGui)
+{
+  uint32_t nStartUs = gslc_DrvStatsGetTimeUs();
+  gslc_DrvPageFlipNow(pGui);
+  gslc_DrvStatsAdd(pGui,GSLC_DRV_STAT_FLIP,nStartUs,0,0);
+}
+
+#endif // GSLC_FEATURE_DRV_STATS
+
+
 // ============================================================================
 
 // Trigonometric lookup table for sin(x)
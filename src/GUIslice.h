@@ -68,6 +68,265 @@ extern "C" {
   #define GSLC_FEATURE_FOCUS_ON_TOUCH 1
 #endif
 
+// Provide default for the invalidation region list
+// - GSLC_INVALIDATE_RECT_MAX defines the maximum number of disjoint
+//   rectangles tracked in the invalidation region. Each rectangle
+//   results in a separate clipped redraw pass. Setting this to 1
+//   reverts to a single bounding box of all invalidated regions.
+// - GSLC_INVALIDATE_PASS_COST defines the approximate cost (in pixels)
+//   of performing an additional redraw pass. Nearby rectangles are
+//   combined if the additional area redrawn by merging them is less
+//   than this cost.
+#if !defined(GSLC_INVALIDATE_RECT_MAX)
+  #define GSLC_INVALIDATE_RECT_MAX 4
+#endif
+#if !defined(GSLC_INVALIDATE_PASS_COST)
+  #define GSLC_INVALIDATE_PASS_COST 1024
+#endif
+
+// Provide default for the collection dirty list
+// - GSLC_COLLECT_DIRTY_MAX defines the number of element references
+//   per collection that are tracked as requiring redraw. This avoids
+//   scanning every element in the page stack during each redraw.
+//   If more elements are marked, the collection falls back to
+//   scanning all of its elements. Set to 0 to disable tracking.
+#if !defined(GSLC_COLLECT_DIRTY_MAX)
+  #define GSLC_COLLECT_DIRTY_MAX 8
+#endif
+
+// Provide default for the touch hit-test grid
+// - When enabled, a page can be assigned a spatial index with
+//   gslc_PageSetHitGrid() to accelerate touch hit-testing
+#if !defined(GSLC_FEATURE_HIT_GRID)
+  #define GSLC_FEATURE_HIT_GRID 0
+#endif
+
+// Provide default for the Flash element cache
+// - GSLC_ELEM_PROG_CACHE_MAX defines the number of PROGMEM-based
+//   elements that are kept as RAM copies by gslc_GetElemFromRef().
+//   Repeated accesses to a cached element avoid another copy from
+//   Flash. Each entry consumes sizeof(gslc_tsElem) bytes of RAM.
+// - A pointer returned by gslc_GetElemFromRef() for a Flash element
+//   remains valid until GSLC_ELEM_PROG_CACHE_MAX other Flash
+//   elements have been fetched.
+#if !defined(GSLC_ELEM_PROG_CACHE_MAX)
+  #define GSLC_ELEM_PROG_CACHE_MAX 1
+#endif
+
+// Provide default for the element text extent cache
+// - GSLC_FEATURE_TXT_EXT_CACHE retains the text dimensions reported
+//   by gslc_DrvGetTxtSize() within each RAM-based element so that
+//   redraws of unchanged text skip the driver measurement.
+//   Each element consumes sizeof(gslc_tsTxtExtCache) additional bytes.
+#if !defined(GSLC_FEATURE_TXT_EXT_CACHE)
+  #if defined(__AVR__)
+    #define GSLC_FEATURE_TXT_EXT_CACHE 0
+  #else
+    #define GSLC_FEATURE_TXT_EXT_CACHE 1
+  #endif
+#endif
+
+// Provide defaults for the deferred event queue
+// - GSLC_EVENT_QUEUE_MAX defines the number of element touch events
+//   that can be deferred for handling within gslc_Update().
+//   Consecutive move events for the same element are coalesced into
+//   a single entry holding the latest position.
+// - GSLC_TOUCH_BUDGET_MS, when non-zero, replaces the GSLC_TOUCH_MAX_EVT
+//   limit on the number of inputs read per gslc_Update() with a time
+//   budget: input is read until none remains or the budget elapses.
+//   Move events read within the budget are coalesced before they are
+//   issued. AVR targets default to the GSLC_TOUCH_MAX_EVT limit.
+#if !defined(GSLC_EVENT_QUEUE_MAX)
+  #if defined(__AVR__)
+    #define GSLC_EVENT_QUEUE_MAX 2
+  #else
+    #define GSLC_EVENT_QUEUE_MAX 8
+  #endif
+#endif
+#if !defined(GSLC_TOUCH_BUDGET_MS)
+  #if defined(__AVR__)
+    #define GSLC_TOUCH_BUDGET_MS 0
+  #else
+    #define GSLC_TOUCH_BUDGET_MS 5
+  #endif
+#endif
+
+// Provide default for the time-budgeted update
+// - GSLC_FEATURE_UPDATE_BUDGET enables gslc_UpdateBudget(), which
+//   splits a page redraw into steps of one element so that it can
+//   be spread over several calls, and records the update and frame
+//   latency histograms.
+#if !defined(GSLC_FEATURE_UPDATE_BUDGET)
+  #if defined(__AVR__)
+    #define GSLC_FEATURE_UPDATE_BUDGET 0
+  #else
+    #define GSLC_FEATURE_UPDATE_BUDGET 1
+  #endif
+#endif
+
+// Provide defaults for the touch input filter
+// - GSLC_FEATURE_TOUCH_FILTER inserts a filter between the touch driver
+//   and the touch tracking. The defaults below pass the touch samples
+//   through unchanged; they can also be changed at runtime with
+//   gslc_SetTouchFilterPos() and gslc_SetTouchFilterPress().
+// - GSLC_TOUCH_FILTER_MEDIAN defines the number of samples in the
+//   median filter (1 to disable), up to GSLC_TOUCH_FILTER_MEDIAN_MAX
+// - GSLC_TOUCH_FILTER_SMOOTH defines the exponential smoothing shift:
+//   each sample moves the position by 1/2^N of the difference (0 to disable)
+// - GSLC_TOUCH_FILTER_MOVE_MIN defines the distance (pixels) that the
+//   position must change by before a move is reported
+// - GSLC_TOUCH_FILTER_PRESS_ON / GSLC_TOUCH_FILTER_PRESS_OFF define the
+//   pressure hysteresis: a touch starts once the pressure reaches
+//   PRESS_ON and ends once it falls to PRESS_OFF or below
+// - GSLC_TOUCH_FILTER_DEBOUNCE_MS defines the time a press or release
+//   must persist before it is reported
+#if !defined(GSLC_FEATURE_TOUCH_FILTER)
+  #if defined(__AVR__)
+    #define GSLC_FEATURE_TOUCH_FILTER 0
+  #else
+    #define GSLC_FEATURE_TOUCH_FILTER 1
+  #endif
+#endif
+#if !defined(GSLC_TOUCH_FILTER_MEDIAN_MAX)
+  #define GSLC_TOUCH_FILTER_MEDIAN_MAX 5
+#endif
+#if !defined(GSLC_TOUCH_FILTER_MEDIAN)
+  #define GSLC_TOUCH_FILTER_MEDIAN 1
+#endif
+#if !defined(GSLC_TOUCH_FILTER_SMOOTH)
+  #define GSLC_TOUCH_FILTER_SMOOTH 0
+#endif
+#if !defined(GSLC_TOUCH_FILTER_MOVE_MIN)
+  #define GSLC_TOUCH_FILTER_MOVE_MIN 0
+#endif
+#if !defined(GSLC_TOUCH_FILTER_PRESS_ON)
+  #define GSLC_TOUCH_FILTER_PRESS_ON 1
+#endif
+#if !defined(GSLC_TOUCH_FILTER_PRESS_OFF)
+  #define GSLC_TOUCH_FILTER_PRESS_OFF 0
+#endif
+#if !defined(GSLC_TOUCH_FILTER_DEBOUNCE_MS)
+  #define GSLC_TOUCH_FILTER_DEBOUNCE_MS 0
+#endif
+
+// Input wait
+// - GSLC_TOUCH_IRQ_PIN (not defined by default) can be defined in the
+//   config as the pin wired to an active-low touch controller interrupt
+//   (eg. XPT2046 T_IRQ). On Arduino targets whose driver can't wait for
+//   input, gslc_WaitEvent() then sleeps until the pin is asserted.
+
+// Provide default for incremental text redraw
+// - GSLC_FEATURE_TXT_INCR allows text elements that have been
+//   assigned state storage with gslc_ElemSetTxtIncr() to repaint
+//   only the characters that changed when their text is updated.
+//   Each element consumes one additional pointer.
+// - GSLC_TXT_INCR_LEN defines the longest string (including the
+//   terminator) that is tracked. Longer strings are redrawn in full.
+#if !defined(GSLC_FEATURE_TXT_INCR)
+  #if defined(__AVR__)
+    #define GSLC_FEATURE_TXT_INCR 0
+  #else
+    #define GSLC_FEATURE_TXT_INCR 1
+  #endif
+#endif
+#if !defined(GSLC_TXT_INCR_LEN)
+  #define GSLC_TXT_INCR_LEN 16
+#endif
+
+// Provide defaults for the point batch
+// - GSLC_FEATURE_PT_BATCH collects the points drawn by the emulated
+//   primitives (circle frames, lines and XGraph dots) so that they
+//   can be issued to the driver as horizontal and vertical runs with
+//   gslc_DrvDrawLine() / gslc_DrvDrawFillRect() rather than as
+//   individual gslc_DrvDrawPoint() calls, where each point pays the
+//   cost of setting up the display window. Drivers that support
+//   gslc_DrvDrawPoints() receive the whole batch in one call instead.
+// - GSLC_PT_BATCH_MAX defines the number of points collected before
+//   the batch is drawn. Each point consumes sizeof(gslc_tsPt) bytes.
+#if !defined(GSLC_FEATURE_PT_BATCH)
+  #if defined(__AVR__)
+    #define GSLC_FEATURE_PT_BATCH 0
+  #else
+    #define GSLC_FEATURE_PT_BATCH 1
+  #endif
+#endif
+#if !defined(GSLC_PT_BATCH_MAX)
+  #define GSLC_PT_BATCH_MAX 64
+#endif
+
+// Provide defaults for the decoded image cache
+// - GSLC_FEATURE_IMG_CACHE enables a cache of decoded images for the
+//   drivers that otherwise decode an image from external media each
+//   time it is drawn (eg. BMP files on SD card with the Adafruit-GFX
+//   and TFT_eSPI drivers). The pixels of the most recently drawn
+//   images are kept in the display's color format and the least
+//   recently used images are evicted to stay within the budget.
+// - GSLC_IMG_CACHE_MAX defines the number of images that can be cached
+// - GSLC_IMG_CACHE_BYTES defines the default memory budget (bytes) for
+//   the cached images. It can be changed at runtime with
+//   gslc_ImgCacheSetBudget(). Images that exceed the budget are
+//   drawn without caching.
+// - On ESP32 boards with PSRAM the cache is allocated from PSRAM
+#if !defined(GSLC_FEATURE_IMG_CACHE)
+  #if defined(__AVR__)
+    #define GSLC_FEATURE_IMG_CACHE 0
+  #else
+    #define GSLC_FEATURE_IMG_CACHE 1
+  #endif
+#endif
+#if !defined(GSLC_IMG_CACHE_MAX)
+  #define GSLC_IMG_CACHE_MAX 8
+#endif
+#if !defined(GSLC_IMG_CACHE_BYTES)
+  #if defined(ESP32) && defined(BOARD_HAS_PSRAM)
+    #define GSLC_IMG_CACHE_BYTES 1048576
+  #else
+    #define GSLC_IMG_CACHE_BYTES 16384
+  #endif
+#endif
+
+// Provide default for the driver instrumentation
+// - GSLC_FEATURE_DRV_STATS enables counting of the calls, pixels,
+//   image data and time spent in the display driver drawing APIs,
+//   broken down by primitive, redraw type and element ID.
+//   Defining DBG_FRAME_RATE also enables the instrumentation.
+// - GSLC_DRV_STATS_ELEM_MAX defines the number of element IDs that
+//   are tracked individually. Any further elements are combined.
+// - GSLC_DRV_STATS_DUMP_MS defines the interval between the reports
+//   output from gslc_Update(). Set to 0 to disable the reports.
+#if !defined(GSLC_FEATURE_DRV_STATS)
+  #if defined(DBG_FRAME_RATE)
+    #define GSLC_FEATURE_DRV_STATS 1
+  #else
+    #define GSLC_FEATURE_DRV_STATS 0
+  #endif
+#endif
+#if !defined(GSLC_DRV_STATS_ELEM_MAX)
+  #define GSLC_DRV_STATS_ELEM_MAX 8
+#endif
+#if !defined(GSLC_DRV_STATS_DUMP_MS)
+  #define GSLC_DRV_STATS_DUMP_MS 1000
+#endif
+
+// Provide default for the polygon fill
+// - GSLC_POLY_VERT_MAX defines the maximum number of vertices accepted
+//   by gslc_DrawFillPolygon(). The edge table is allocated on the stack
+//   and consumes approximately 20 bytes per vertex. Filled sectors are
+//   rasterized in chunks of (GSLC_POLY_VERT_MAX/2-1) segments.
+//   The minimum value is 4.
+#if !defined(GSLC_POLY_VERT_MAX)
+  #define GSLC_POLY_VERT_MAX 16
+#endif
+
+// Provide default for the polar vertex cache
+// - GSLC_POLAR_CACHE_RAD_MAX defines the maximum number of distinct
+//   radii that can be held by a gslc_tsPolarCache. The vertex storage
+//   itself is provided by the caller, enabling a tradeoff between
+//   memory and the quality (number of segments) that can be cached.
+#if !defined(GSLC_POLAR_CACHE_RAD_MAX)
+  #define GSLC_POLAR_CACHE_RAD_MAX 8
+#endif
+
 // Ensure that touch/input drivers have not been disabled if FEATURE_INPUT has been requested
 // - Either use DRV_TOUCH_INPUT if no touch-screen is used (but external pins are being used)
 // - Or select a DRV_TOUCH_* driver specific to the touch-screen device
@@ -475,12 +734,30 @@ typedef enum {
   GSLC_IMGREF_FMT_BMP16   = (2<<4),   ///< Image format is BMP (16-bit RGB565)
   GSLC_IMGREF_FMT_RAW1    = (3<<4),   ///< Image format is raw monochrome (1-bit)
   GSLC_IMGREF_FMT_JPG     = (4<<4),   ///< Image format is JPG (ESP32/ESP8366)
+  GSLC_IMGREF_FMT_RLE16   = (5<<4),   ///< Image format is run-length encoded RGB565
 
   // Mask values for bitfield comparisons
   GSLC_IMGREF_SRC         = (7<<0),   ///< Mask for Source flags
   GSLC_IMGREF_FMT         = (7<<4),   ///< Mask for Format flags
 } gslc_teImgRefFlags;
 
+// Run-length encoded RGB565 image format
+// - Images with GSLC_IMGREF_FMT_RLE16 are arrays of 16-bit words in
+//   native byte order (generated by tools/img2rle16)
+// - Header: height, width, number of run words that follow
+// - Each row is a sequence of runs covering the row width. A run
+//   starts with a word containing the run type and length (1..16383):
+//   - GSLC_IMG_RLE16_SKIP: transparent pixels (no data)
+//   - GSLC_IMG_RLE16_FILL: pixels of a single color (followed by the color)
+//   - GSLC_IMG_RLE16_COPY: literal pixels (followed by one color per pixel)
+// - Transparency is encoded explicitly, so GSLC_BMP_TRANS_EN does not
+//   apply to these images
+#define GSLC_IMG_RLE16_SKIP     0x0000  ///< Run of transparent pixels
+#define GSLC_IMG_RLE16_FILL     0x4000  ///< Run of a single color
+#define GSLC_IMG_RLE16_COPY     0x8000  ///< Run of literal colors
+#define GSLC_IMG_RLE16_TYPE     0xC000  ///< Mask for the run type
+#define GSLC_IMG_RLE16_LEN      0x3FFF  ///< Mask for the run length
+
 /// Text reference flags: Describes the characteristics of a text string
 /// (ie. whether internal to element or external and RAM vs Flash).)
 ///
@@ -559,6 +836,32 @@ typedef struct gslc_tsPt {
   int16_t   y;        ///< Y coordinate
 } gslc_tsPt;
 
+/// Cache of polar vertices used when drawing sectors
+/// - Holds the vertex offsets (relative to the center) at each
+///   segment boundary of a full circle for a number of radii
+/// - The vertex buffer is provided by the caller and holds
+///   nQuality vertices per cached radius
+typedef struct gslc_tsPolarCache {
+  gslc_tsPt*  asPt;                           ///< Vertex buffer (nQuality vertices per radius)
+  uint16_t    nPtMax;                         ///< Maximum number of vertices in buffer
+  uint16_t    nQuality;                       ///< Number of segments per full circle
+  uint8_t     nRadCnt;                        ///< Number of radii cached
+  int16_t     anRad[GSLC_POLAR_CACHE_RAD_MAX]; ///< Radius associated with each block of vertices
+} gslc_tsPolarCache;
+
+/// Edge table entry used during polygon scan conversion
+/// - The X intercept is tracked exactly as a rational value to
+///   ensure that adjacent polygons share identical edge pixels
+typedef struct gslc_tsPolyEdge {
+  int16_t   nYMin;    ///< First scanline crossed by the edge
+  int16_t   nYMax;    ///< Scanline following the last one crossed by the edge
+  int16_t   nX0;      ///< X coordinate at nYMin
+  int16_t   nDX;      ///< Change in X coordinate over the edge
+  int16_t   nDY;      ///< Change in Y coordinate over the edge (positive)
+  int16_t   nStepQ;   ///< Whole pixel change in X intercept per scanline
+  int16_t   nStepR;   ///< Fractional change in X intercept per scanline (in 1/nDY)
+} gslc_tsPolyEdge;
+
 /// Color structure. Defines RGB triplet.
 typedef struct gslc_tsColor {
   uint8_t r;      ///< RGB red value
@@ -566,6 +869,16 @@ typedef struct gslc_tsColor {
   uint8_t b;      ///< RGB blue value
 } gslc_tsColor;
 
+#if (GSLC_FEATURE_PT_BATCH)
+/// Points of a single color awaiting drawing
+/// - See gslc_DrawPointBatch()
+typedef struct gslc_tsPtBatch {
+  gslc_tsPt     asPt[GSLC_PT_BATCH_MAX];  ///< Points collected
+  uint16_t      nPtCnt;                   ///< Number of points in asPt[]
+  gslc_tsColor  nCol;                     ///< Color of the points
+} gslc_tsPtBatch;
+#endif // GSLC_FEATURE_PT_BATCH
+
 /// State associated with an element's region
 /// - This struct is used for gslc_ElemCalcRectState()
 /// - Accounts for various rects including
@@ -602,6 +915,51 @@ typedef struct gslc_tsEventTouch {
   int16_t           nY;               ///< Touch Y coordinate (or param2)
 } gslc_tsEventTouch;
 
+/// Deferred touch event
+typedef struct {
+  gslc_tsEvent        sEvent;         ///< Event (pvData is set to sTouch when issued)
+  gslc_tsEventTouch   sTouch;         ///< Touch data associated with the event
+} gslc_tsEventQueueEntry;
+
+/// Deferred event queue statistics
+typedef struct {
+  uint8_t             nDepth;         ///< Current number of queued events
+  uint8_t             nDepthMax;      ///< Maximum number of queued events observed
+  uint32_t            nQueued;        ///< Number of events added to the queue
+  uint32_t            nCoalesced;     ///< Number of move events merged into a queued move
+  uint32_t            nDropped;       ///< Number of queued move events discarded to make room
+  uint32_t            nForced;        ///< Number of events issued early to make room
+} gslc_tsEventQueueStats;
+
+#if (GSLC_FEATURE_IMG_CACHE)
+/// Decoded image cache entry
+/// - The entry is free if pPix is NULL
+typedef struct {
+  gslc_teImgRefFlags    eImgFlags;    ///< Image reference flags of the source image
+  const unsigned char*  pImgBuf;      ///< Source image buffer (for memory-based images)
+  char*                 pFname;       ///< Copy of the source pathname (for file-based images)
+  uint16_t*             pPix;         ///< Decoded pixels in display color format (row-major)
+  uint16_t              nW;           ///< Image width
+  uint16_t              nH;           ///< Image height
+  bool                  bTrans;       ///< Pixels equal to nTransRaw are transparent
+  uint16_t              nTransRaw;    ///< Transparent color in display color format
+  uint32_t              nBytes;       ///< Memory allocated for the entry
+  uint32_t              nSrcBytes;    ///< Bytes read from the source to decode the image
+  uint32_t              nLastUse;     ///< Value of the use counter when last drawn
+} gslc_tsImgCacheEntry;
+
+/// Decoded image cache statistics
+typedef struct {
+  uint8_t               nCnt;         ///< Current number of cached images
+  uint32_t              nBytesUsed;   ///< Current memory allocated for cached images
+  uint32_t              nBudget;      ///< Memory budget for cached images
+  uint32_t              nHit;         ///< Number of draws served from the cache
+  uint32_t              nMiss;        ///< Number of draws not found in the cache
+  uint32_t              nEvict;       ///< Number of images evicted to make room
+  uint32_t              nBytesSaved;  ///< Source bytes not read due to cache hits
+} gslc_tsImgCacheStats;
+#endif // GSLC_FEATURE_IMG_CACHE
+
 /// Font reference structure
 typedef struct {
   int16_t               nId;            ///< Font ID specified by user
@@ -627,6 +985,48 @@ typedef struct {
   gslc_teElemRefFlags   eElemFlags; ///< Element reference flags
 } gslc_tsElemRef;
 
+/// Text extent cache
+/// - Retains the result of gslc_DrvGetTxtSize() for an element's text
+/// - The entry is only used if the font, text flags and string hash
+///   match those of the text being drawn
+/// - The font is compared by its slot as well as the font reference and
+///   size held in the slot, so that gslc_FontSet() on the slot is noticed
+typedef struct {
+  bool                bValid;           ///< Entry contains a measurement
+  gslc_tsFont*        pFont;            ///< Font used in measurement
+  const void*         pvFont;           ///< Font reference used in measurement
+  uint16_t            nFontSize;        ///< Font size used in measurement
+  uint8_t             eFontRefMode;     ///< Font mode used in measurement
+  uint8_t             eTxtFlags;        ///< Text flags used in measurement
+  uint32_t            nHash;            ///< Hash of the measured string
+  int16_t             nTxtOffsetX;      ///< Text offset reported by driver (X)
+  int16_t             nTxtOffsetY;      ///< Text offset reported by driver (Y)
+  uint16_t            nTxtSzW;          ///< Text width reported by driver
+  uint16_t            nTxtSzH;          ///< Text height reported by driver
+} gslc_tsTxtExtCache;
+
+/// Incremental text redraw state
+/// - Retains the string last drawn in an element along with the
+///   position of each character so that a subsequent update only
+///   needs to repaint the characters that changed
+/// - Storage is provided by the user through gslc_ElemSetTxtIncr()
+typedef struct {
+  bool                bValid;           ///< State reflects the displayed text
+  char                acStr[GSLC_TXT_INCR_LEN];  ///< String as last drawn
+  int16_t             anEdgeX[GSLC_TXT_INCR_LEN]; ///< Right edge of each character (relative to nTxtX)
+  int16_t             nTxtX;            ///< Text origin used in last draw (X)
+  int16_t             nTxtY;            ///< Text origin used in last draw (Y)
+  gslc_tsRect         rInner;           ///< Element inner region used in last draw
+  gslc_tsFont*        pFont;            ///< Font used in last draw
+  gslc_tsColor        colTxt;           ///< Text color used in last draw
+  gslc_tsColor        colBg;            ///< Fill color used in last draw
+  gslc_tsColor        colFrm;           ///< Frame color used in last draw
+  gslc_tsColor        colFocus;         ///< Focus frame color used in last draw
+  bool                bGlowing;         ///< Glow state used in last draw
+  bool                bFocused;         ///< Focus state used in last draw
+  bool                bEditing;         ///< Edit state used in last draw
+} gslc_tsTxtIncr;
+
 ///
 /// Element Struct
 /// - Represents a single graphic element in the GUIslice environment
@@ -691,11 +1091,42 @@ typedef struct gslc_tsElem {
   GSLC_CB_DRAW        pfuncXDraw;       ///< Callback func ptr for custom drawing
   GSLC_CB_TOUCH       pfuncXTouch;      ///< Callback func ptr for touch
   GSLC_CB_TICK        pfuncXTick;       ///< Callback func ptr for timer/main loop tick
+
+  // NOTE: Fields after this point are not initialized by the
+  //       ElemCreate*_P() function macros and hence start zeroed
+  #if (GSLC_FEATURE_TXT_EXT_CACHE)
+  gslc_tsTxtExtCache  sTxtExtCache;     ///< Cached text dimensions (RAM elements only)
+  #endif
+  #if (GSLC_FEATURE_TXT_INCR)
+  gslc_tsTxtIncr*     pTxtIncr;         ///< Incremental text redraw state (or NULL if disabled)
+  #endif
 } gslc_tsElem;
 
 
 
 
+#if (GSLC_FEATURE_HIT_GRID)
+/// Calculate the storage (in bytes) required for a hit-test grid
+/// - nCols, nRows: Grid dimensions
+/// - nElemRefMax:  Maximum number of element references in the page
+#define GSLC_HITGRID_BUF_SIZE(nCols,nRows,nElemRefMax) ((nCols)*(nRows)*(((nElemRefMax)+7)/8))
+
+/// Hit-test grid struct
+/// - Divides the display into a uniform grid of cells. Each cell
+///   records (as a bitset indexed by element reference) the visible
+///   and clickable elements whose rect overlaps the cell.
+/// - This allows the element owning a touch coordinate to be found
+///   by testing only the few elements in the touched cell.
+typedef struct {
+  uint8_t*              pCellBuf;         ///< Storage for the cell bitsets (provided by user)
+  uint16_t              nCellBytes;       ///< Number of bytes in each cell bitset
+  uint8_t               nCols;            ///< Number of cell columns
+  uint8_t               nRows;            ///< Number of cell rows
+  uint16_t              nCellW;           ///< Width of each cell (pixels)
+  uint16_t              nCellH;           ///< Height of each cell (pixels)
+} gslc_tsHitGrid;
+#endif // GSLC_FEATURE_HIT_GRID
+
 /// Element collection struct
 /// - Collections are used to maintain a list of elements and any
 ///   touch tracking status.
@@ -716,6 +1147,17 @@ typedef struct {
   gslc_tsElemRef*       pElemRefTracked;  ///< Element reference currently being touch-tracked (NULL for none)
   int16_t               nElemIndTracked;  ///< Element index currently being touch-tracked (GSLC_IND_NONE for none)
 
+  #if (GSLC_FEATURE_HIT_GRID)
+  gslc_tsHitGrid*       pHitGrid;         ///< Optional hit-test grid (NULL for none)
+  #endif
+
+  // Redraw tracking
+  #if (GSLC_COLLECT_DIRTY_MAX > 0)
+  uint16_t              anElemRefDirty[GSLC_COLLECT_DIRTY_MAX]; ///< Indices of element references requiring redraw (in z-order)
+  uint16_t              nElemRefDirtyCnt; ///< Number of entries in anElemRefDirty[]
+  bool                  bElemRefDirtyAll; ///< Dirty list has overflowed so all element references must be checked
+  #endif
+
   // Callback functions
   //GSLC_CB_EVENT         pfuncXEvent;      ///< UNUSED: Callback func ptr for events
 
@@ -756,6 +1198,103 @@ typedef struct {
   int16_t               nActionVal;           ///< The value for the output action
 } gslc_tsInputMap;
 
+/// Tick registration
+/// - Describes an element that receives periodic tick callbacks
+///   from the tick scheduler (see gslc_InitTick())
+/// - The registrations are kept as a min-heap ordered by nDueMs
+typedef struct {
+  gslc_tsElemRef*       pElemRef;             ///< Element to receive the tick
+  gslc_tsPage*          pPage;                ///< Page containing the element
+  uint32_t              nDueMs;               ///< Time of the next tick (ms)
+  uint16_t              nPeriodMs;            ///< Interval between ticks (ms)
+  bool                  bVisibleOnly;         ///< Only tick while the page is in the page stack
+} gslc_tsTick;
+
+#if (GSLC_FEATURE_UPDATE_BUDGET)
+/// Number of bins in the latency histograms
+/// - Bin N counts durations from 2^N to 2^(N+1)-1 microseconds. The
+///   first bin also counts shorter durations and the last bin longer ones.
+#define GSLC_LATENCY_BIN_CNT 20
+
+/// Latency histograms recorded by gslc_UpdateBudget()
+typedef struct {
+  uint32_t            anUpdate[GSLC_LATENCY_BIN_CNT]; ///< Durations of gslc_UpdateBudget() calls
+  uint32_t            anFrame[GSLC_LATENCY_BIN_CNT];  ///< Durations from the start of a redraw to its page flip
+  uint32_t            nUpdateMaxUs;     ///< Longest gslc_UpdateBudget() call (microseconds)
+  uint32_t            nFrameMaxUs;      ///< Longest frame (microseconds)
+} gslc_tsLatencyStats;
+#endif // GSLC_FEATURE_UPDATE_BUDGET
+
+#if (GSLC_FEATURE_TOUCH_FILTER) && !defined(DRV_TOUCH_NONE)
+/// Touch input filter state
+/// - Positions are smoothed in fixed point with 4 fractional bits
+typedef struct {
+  // Configuration
+  uint8_t             nMedianLen;       ///< Number of samples in the median filter (1 to disable)
+  uint8_t             nSmoothShift;     ///< Exponential smoothing shift (0 to disable)
+  uint8_t             nMoveMin;         ///< Minimum change in position (pixels) to report a move
+  uint16_t            nPressOn;         ///< Pressure at which a touch starts
+  uint16_t            nPressOff;        ///< Pressure at or below which a touch ends
+  uint16_t            nDebounceMs;      ///< Time that a press or release must persist (ms)
+  // State
+  int16_t             anMedX[GSLC_TOUCH_FILTER_MEDIAN_MAX]; ///< Recent X samples
+  int16_t             anMedY[GSLC_TOUCH_FILTER_MEDIAN_MAX]; ///< Recent Y samples
+  uint8_t             nMedCnt;          ///< Number of samples in anMedX[] / anMedY[]
+  uint8_t             nMedInd;          ///< Index at which the next sample is stored
+  int32_t             nSmoothX;         ///< Smoothed X position (fixed point)
+  int32_t             nSmoothY;         ///< Smoothed Y position (fixed point)
+  bool                bPressed;         ///< A touch has been reported as started
+  int16_t             nOutX;            ///< Last reported X position
+  int16_t             nOutY;            ///< Last reported Y position
+  bool                bPend;            ///< A press / release is awaiting the debounce time
+  uint32_t            nPendMs;          ///< Time at which the pending transition was first seen
+  int16_t             nPendX;           ///< X position of the pending press
+  int16_t             nPendY;           ///< Y position of the pending press
+  uint16_t            nPendPress;       ///< Pressure of the pending press
+} gslc_tsTouchFilter;
+#endif // GSLC_FEATURE_TOUCH_FILTER
+
+
+#if (GSLC_FEATURE_DRV_STATS)
+/// Driver primitive groups for instrumentation
+typedef enum {
+  GSLC_DRV_STAT_POINT,      ///< Points (gslc_DrvDrawPoint, gslc_DrvDrawPoints)
+  GSLC_DRV_STAT_LINE,       ///< Lines
+  GSLC_DRV_STAT_FRAME,      ///< Outlined shapes (rect, rounded rect, circle, triangle)
+  GSLC_DRV_STAT_FILL,       ///< Filled shapes (rect, rounded rect, circle, triangle)
+  GSLC_DRV_STAT_TXT,        ///< Text rendering
+  GSLC_DRV_STAT_IMG,        ///< Images
+  GSLC_DRV_STAT_BKGND,      ///< Background redraw
+  GSLC_DRV_STAT_FLIP,       ///< Page flips
+  // Terminator
+  GSLC_DRV_STAT__MAX
+} gslc_teDrvStatPrim;
+
+/// Driver instrumentation counters
+typedef struct {
+  uint32_t            nCalls;           ///< Number of driver calls
+  uint32_t            nPixels;          ///< Number of pixels touched (estimated for shapes, excludes text)
+  uint32_t            nImgBytes;        ///< Number of bytes of image data drawn
+  uint32_t            nTimeUs;          ///< Time spent in the driver (microseconds)
+} gslc_tsDrvStat;
+
+/// Driver instrumentation counters for an element
+typedef struct {
+  int16_t             nElemId;          ///< Element ID
+  gslc_tsDrvStat      sStat;            ///< Counters for drawing of the element
+} gslc_tsDrvStatElem;
+
+/// Snapshot of the driver instrumentation
+typedef struct {
+  gslc_tsDrvStat      asPrim[GSLC_DRV_STAT__MAX];   ///< Counters by primitive group
+  gslc_tsDrvStat      asRedraw[GSLC_REDRAW_FOCUS+1]; ///< Counters by redraw type (GSLC_REDRAW_NONE for drawing outside of elements)
+  gslc_tsDrvStatElem  asElem[GSLC_DRV_STATS_ELEM_MAX]; ///< Counters by element ID
+  uint8_t             nElemCnt;         ///< Number of elements in asElem
+  gslc_tsDrvStat      sElemOther;       ///< Counters for elements that didn't fit in asElem
+  uint32_t            nUpdateCnt;       ///< Number of calls to gslc_Update()
+  uint32_t            nStartUs;         ///< Timestamp of the last reset (microseconds)
+} gslc_tsDrvStats;
+#endif // GSLC_FEATURE_DRV_STATS
 
 /// GUI structure
 /// - Contains all GUI state and content
@@ -783,6 +1322,9 @@ typedef struct {
     int16_t           nTouchCalYMax;   ///< Calibration Y maximum reading
     int16_t           nTouchCalPressMin;  ///< Calibration minimum pressure threshold
     int16_t           nTouchCalPressMax;  ///< Calibration maximum pressure threshold
+    #if (GSLC_FEATURE_TOUCH_FILTER)
+    gslc_tsTouchFilter sTouchFilter;   ///< Touch input filter
+    #endif
   #endif
 
   gslc_tsFont*        asFont;           ///< Collection of loaded fonts
@@ -798,7 +1340,15 @@ typedef struct {
   gslc_tsElemRef      sElemRefTmp;      ///< Temporary element reference
 #endif
 
-  gslc_tsElem         sElemTmpProg;     ///< Temporary element for Flash compatibility
+#if (GSLC_USE_PROGMEM)
+  // Flash element cache
+  gslc_tsElem         asElemProgCache[GSLC_ELEM_PROG_CACHE_MAX];  ///< RAM copies of Flash elements
+  const gslc_tsElem*  apElemProgCacheSrc[GSLC_ELEM_PROG_CACHE_MAX]; ///< Flash address of each cached element (NULL if unused)
+  uint16_t            anElemProgCacheUse[GSLC_ELEM_PROG_CACHE_MAX]; ///< Last-use stamp of each cached element
+  uint16_t            nElemProgCacheStamp; ///< Current last-use stamp
+  uint32_t            nElemProgCacheHit;   ///< Number of cache hits
+  uint32_t            nElemProgCacheMiss;  ///< Number of cache misses (copies from Flash)
+#endif
 
   gslc_teInitStat     eInitStatTouch;   ///< Status of touch initialization
   // TODO: exclude these in DRV_TOUCH_NONE
@@ -819,16 +1369,30 @@ typedef struct {
                                         ///< element has been updated prior to next
                                         ///< page redraw command.
 
-  // Pending events
-  bool                bEventPending;    ///< Is there an event pending?
-  gslc_tsEventTouch   sEventTouchPend;  ///< A touch event that has been deferred (if bEventPending=true)
-  gslc_tsEvent        sEventPend;       ///< An event that has been deferred (if bEventPending=true)
+  // Deferred events
+  gslc_tsEventQueueEntry asEvtQueue[GSLC_EVENT_QUEUE_MAX]; ///< Ring buffer of deferred touch events
+  uint8_t             nEvtQueueHead;    ///< Index of the oldest deferred event
+  uint8_t             nEvtQueueCnt;     ///< Number of deferred events
+  uint8_t             nEvtQueueHighCnt; ///< Number of deferred events other than moves
+  gslc_tsEventQueueStats sEvtQueueStats; ///< Deferred event queue statistics
+
+#if (GSLC_FEATURE_IMG_CACHE)
+  // Decoded image cache
+  gslc_tsImgCacheEntry asImgCache[GSLC_IMG_CACHE_MAX]; ///< Cached images
+  uint32_t            nImgCacheUse;     ///< Use counter for LRU eviction
+  uint32_t            nImgCacheBudget;  ///< Memory budget for cached images
+  gslc_tsImgCacheStats sImgCacheStats;  ///< Image cache statistics
+#endif
 
   // Primary surface definitions
   gslc_tsImgRef       sImgRefBkgnd;     ///< Image reference for background
 
-  uint8_t             nFrameRateCnt;    ///< Diagnostic frame rate count
-  uint8_t             nFrameRateStart;  ///< Diagnostic frame rate timestamp
+#if (GSLC_FEATURE_DRV_STATS)
+  // Driver instrumentation
+  gslc_tsDrvStats     sDrvStats;        ///< Driver call counters
+  int16_t             nDrvStatElemId;   ///< Element ID currently being drawn (GSLC_ID_NONE if none)
+  gslc_teRedrawType   eDrvStatRedraw;   ///< Redraw type currently being drawn
+#endif
 
 
   // Pages
@@ -846,7 +1410,40 @@ typedef struct {
 
   // Current clip region
   bool                bInvalidateEn;     ///< A region of the display has been invalidated
-  gslc_tsRect         rInvalidateRect;   ///< The rect region that has been invalidated
+  gslc_tsRect         arInvalidateRect[GSLC_INVALIDATE_RECT_MAX]; ///< Disjoint rect regions that have been invalidated
+  uint8_t             nInvalidateRectCnt; ///< Number of rect regions in arInvalidateRect[]
+  bool                bRedrawPassEn;     ///< A clipped redraw pass is in progress
+  gslc_tsRect         rRedrawPass;       ///< The rect region being redrawn (if bRedrawPassEn=true)
+  uint32_t            nRedrawPixCnt;     ///< Number of pixels covered by the last page redraw
+  gslc_tsRect         arExposeRect[GSLC_INVALIDATE_RECT_MAX]; ///< Regions exposed by transparent or hidden elements
+  uint8_t             nExposeRectCnt;    ///< Number of rect regions in arExposeRect[]
+
+#if (GSLC_FEATURE_PT_BATCH)
+  gslc_tsPtBatch      sPtBatch;          ///< Points awaiting drawing by emulated primitives
+#endif
+
+#if (GSLC_FEATURE_UPDATE_BUDGET)
+  // Redraw in progress across gslc_UpdateBudget() calls
+  bool                bRedrawStepActive; ///< A stepped page redraw is in progress
+  bool                bRedrawStepPage;   ///< The redraw in progress is a full page redraw
+  bool                bRedrawStepClip;   ///< The passes are clipped to arRedrawStepPass[]
+  bool                bRedrawStepBkgnd;  ///< The background of the current pass is yet to be drawn
+  gslc_tsRect         arRedrawStepPass[GSLC_INVALIDATE_RECT_MAX]; ///< Invalidated regions when the redraw began
+  uint8_t             nRedrawStepPassCnt; ///< Number of passes in the redraw
+  uint8_t             nRedrawStepPass;   ///< Index of the current pass
+  gslc_tsRect         arRedrawStepExpose[GSLC_INVALIDATE_RECT_MAX]; ///< Exposed regions when the redraw began
+  uint8_t             nRedrawStepExposeCnt; ///< Number of rect regions in arRedrawStepExpose[]
+  uint8_t             nRedrawStepStack;  ///< Index of the current page in the stack
+  uint16_t            nRedrawStepElem;   ///< Index of the next element reference to check
+  bool                bRedrawStepScan;   ///< The current page is scanned in full rather than through its dirty list
+  uint32_t            nRedrawStepStartUs; ///< Time that the redraw began (microseconds)
+  gslc_tsLatencyStats sLatencyStats;     ///< Update and frame latency histograms
+#endif
+
+  // Tick scheduler
+  gslc_tsTick*        asTick;           ///< Heap of tick registrations (NULL to tick all pages)
+  uint16_t            nTickMax;         ///< Maximum number of tick registrations
+  uint16_t            nTickCnt;         ///< Current number of tick registrations
 
   // Callback functions
   //GSLC_CB_EVENT       pfuncXEvent;      ///< UNUSED: Callback func ptr for events
@@ -878,8 +1475,8 @@ typedef struct {
 } gslc_tsGui;
 
 
-#define GSLC_MIN(a,b) (a<b)?a:b
-#define GSLC_MAX(a,b) (a>b)?a:b
+#define GSLC_MIN(a,b) (((a)<(b))?(a):(b))
+#define GSLC_MAX(a,b) (((a)>(b))?(a):(b))
 
 // ------------------------------------------------------------------------
 /// \defgroup _GeneralFunc_ General Functions
@@ -1025,6 +1622,192 @@ void gslc_Quit(gslc_tsGui* pGui);
 ///
 void gslc_Update(gslc_tsGui* pGui);
 
+///
+/// Wait for input or other work for gslc_Update()
+/// - Allows the main loop to sleep rather than continuously polling,
+///   eg. by calling gslc_WaitEvent() before each gslc_Update()
+/// - Returns immediately if a redraw or deferred event is pending
+/// - The wait ends early when the next tick registered with gslc_TickAdd()
+///   is due, or when a debounced touch transition completes
+/// - The driver waits for input where it supports this (DRV_HAS_WAIT_INPUT).
+///   On other targets, an active-low touch interrupt pin can be defined in
+///   GSLC_TOUCH_IRQ_PIN. Otherwise the input can only be polled, so the
+///   function returns immediately (as it does when a pin poll callback
+///   has been assigned).
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nTimeoutMs:  Maximum time to wait (ms)
+///
+/// \return true if input or other work may be pending, false if the timeout elapsed
+///
+bool gslc_WaitEvent(gslc_tsGui* pGui,uint32_t nTimeoutMs);
+
+#if (GSLC_FEATURE_UPDATE_BUDGET)
+///
+/// Perform main GUIslice handling functions within a time budget
+/// - Handles any touch events and ticks as per gslc_Update()
+/// - Redraws the elements one at a time until the budget has elapsed.
+///   The redraw resumes on the next call, so input continues to be
+///   handled while a long redraw is in progress.
+/// - The page flip occurs once the redraw is complete
+/// - Changes made while a redraw is in progress are drawn in the
+///   following redraw, except for a full page redraw request, which
+///   restarts the redraw in progress
+/// - Requires GSLC_FEATURE_UPDATE_BUDGET
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nBudgetUs:   Time budget for the call (microseconds).
+///                          At least one element is drawn per call.
+///
+/// \return true if the display is up to date, false if a redraw is in progress
+///
+bool gslc_UpdateBudget(gslc_tsGui* pGui,uint32_t nBudgetUs);
+
+///
+/// Fetch a percentile of the latencies recorded by gslc_UpdateBudget()
+/// - The result is the upper bound of the histogram bin in which the
+///   percentile lies (limited to the longest latency recorded)
+/// - Requires GSLC_FEATURE_UPDATE_BUDGET
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  bFrame:      Report the frame latency (from the start of a redraw
+///                          to its page flip) instead of the duration of the calls
+/// \param[in]  nPercent:    Percentile (0..100)
+///
+/// \return Latency in microseconds (0 if none recorded)
+///
+uint32_t gslc_UpdateLatencyGet(gslc_tsGui* pGui,bool bFrame,uint8_t nPercent);
+
+///
+/// Reset the latencies recorded by gslc_UpdateBudget()
+/// - Requires GSLC_FEATURE_UPDATE_BUDGET
+///
+/// \param[in]  pGui:        Pointer to GUI
+///
+/// \return none
+///
+void gslc_UpdateLatencyReset(gslc_tsGui* pGui);
+#endif // GSLC_FEATURE_UPDATE_BUDGET
+
+
+///
+/// Fetch the deferred event queue statistics
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[out] pStats:      Pointer to structure that receives the statistics
+///
+/// \return none
+///
+void gslc_EventQueueGetStats(gslc_tsGui* pGui,gslc_tsEventQueueStats* pStats);
+
+///
+/// Reset the deferred event queue statistics
+///
+/// \param[in]  pGui:        Pointer to GUI
+///
+/// \return none
+///
+void gslc_EventQueueResetStats(gslc_tsGui* pGui);
+
+///
+/// Enable the tick scheduler
+/// - By default, gslc_Update() issues a tick event to every element
+///   on every page, whether or not it has a tick callback
+/// - Once the scheduler is enabled, only the elements registered
+///   with gslc_TickAdd() receive ticks, at their requested period
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  asTick:      Pointer to the tick registration table
+/// \param[in]  nTickMax:    Total number of entries in registration table
+///
+/// \return none
+///
+void gslc_InitTick(gslc_tsGui* pGui,gslc_tsTick* asTick,uint16_t nTickMax);
+
+///
+/// Register an element with the tick scheduler
+/// - The element's tick callback (see gslc_ElemSetTickFunc()) is
+///   called from gslc_Update() once every nPeriodMs milliseconds
+/// - If the element is already registered, its period and
+///   visibility mode are updated
+/// - Requires gslc_InitTick()
+///
+/// \param[in]  pGui:         Pointer to GUI
+/// \param[in]  nPageId:      Page ID containing the element
+/// \param[in]  pElemRef:     Pointer to Element reference
+/// \param[in]  nPeriodMs:    Interval between ticks (0 for every call to gslc_Update)
+/// \param[in]  bVisibleOnly: Only tick while the page is in the page stack
+///
+/// \return true if success, false if error
+///
+bool gslc_TickAdd(gslc_tsGui* pGui,int16_t nPageId,gslc_tsElemRef* pElemRef,uint16_t nPeriodMs,bool bVisibleOnly);
+
+///
+/// Unregister an element from the tick scheduler
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  pElemRef:    Pointer to Element reference
+///
+/// \return true if the element was registered, false otherwise
+///
+bool gslc_TickRemove(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef);
+
+///
+/// Fetch a millisecond timestamp
+/// - The value wraps around, so only differences between
+///   timestamps are meaningful
+///
+/// \return Time in milliseconds
+///
+uint32_t gslc_GetTimeMs();
+
+///
+/// Fetch a microsecond timestamp
+/// - The value wraps around, so only differences between
+///   timestamps are meaningful
+///
+/// \return Time in microseconds
+///
+uint32_t gslc_GetTimeUs();
+
+
+#if (GSLC_FEATURE_DRV_STATS)
+///
+/// Fetch a snapshot of the driver instrumentation counters
+/// - Requires GSLC_FEATURE_DRV_STATS
+///
+/// \param[in]  pGui:    Pointer to GUI
+/// \param[out] pStats:  Pointer to structure that receives the counters
+///
+/// \return none
+///
+void gslc_DrvStatsGet(gslc_tsGui* pGui,gslc_tsDrvStats* pStats);
+
+
+///
+/// Reset the driver instrumentation counters
+/// - Requires GSLC_FEATURE_DRV_STATS
+///
+/// \param[in]  pGui:    Pointer to GUI
+///
+/// \return none
+///
+void gslc_DrvStatsReset(gslc_tsGui* pGui);
+
+
+///
+/// Output a report of the driver instrumentation counters
+/// - Requires GSLC_FEATURE_DRV_STATS
+/// - The report is written via gslc_DebugPrintf() and is also
+///   output periodically by gslc_Update() (see GSLC_DRV_STATS_DUMP_MS)
+///
+/// \param[in]  pGui:    Pointer to GUI
+///
+/// \return none
+///
+void gslc_DrvStatsDump(gslc_tsGui* pGui);
+#endif // GSLC_FEATURE_DRV_STATS
+
 
 ///
 /// Configure the background to use a bitmap image
@@ -1145,6 +1928,16 @@ bool gslc_IsInWH(int16_t nSelX,int16_t nSelY,uint16_t nWidth,uint16_t nHeight);
 ///
 void gslc_UnionRect(gslc_tsRect* pRect, gslc_tsRect rAddRect);
 
+///
+/// Determine if two rects overlap
+///
+/// \param[in]  rRect1:   First rect region
+/// \param[in]  rRect2:   Second rect region
+///
+/// \return true if the regions share at least one pixel, false otherwise
+///
+bool gslc_IsRectOverlap(gslc_tsRect rRect1, gslc_tsRect rRect2);
+
 ///
 /// Reset the invalidation region
 ///
@@ -1176,6 +1969,11 @@ void gslc_InvalidateRgnScreen(gslc_tsGui* pGui);
 ///
 /// Add a rectangular region to the invalidation region
 /// - This is usually called when an element has been modified
+/// - The invalidation region is maintained as a list of up to
+///   GSLC_INVALIDATE_RECT_MAX disjoint rectangles. Overlapping
+///   rectangles are always combined, nearby rectangles are combined
+///   if the extra area is less than GSLC_INVALIDATE_PASS_COST and
+///   the cheapest pair is combined when the list is full.
 ///
 /// \param[in]  pGui:     Pointer to GUI
 /// \param[in]  rAddRect: Rectangle to add to the invalidation region
@@ -1246,6 +2044,9 @@ gslc_tsImgRef gslc_GetImageFromSD(const char* pFname,gslc_teImgRefFlags eFmt);
 
 ///
 /// Create an image reference to a bitmap in SRAM
+/// - Some drivers share the converted image between elements that
+///   reference the same buffer, so the buffer contents should not be
+///   modified once the image has been loaded
 ///
 /// \param[in]   pImgBuf      Pointer to image buffer in memory
 /// \param[in]   eFmt         Image format
@@ -1265,6 +2066,70 @@ gslc_tsImgRef gslc_GetImageFromRam(unsigned char* pImgBuf,gslc_teImgRefFlags eFm
 ///
 gslc_tsImgRef gslc_GetImageFromProg(const unsigned char* pImgBuf,gslc_teImgRefFlags eFmt);
 
+///
+/// Load a set of in-memory images ahead of use
+/// - On drivers with DRV_HAS_IMG_PRELOAD the images are converted now
+///   and kept resident, so that elements referencing them later don't
+///   convert them again
+/// - On other drivers this does nothing
+/// - Should be called after gslc_Init() and before the pages are created
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  asImgRef:    Array of image references
+/// \param[in]  nNumImg:     Number of image references in the array
+///
+/// \return true if all images were loaded (or preloading is not
+///         supported by the driver), false if any failed
+///
+bool gslc_ImagePreload(gslc_tsGui* pGui,const gslc_tsImgRef* asImgRef,uint16_t nNumImg);
+
+#if (GSLC_FEATURE_IMG_CACHE)
+///
+/// Set the memory budget of the decoded image cache
+/// - Least recently used images are evicted until the cache fits
+///   within the new budget
+/// - Requires GSLC_FEATURE_IMG_CACHE
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nBytes:      Memory budget in bytes (0 to disable caching)
+///
+/// \return none
+///
+void gslc_ImgCacheSetBudget(gslc_tsGui* pGui,uint32_t nBytes);
+
+///
+/// Release all images held in the decoded image cache
+/// - Should be called if the image files are modified
+/// - Requires GSLC_FEATURE_IMG_CACHE
+///
+/// \param[in]  pGui:        Pointer to GUI
+///
+/// \return none
+///
+void gslc_ImgCacheClear(gslc_tsGui* pGui);
+
+///
+/// Fetch the decoded image cache statistics
+/// - Requires GSLC_FEATURE_IMG_CACHE
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[out] pStats:      Pointer to structure that receives the statistics
+///
+/// \return none
+///
+void gslc_ImgCacheGetStats(gslc_tsGui* pGui,gslc_tsImgCacheStats* pStats);
+
+///
+/// Reset the decoded image cache hit, miss, eviction and saving counters
+/// - Requires GSLC_FEATURE_IMG_CACHE
+///
+/// \param[in]  pGui:        Pointer to GUI
+///
+/// \return none
+///
+void gslc_ImgCacheResetStats(gslc_tsGui* pGui);
+#endif // GSLC_FEATURE_IMG_CACHE
+
 
 
 
@@ -1280,6 +2145,60 @@ gslc_tsImgRef gslc_GetImageFromProg(const unsigned char* pImgBuf,gslc_teImgRefFl
 ///
 void gslc_PolarToXY(uint16_t nRad,int16_t n64Ang,int16_t* nDX,int16_t* nDY);
 
+///
+/// Initialize a polar vertex cache
+/// - A cache holding vertices for nQuality segments and N distinct
+///   radii requires a buffer of nQuality*N points
+///
+/// \param[in]  pCache:      Pointer to polar cache
+/// \param[in]  asPt:        Buffer of points to hold the vertices (or NULL to disable)
+/// \param[in]  nPtMax:      Maximum number of points in asPt
+///
+/// \return none
+///
+void gslc_PolarCacheInit(gslc_tsPolarCache* pCache,gslc_tsPt* asPt,uint16_t nPtMax);
+
+///
+/// Invalidate the vertices held in a polar vertex cache
+/// - Should be called when the radii used with the cache change
+///
+/// \param[in]  pCache:      Pointer to polar cache
+///
+/// \return none
+///
+void gslc_PolarCacheReset(gslc_tsPolarCache* pCache);
+
+///
+/// Fetch the cached vertices for a radius, calculating them if needed
+/// - If the cache holds a different quality, it is reset first
+/// - Caching is only supported for qualities where 360/nQuality is
+///   an integer result
+///
+/// \param[in]  pCache:      Pointer to polar cache
+/// \param[in]  nQuality:    Number of segments per full circle
+/// \param[in]  nRad:        Radius
+///
+/// \return Pointer to nQuality vertex offsets (starting at 0 degrees and
+///         proceeding clockwise) or NULL if the radius could not be cached
+///
+gslc_tsPt* gslc_PolarCacheGet(gslc_tsPolarCache* pCache,uint16_t nQuality,int16_t nRad);
+
+///
+/// Convert a segment boundary on a circle to cartesian
+/// - Segment boundaries are located at multiples of (360/nQuality) degrees
+///
+/// \param[in]   asRing       Cached vertices for the radius from gslc_PolarCacheGet()
+///                           or NULL to calculate the vertex
+/// \param[in]   nQuality     Number of segments per full circle
+/// \param[in]   nRad         Radius of ray
+/// \param[in]   nSegInd      Index of segment boundary (0 is up)
+/// \param[out]  pnDX         X offset for ray end
+/// \param[out]  pnDY         Y offset for ray end
+///
+/// \return none
+///
+void gslc_PolarSegToXY(gslc_tsPt* asRing,uint16_t nQuality,uint16_t nRad,int16_t nSegInd,int16_t* pnDX,int16_t* pnDY);
+
 
 ///
 /// Calculate fixed-point sine function from fractional degrees
@@ -1373,15 +2292,44 @@ void gslc_DrawSetPixel(gslc_tsGui* pGui,int16_t nX,int16_t nY,gslc_tsColor nCol)
 
 
 ///
-/// Draw an arbitrary line using Bresenham's algorithm
+/// Add a pixel to the point batch
+/// - The points are drawn once the batch is full, the color changes
+///   or gslc_DrawPointBatchFlush() is called. Runs of adjacent points
+///   are drawn as lines.
+/// - Callers must call gslc_DrawPointBatchFlush() before drawing
+///   anything else so that the drawing order is preserved
+/// - Without GSLC_FEATURE_PT_BATCH the pixel is drawn immediately
 ///
 /// \param[in]  pGui:        Pointer to GUI
-/// \param[in]  nX0:         X coordinate of line startpoint
-/// \param[in]  nY0:         Y coordinate of line startpoint
-/// \param[in]  nX1:         X coordinate of line endpoint
-/// \param[in]  nY1:         Y coordinate of line endpoint
-/// \param[in]  nCol:        Color RGB value for the line
-///
+/// \param[in]  nX:          Pixel X coordinate to set
+/// \param[in]  nY:          Pixel Y coordinate to set
+/// \param[in]  nCol:        Color pixel value to assign
+///
+/// \return none
+///
+void gslc_DrawPointBatch(gslc_tsGui* pGui,int16_t nX,int16_t nY,gslc_tsColor nCol);
+
+
+///
+/// Draw any points remaining in the point batch
+///
+/// \param[in]  pGui:        Pointer to GUI
+///
+/// \return none
+///
+void gslc_DrawPointBatchFlush(gslc_tsGui* pGui);
+
+
+///
+/// Draw an arbitrary line using Bresenham's algorithm
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nX0:         X coordinate of line startpoint
+/// \param[in]  nY0:         Y coordinate of line startpoint
+/// \param[in]  nX1:         X coordinate of line endpoint
+/// \param[in]  nY1:         Y coordinate of line endpoint
+/// \param[in]  nCol:        Color RGB value for the line
+///
 /// \return none
 ///
 void gslc_DrawLine(gslc_tsGui* pGui,int16_t nX0,int16_t nY0,int16_t nX1,int16_t nY1,gslc_tsColor nCol);
@@ -1529,6 +2477,7 @@ void gslc_DrawFrameTriangle(gslc_tsGui* pGui,int16_t nX0,int16_t nY0,
 
 ///
 /// Draw a filled triangle
+/// - Pixels on all three edges are included
 ///
 /// \param[in]  pGui:        Pointer to GUI
 /// \param[in]  nX0:         X Coordinate #1
@@ -1568,6 +2517,44 @@ void gslc_DrawFrameQuad(gslc_tsGui* pGui,gslc_tsPt* psPt,gslc_tsColor nCol);
 ///
 void gslc_DrawFillQuad(gslc_tsGui* pGui,gslc_tsPt* psPt,gslc_tsColor nCol);
 
+///
+/// Draw a filled polygon
+/// - Supports both convex and concave polygons. Self-intersecting
+///   polygons are filled according to the even-odd rule.
+/// - Pixels are filled if their center lies inside the polygon,
+///   with vertices located at pixel centers. Pixels on the left and
+///   top edges are included while those on the right and bottom edges
+///   are excluded, so polygons that share an edge do not overlap.
+/// - Spans are emitted to the driver as filled rectangles, with
+///   identical spans on consecutive rows combined into one rectangle.
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  asPt:        Pointer to array of points
+/// \param[in]  nNumPt:      Number of points in array (3..GSLC_POLY_VERT_MAX)
+/// \param[in]  nCol:        Color RGB value for the fill
+///
+/// \return none
+///
+void gslc_DrawFillPolygon(gslc_tsGui* pGui,gslc_tsPt* asPt,uint16_t nNumPt,gslc_tsColor nCol);
+
+///
+/// Draw a filled polygon with a choice of edge coverage
+/// - As gslc_DrawFillPolygon(), except that pixels whose center lies
+///   exactly on any edge (including the right and bottom edges) can
+///   also be filled. Used for the emulated triangle, quad and sector
+///   fills so that they retain the edge-inclusive coverage of the
+///   driver fills.
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  asPt:        Pointer to array of points
+/// \param[in]  nNumPt:      Number of points in array (3..GSLC_POLY_VERT_MAX)
+/// \param[in]  nCol:        Color RGB value for the fill
+/// \param[in]  bEdgeIncl:   Include pixels on the right and bottom edges
+///
+/// \return none
+///
+void gslc_DrawFillPolygonBase(gslc_tsGui* pGui,gslc_tsPt* asPt,uint16_t nNumPt,gslc_tsColor nCol,bool bEdgeIncl);
+
 ///
 /// Draw a gradient filled sector of a circle with support for inner and outer radius
 /// - Can be used to create a ring or pie chart
@@ -1625,6 +2612,52 @@ void gslc_DrawFillGradSector(gslc_tsGui* pGui, int16_t nQuality, int16_t nMidX,
 void gslc_DrawFillSector(gslc_tsGui* pGui, int16_t nQuality, int16_t nMidX, int16_t nMidY, int16_t nRad1, int16_t nRad2,
   gslc_tsColor cArc, int16_t nAngSecStart, int16_t nAngSecEnd);
 
+///
+/// Draw a flat or gradient filled sector of a circle, optionally using
+/// a cache of the polar vertices
+/// - Called by gslc_DrawFillSector() and gslc_DrawFillGradSector()
+/// - Elements that repeatedly draw sectors with the same radii
+///   can provide a polar cache to avoid recalculating the vertices
+///
+/// \param[in]  pGui:          Pointer to GUI
+/// \param[in]  nQuality:      Number of segments used to depict a full circle
+/// \param[in]  nMidX:         Midpoint X coordinate of circle
+/// \param[in]  nMidY:         Midpoint Y coordinate of circle
+/// \param[in]  nRad1:         Inner sector radius (0 for sector / pie, non-zero for ring)
+/// \param[in]  nRad2:         Outer sector radius
+/// \param[in]  cArcStart:     Color for flat fill or start color for gradient fill
+/// \param[in]  cArcEnd:       End color for gradient fill
+/// \param[in]  bGradient:     Gradient fill if true, flat fill otherwise
+/// \param[in]  nAngGradStart: For gradient fill, defines the starting angle associated with the starting color
+/// \param[in]  nAngGradRange: For gradient fill, defines the angular range associated with the color range
+/// \param[in]  nAngSecStart:  Angle of start of sector drawing (0 at top), measured in degrees.
+/// \param[in]  nAngSecEnd:    Angle of end of sector drawing (0 at top), measured in degrees.
+/// \param[in]  pCache:        Pointer to polar cache (or NULL to calculate vertices)
+///
+/// \return none
+///
+void gslc_DrawFillSectorBase(gslc_tsGui* pGui, int16_t nQuality, int16_t nMidX, int16_t nMidY, int16_t nRad1, int16_t nRad2,
+  gslc_tsColor cArcStart, gslc_tsColor cArcEnd, bool bGradient, int16_t nAngGradStart, int16_t nAngGradRange,
+  int16_t nAngSecStart, int16_t nAngSecEnd, gslc_tsPolarCache* pCache);
+
+///
+/// Draw a monochrome image with an opaque background
+/// - Set bits are drawn in the foreground color defined in the image
+///   header and unset bits in the background color
+/// - Drivers with DRV_HAS_DRAW_MONO_OPAQUE expand the rows into a
+///   line buffer and push them as blocks. Other drivers fill the
+///   image region before drawing the set bits.
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nDstX:       X coordinate of image
+/// \param[in]  nDstY:       Y coordinate of image
+/// \param[in]  sImgRef:     Image reference (GSLC_IMGREF_FMT_RAW1 in RAM or PROGMEM)
+/// \param[in]  colBg:       Color for unset bits
+///
+/// \return true if success, false if error
+///
+bool gslc_DrawImageMonoOpaque(gslc_tsGui* pGui,int16_t nDstX,int16_t nDstY,gslc_tsImgRef sImgRef,gslc_tsColor colBg);
+
 // -----------------------------------------------------------------------
 /// @}
 /// \defgroup _Font_ Font Functions
@@ -1824,6 +2857,18 @@ void gslc_PageRedrawSet(gslc_tsGui* pGui,bool bRedraw);
 bool gslc_PageRedrawGet(gslc_tsGui* pGui);
 
 
+///
+/// Get the number of pixels covered by the most recent page redraw
+/// - This is the total area of the clipped redraw passes and can be
+///   used to measure the effectiveness of partial redraw
+///
+/// \param[in]  pGui:        Pointer to GUI
+///
+/// \return Number of pixels redrawn during the last call to gslc_PageRedrawGo()
+///
+uint32_t gslc_PageRedrawPixGet(gslc_tsGui* pGui);
+
+
 
 /// Add a page to the GUI
 /// - This call associates an element array with the collection within the page
@@ -1850,6 +2895,36 @@ bool gslc_PageRedrawGet(gslc_tsGui* pGui);
 void gslc_PageAdd(gslc_tsGui* pGui,int16_t nPageId,gslc_tsElem* psElem,uint16_t nMaxElem,
         gslc_tsElemRef* psElemRef,uint16_t nMaxElemRef);
 
+#if (GSLC_FEATURE_HIT_GRID)
+///
+/// Assign a hit-test grid to a page to accelerate touch handling
+/// - The display is divided into nCols x nRows cells and each cell
+///   tracks the elements that overlap it. Touch hit-testing then only
+///   needs to examine the elements in the touched cell rather than
+///   every element on the page.
+/// - The grid is built immediately from the elements already on the
+///   page and is kept up to date as elements are added or changed
+///   with gslc_ElemSetRect(), gslc_ElemSetVisible() or gslc_ElemSetClickEn().
+///   It is therefore best called once all elements have been created.
+/// - Must be called after gslc_Init() so that the display dimensions
+///   are known
+///
+/// \param[in]  pGui:         Pointer to GUI
+/// \param[in]  nPageId:      Page ID to assign the grid to
+/// \param[in]  pHitGrid:     Pointer to the grid struct (must be static)
+/// \param[in]  pCellBuf:     Storage for the grid cells (must be static)
+/// \param[in]  nCellBufSize: Size of pCellBuf in bytes. Must be at least
+///                           GSLC_HITGRID_BUF_SIZE(nCols,nRows,nMaxElemRef)
+///                           where nMaxElemRef is the page's element reference count.
+/// \param[in]  nCols:        Number of grid columns
+/// \param[in]  nRows:        Number of grid rows
+///
+/// \return true if success, false if error
+///
+bool gslc_PageSetHitGrid(gslc_tsGui* pGui,int16_t nPageId,gslc_tsHitGrid* pHitGrid,
+  uint8_t* pCellBuf,uint16_t nCellBufSize,uint8_t nCols,uint8_t nRows);
+#endif // GSLC_FEATURE_HIT_GRID
+
 /// Find an element in the GUI by its Page ID and Element ID
 ///
 /// \param[in]  pGui:         Pointer to GUI
@@ -2197,6 +3272,33 @@ void gslc_ElemSetTxtStr(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,const char* pS
 ///
 char* gslc_ElemGetTxtStr(gslc_tsGui* pGui, gslc_tsElemRef* pElemRef);
 
+#if (GSLC_FEATURE_TXT_INCR)
+///
+/// Enable incremental redraw of the text associated with an Element
+/// - When the text is subsequently changed with gslc_ElemSetTxtStr(),
+///   only the characters that differ from the displayed string are
+///   erased and redrawn. This reduces flicker and bus traffic for
+///   frequently updated readouts.
+/// - The incremental path is used only for filled, non-rounded
+///   elements without images whose text is a single line. Other
+///   updates, and drivers that don't clip text to the clipping
+///   region (DRV_HAS_DRAW_TXT_CLIP), fall back to a full redraw.
+/// - Adafruit-GFX clips only opaque text in fonts assigned
+///   DRV_FONTREF_MODE_GLYPHBUF (requires GSLC_CLIP_EN). TFT_eSPI
+///   aligns text in the driver (DRV_OVERRIDE_TXT_ALIGN), so it
+///   always falls back to a full redraw.
+/// - Only supported for elements in RAM
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  pElemRef:    Pointer to Element reference
+/// \param[in]  pTxtIncr:    Pointer to state storage, which must remain
+///                          valid while assigned (or NULL to disable)
+///
+/// \return true if success, false if error
+///
+bool gslc_ElemSetTxtIncr(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_tsTxtIncr* pTxtIncr);
+#endif // GSLC_FEATURE_TXT_INCR
+
 
 ///
 /// Update the text string color associated with an Element ID
@@ -2653,6 +3755,37 @@ void gslc_SetTouchPressCal(gslc_tsGui* pGui,uint16_t nPressMin, uint16_t nPressM
 ///
 void gslc_SetTouchRemapYX(gslc_tsGui* pGui, bool bSwap);
 
+#if (GSLC_FEATURE_TOUCH_FILTER)
+///
+/// Configure the touch position filter
+/// - Requires GSLC_FEATURE_TOUCH_FILTER
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nMedianLen:  Number of samples in the median filter (1 to disable,
+///                          up to GSLC_TOUCH_FILTER_MEDIAN_MAX)
+/// \param[in]  nSmoothShift: Exponential smoothing: each sample moves the position
+///                          by 1/2^nSmoothShift of the difference (0 to disable)
+/// \param[in]  nMoveMin:    Minimum change in position (pixels) to report a move
+///
+/// \return none
+///
+void gslc_SetTouchFilterPos(gslc_tsGui* pGui,uint8_t nMedianLen,uint8_t nSmoothShift,uint8_t nMoveMin);
+
+///
+/// Configure the touch pressure hysteresis and debounce
+/// - Requires GSLC_FEATURE_TOUCH_FILTER
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nPressOn:    Pressure at which a touch starts
+/// \param[in]  nPressOff:   Pressure at or below which a touch ends (less than nPressOn)
+/// \param[in]  nDebounceMs: Time that a press or release must persist before
+///                          it is reported (0 to disable)
+///
+/// \return none
+///
+void gslc_SetTouchFilterPress(gslc_tsGui* pGui,uint16_t nPressOn,uint16_t nPressOff,uint16_t nDebounceMs);
+#endif // GSLC_FEATURE_TOUCH_FILTER
+
 
 ///
 /// Make touchscreen sensitive (GUI reacts to touch events) or
@@ -3455,6 +4588,158 @@ void gslc_FocusSetToTrackedElem(gslc_tsGui* pGui,gslc_tsCollect* pCollect);
 gslc_tsImgRef gslc_ResetImage();
 
 
+///
+/// Calculate the cost of combining two invalidated regions
+/// - The cost is the number of pixels within the bounding box of the
+///   two regions that are not covered by either region
+///
+/// \param[in]  rRect1:      First rect region
+/// \param[in]  rRect2:      Second rect region
+///
+/// \return Number of additional pixels that would be redrawn
+///
+int32_t gslc_InvalidateRgnMergeCost(gslc_tsRect rRect1, gslc_tsRect rRect2);
+
+
+///
+/// Add a rect region to a list of disjoint rect regions
+/// - Overlapping regions are combined, as are nearby regions if the
+///   merge cost is below GSLC_INVALIDATE_PASS_COST
+/// - If the list is full, the pair of regions with the lowest merge
+///   cost is combined
+///
+/// \param[in]  arRect:      Array of rect regions
+/// \param[in]  pnRectCnt:   Pointer to number of regions in arRect (updated)
+/// \param[in]  nRectMax:    Maximum number of regions in arRect
+/// \param[in]  rAddRect:    Rect region to add
+///
+/// \return none
+///
+void gslc_RectListAdd(gslc_tsRect* arRect, uint8_t* pnRectCnt, uint8_t nRectMax, gslc_tsRect rAddRect);
+
+
+#if (GSLC_FEATURE_IMG_CACHE)
+///
+/// Look up an image in the decoded image cache
+/// - A hit marks the image as most recently used
+/// - Updates the hit / miss statistics
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  sImgRef:     Image reference
+///
+/// \return Pointer to cache entry or NULL if the image is not cached
+///
+gslc_tsImgCacheEntry* gslc_ImgCacheFind(gslc_tsGui* pGui,gslc_tsImgRef sImgRef);
+
+///
+/// Allocate a decoded image cache entry for an image
+/// - Least recently used images are evicted to stay within the budget
+/// - The caller decodes the image into pPix[]. If decoding fails,
+///   the entry must be released with gslc_ImgCacheRemove().
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  sImgRef:     Image reference
+/// \param[in]  nW:          Image width
+/// \param[in]  nH:          Image height
+/// \param[in]  nSrcBytes:   Bytes read from the source to decode the image
+///
+/// \return Pointer to cache entry or NULL if the image can't be cached
+///
+gslc_tsImgCacheEntry* gslc_ImgCacheAdd(gslc_tsGui* pGui,gslc_tsImgRef sImgRef,uint16_t nW,uint16_t nH,uint32_t nSrcBytes);
+
+///
+/// Release a decoded image cache entry
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  pEntry:      Pointer to cache entry
+///
+/// \return none
+///
+void gslc_ImgCacheRemove(gslc_tsGui* pGui,gslc_tsImgCacheEntry* pEntry);
+
+///
+/// Allocate memory for the decoded image cache
+/// - Uses PSRAM when available on ESP32
+///
+/// \param[in]  nBytes:      Number of bytes to allocate
+///
+/// \return Pointer to memory or NULL if allocation failed
+///
+void* gslc_ImgCacheMalloc(uint32_t nBytes);
+#endif // GSLC_FEATURE_IMG_CACHE
+
+
+#if (GSLC_FEATURE_PT_BATCH)
+///
+/// Draw the runs of adjacent points within a set of points
+/// - The points are sorted so that runs along the selected axis
+///   are consecutive. Runs of two or more points are drawn as a
+///   line and the remaining single points are moved to the start
+///   of asPt[] without being drawn.
+///
+/// \param[in]     pGui:     Pointer to GUI
+/// \param[in,out] asPt:     Array of points (reordered)
+/// \param[in]     nPtCnt:   Number of points in asPt[]
+/// \param[in]     bVert:    Find vertical runs if true, horizontal runs otherwise
+/// \param[in]     nCol:     Color of the points
+///
+/// \return Number of single points remaining in asPt[]
+///
+uint16_t gslc_DrawPointBatchRuns(gslc_tsGui* pGui,gslc_tsPt* asPt,uint16_t nPtCnt,bool bVert,gslc_tsColor nCol);
+#endif // GSLC_FEATURE_PT_BATCH
+
+
+#if (GSLC_FEATURE_DRV_STATS)
+///
+/// Fetch a free-running timestamp for the driver instrumentation
+///
+/// \return Timestamp in microseconds
+///
+uint32_t gslc_DrvStatsGetTimeUs();
+
+
+///
+/// Set the element and redraw type that subsequent driver calls
+/// are attributed to
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nElemId:     Element ID (or GSLC_ID_NONE if not drawing an element)
+/// \param[in]  eRedraw:     Redraw type
+///
+/// \return none
+///
+void gslc_DrvStatsSetScope(gslc_tsGui* pGui,int16_t nElemId,gslc_teRedrawType eRedraw);
+
+
+///
+/// Record a completed driver call in the instrumentation counters
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  ePrim:       Primitive group of the call
+/// \param[in]  nStartUs:    Timestamp at the start of the call
+/// \param[in]  nPixels:     Number of pixels touched
+/// \param[in]  nImgBytes:   Number of bytes of image data drawn
+///
+/// \return none
+///
+void gslc_DrvStatsAdd(gslc_tsGui* pGui,gslc_teDrvStatPrim ePrim,uint32_t nStartUs,uint32_t nPixels,uint32_t nImgBytes);
+
+
+///
+/// Determine the dimensions and data size of an image for the
+/// driver instrumentation
+/// - Only images stored in RAM or Flash are measured
+///
+/// \param[in]  sImgRef:     Image reference
+/// \param[out] pnPixels:    Number of pixels in the image (0 if unknown)
+/// \param[out] pnBytes:     Number of bytes of image data (0 if unknown)
+///
+/// \return none
+///
+void gslc_DrvStatsImgSize(gslc_tsImgRef sImgRef,uint32_t* pnPixels,uint32_t* pnBytes);
+#endif // GSLC_FEATURE_DRV_STATS
+
+
 // ------------------------------------------------------------------------
 /// @}
 /// \defgroup _IntElem_ Internal: Element Functions
@@ -3539,6 +4824,41 @@ void gslc_SetElemRefFlag(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,uint8_t nFlag
 gslc_tsElem* gslc_GetElemFromRef(gslc_tsGui* pGui, gslc_tsElemRef* pElemRef);
 
 
+/// Fetch the rect and feature vector of an element from an element reference
+/// - For elements stored in PROGMEM, only these fields are read from FLASH
+///   and the element cache is not disturbed. This is intended for loops
+///   that examine every element (eg. overlap and hit testing).
+///
+/// \param[in]  pGui:         Pointer to GUI
+/// \param[in]  pElemRef:     Pointer to Element Reference
+/// \param[out] prElem:       Pointer to the element rect
+/// \param[out] pnFeatures:   Pointer to the element feature vector
+///
+/// \return true if success, false if error
+///
+bool gslc_GetElemRectFeatFromRef(gslc_tsGui* pGui, gslc_tsElemRef* pElemRef, gslc_tsRect* prElem, uint16_t* pnFeatures);
+
+
+/// Get the Flash element cache statistics
+///
+/// \param[in]  pGui:         Pointer to GUI
+/// \param[out] pnHit:        Number of fetches of a Flash element served from the cache
+/// \param[out] pnMiss:       Number of fetches of a Flash element requiring a copy from Flash
+///
+/// \return none
+///
+void gslc_ElemProgCacheGetStats(gslc_tsGui* pGui, uint32_t* pnHit, uint32_t* pnMiss);
+
+
+/// Discard all entries in the Flash element cache
+///
+/// \param[in]  pGui:         Pointer to GUI
+///
+/// \return none
+///
+void gslc_ElemProgCacheReset(gslc_tsGui* pGui);
+
+
 /// Returns a pointer to an element from an element reference.
 /// This is a wrapper for GetElemFromRef() including debug checking
 /// for invalid pointers.
@@ -3627,6 +4947,52 @@ void gslc_ElemDraw(gslc_tsGui* pGui,int16_t nPageId,int16_t nElemId);
 void gslc_DrawTxtBase(gslc_tsGui* pGui, char* pStrBuf, gslc_tsRect rTxt, gslc_tsFont* pTxtFont, gslc_teTxtFlags eTxtFlags,
   int8_t eTxtAlign, gslc_tsColor colTxt, gslc_tsColor colBg, int16_t nMarginW, int16_t nMarginH);
 
+///
+/// Draw text with full text justification, reusing a cached text extent
+/// - Identical to gslc_DrawTxtBase() except that the dimensions of the
+///   text are taken from pTxtExtCache when it matches the text, font
+///   and flags, avoiding a call to gslc_DrvGetTxtSize()
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  pStrBuf:     Pointer to text string buffer
+/// \param[in]  rTxt:        Rectangle region to contain the text
+/// \param[in]  pTxtFont:    Pointer to the font
+/// \param[in]  eTxtFlags:   Text string attributes
+/// \param[in]  eTxtAlign:   Text alignment / justification mode
+/// \param[in]  colTxt:      Text foreground color
+/// \param[in]  colBg:       Text background color
+/// \param[in]  nMarginW:    Horizontal margin within rect region to keep text away
+/// \param[in]  nMarginH:    Vertical margin within rect region to keep text away
+/// \param[inout] pTxtExtCache: Pointer to text extent cache (or NULL for none)
+///
+/// \return none
+///
+void gslc_DrawTxtBaseCache(gslc_tsGui* pGui, char* pStrBuf, gslc_tsRect rTxt, gslc_tsFont* pTxtFont, gslc_teTxtFlags eTxtFlags,
+  int8_t eTxtAlign, gslc_tsColor colTxt, gslc_tsColor colBg, int16_t nMarginW, int16_t nMarginH,
+  gslc_tsTxtExtCache* pTxtExtCache);
+
+///
+/// Calculate the origin at which justified text is drawn
+/// - Provides the coordinates that gslc_DrawTxtBaseCache() passes
+///   to gslc_DrvDrawTxt()
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  pStrBuf:     Pointer to text string buffer
+/// \param[in]  rTxt:        Rectangle region to contain the text
+/// \param[in]  pTxtFont:    Pointer to the font
+/// \param[in]  eTxtFlags:   Text string attributes
+/// \param[in]  eTxtAlign:   Text alignment / justification mode
+/// \param[in]  nMarginW:    Horizontal margin within rect region to keep text away
+/// \param[in]  nMarginH:    Vertical margin within rect region to keep text away
+/// \param[inout] pTxtExtCache: Pointer to text extent cache (or NULL for none)
+/// \param[out] pnTxtX:      Ptr to text origin (X)
+/// \param[out] pnTxtY:      Ptr to text origin (Y)
+///
+/// \return true if success, false if the driver performs the alignment
+///
+bool gslc_DrawTxtCalcOrigin(gslc_tsGui* pGui, char* pStrBuf, gslc_tsRect rTxt, gslc_tsFont* pTxtFont, gslc_teTxtFlags eTxtFlags,
+  int8_t eTxtAlign, int16_t nMarginW, int16_t nMarginH, gslc_tsTxtExtCache* pTxtExtCache, int16_t* pnTxtX, int16_t* pnTxtY);
+
 
 ///
 /// Set the global rounded radius
@@ -3752,6 +5118,103 @@ gslc_tsPage* gslc_PageFindById(gslc_tsGui* pGui,int16_t nPageId);
 /// \internal
 void gslc_PageRedrawCalc(gslc_tsGui* pGui);
 
+///
+/// Prepare a redraw pass and draw the background within it
+/// - Sets the clipping to the pass region and accounts for its area
+///
+/// \param[in]  pGui:         Pointer to GUI
+/// \param[in]  pPass:        Pointer to the pass region (or NULL for the entire display)
+/// \param[in]  bPageRedraw:  Redraw the background of the entire pass
+/// \param[in]  arExpose:     Regions in which to redraw the background otherwise
+/// \param[in]  nExposeCnt:   Number of regions in arExpose[]
+///
+/// \return none
+///
+/// \internal
+void gslc_PageRedrawPass(gslc_tsGui* pGui,gslc_tsRect* pPass,bool bPageRedraw,gslc_tsRect* arExpose,uint8_t nExposeCnt);
+
+///
+/// Handle the pending input events (touch, keyboard and pins)
+///
+/// \param[in]  pGui:         Pointer to GUI
+///
+/// \return none
+///
+/// \internal
+void gslc_UpdateInput(gslc_tsGui* pGui);
+
+///
+/// Issue the tick events that are due
+///
+/// \param[in]  pGui:         Pointer to GUI
+///
+/// \return none
+///
+/// \internal
+void gslc_UpdateTick(gslc_tsGui* pGui);
+
+#if (GSLC_FEATURE_UPDATE_BUDGET)
+///
+/// Start a page redraw that is performed in steps by gslc_PageRedrawStep()
+/// - The invalidated and exposed regions are captured and then reset
+///   so that any changes made during the redraw are collected for
+///   the following redraw
+///
+/// \param[in]  pGui:         Pointer to GUI
+///
+/// \return none
+///
+/// \internal
+void gslc_PageRedrawBegin(gslc_tsGui* pGui);
+
+///
+/// Perform the next step of the redraw started by gslc_PageRedrawBegin()
+/// - A step draws the background of a pass or a single element
+/// - Elements that lie within the current invalidation region were
+///   changed during the redraw, so they are left for the next redraw
+/// - The page flip is performed after the last step
+///
+/// \param[in]  pGui:         Pointer to GUI
+///
+/// \return true if further steps remain, false if the redraw is complete
+///
+/// \internal
+bool gslc_PageRedrawStep(gslc_tsGui* pGui);
+
+///
+/// Complete the redraw started by gslc_PageRedrawBegin()
+///
+/// \param[in]  pGui:         Pointer to GUI
+///
+/// \return none
+///
+/// \internal
+void gslc_PageRedrawEnd(gslc_tsGui* pGui);
+
+///
+/// Determine whether a rectangle lies entirely within the invalidation region
+///
+/// \param[in]  pGui:         Pointer to GUI
+/// \param[in]  rRect:        Rectangle to check
+///
+/// \return true if the rectangle is contained in one of the invalidated regions
+///
+/// \internal
+bool gslc_InvalidateRgnContains(gslc_tsGui* pGui,gslc_tsRect rRect);
+
+///
+/// Record a duration in a latency histogram
+///
+/// \param[in]  anHist:       Histogram of GSLC_LATENCY_BIN_CNT bins
+/// \param[in]  pnMaxUs:      Pointer to the longest duration recorded
+/// \param[in]  nTimeUs:      Duration (microseconds)
+///
+/// \return none
+///
+/// \internal
+void gslc_LatencyAdd(uint32_t* anHist,uint32_t* pnMaxUs,uint32_t nTimeUs);
+#endif // GSLC_FEATURE_UPDATE_BUDGET
+
 
 ///
 /// Create an event structure
@@ -3795,6 +5258,44 @@ bool gslc_ElemEvent(void* pvGui,gslc_tsEvent sEvent);
 ///
 bool gslc_ElemSendEventTouch(gslc_tsGui* pGui,gslc_tsElemRef* pElemRefTracked,
         gslc_teTouch eTouch,int16_t nX,int16_t nY);
+
+#if (GSLC_FEATURE_TOUCH_FILTER)
+///
+/// Reset the touch input filter state
+///
+/// \param[in]  pGui:        Pointer to GUI
+///
+/// \return none
+///
+void gslc_TouchFilterReset(gslc_tsGui* pGui);
+
+///
+/// Filter a touch sample before it is tracked
+/// - Applies the pressure hysteresis and debounce, then the median
+///   filter, exponential smoothing and minimum move threshold
+/// - When no sample is available, completes any press or release
+///   whose debounce time has elapsed
+///
+/// \param[in]     pGui:     Pointer to GUI
+/// \param[in]     bSample:  A sample was read from the touch driver
+/// \param[in,out] pnX:      Ptr to X coordinate (updated with the filtered value)
+/// \param[in,out] pnY:      Ptr to Y coordinate (updated with the filtered value)
+/// \param[in,out] pnPress:  Ptr to pressure (updated with the filtered value)
+///
+/// \return true if the result should be tracked, false if it is suppressed
+///
+bool gslc_TouchFilter(gslc_tsGui* pGui,bool bSample,int16_t* pnX,int16_t* pnY,uint16_t* pnPress);
+
+///
+/// Determine the median of a small set of values
+///
+/// \param[in]  anVal:       Array of values
+/// \param[in]  nCnt:        Number of values (up to GSLC_TOUCH_FILTER_MEDIAN_MAX)
+///
+/// \return Median value
+///
+int16_t gslc_TouchFilterMedian(int16_t* anVal,uint8_t nCnt);
+#endif // GSLC_FEATURE_TOUCH_FILTER
 #endif // !DRV_TOUCH_NONE
 
 
@@ -3847,6 +5348,118 @@ void gslc_CollectReset(gslc_tsCollect* pCollect,gslc_tsElem* asElem,uint16_t nEl
 gslc_tsElemRef* gslc_CollectElemAdd(gslc_tsGui* pGui,gslc_tsCollect* pCollect,const gslc_tsElem* pElem,gslc_teElemRefFlags eFlags);
 
 
+///
+/// Find the page collection that contains an element reference
+///
+/// \param[in]  pGui:         Pointer to GUI
+/// \param[in]  pElemRef:     Pointer to the element reference
+/// \param[out] pnElemRefInd: Index of the element reference within the collection
+///
+/// \return Pointer to the page collection or NULL if the element reference
+///         is not located in a page (eg. it belongs to a compound element)
+///
+gslc_tsCollect* gslc_PageFindCollectFromElemRef(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,uint16_t* pnElemRefInd);
+
+
+#if (GSLC_FEATURE_HIT_GRID)
+///
+/// Rebuild the hit-test grid of a collection from all of its elements
+/// - Cell dimensions are recalculated from the current display size
+///
+/// \param[in]  pGui:         Pointer to GUI
+/// \param[in]  pCollect:     Pointer to the collection
+///
+/// \return none
+///
+void gslc_CollectHitGridBuild(gslc_tsGui* pGui,gslc_tsCollect* pCollect);
+
+
+///
+/// Update the hit-test grid cells for a single element in a collection
+/// - Called whenever the element's rect, visibility or clickable state changes
+///
+/// \param[in]  pGui:         Pointer to GUI
+/// \param[in]  pCollect:     Pointer to the collection
+/// \param[in]  nElemRefInd:  Index of the element reference in the collection
+///
+/// \return none
+///
+void gslc_CollectHitGridUpdate(gslc_tsGui* pGui,gslc_tsCollect* pCollect,uint16_t nElemRefInd);
+
+
+///
+/// Update the hit-test grid cells for an element if its page has a grid
+///
+/// \param[in]  pGui:         Pointer to GUI
+/// \param[in]  pElemRef:     Pointer to the element reference
+///
+/// \return none
+///
+void gslc_ElemHitGridUpdate(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef);
+#endif // GSLC_FEATURE_HIT_GRID
+
+
+///
+/// Record an element reference in a collection's dirty list
+/// - The list is maintained in z-order (ascending element index)
+/// - If the list is full, the collection is marked so that all of
+///   its elements are checked during the next redraw
+///
+/// \param[in]  pCollect:     Pointer to the collection
+/// \param[in]  nElemRefInd:  Index of the element reference in the collection
+///
+/// \return none
+///
+void gslc_CollectDirtyAdd(gslc_tsCollect* pCollect,uint16_t nElemRefInd);
+
+
+///
+/// Remove an element reference from a collection's dirty list
+/// - Has no effect if the list has overflowed
+///
+/// \param[in]  pCollect:     Pointer to the collection
+/// \param[in]  nElemRefInd:  Index of the element reference in the collection
+///
+/// \return none
+///
+void gslc_CollectDirtyRemove(gslc_tsCollect* pCollect,uint16_t nElemRefInd);
+
+
+///
+/// Get the next element reference that may require redraw, starting
+/// from a given index in a collection
+///
+/// \param[in]  pCollect:     Pointer to the collection
+/// \param[in]  nElemRefInd:  Index of the first element reference to consider
+///
+/// \return Index of the element reference in the collection, or the
+///         collection's element count if there are no more
+///
+uint16_t gslc_CollectDirtyGetNext(gslc_tsCollect* pCollect,uint16_t nElemRefInd);
+
+
+///
+/// Get the number of element references to visit when searching
+/// a collection for elements that require redraw
+///
+/// \param[in]  pCollect:     Pointer to the collection
+///
+/// \return Number of entries (use with gslc_CollectDirtyGetInd())
+///
+uint16_t gslc_CollectDirtyGetCnt(gslc_tsCollect* pCollect);
+
+
+///
+/// Get the element reference index of an entry in a collection's dirty list
+///
+/// \param[in]  pCollect:     Pointer to the collection
+/// \param[in]  nDirtyInd:    Entry index (0..gslc_CollectDirtyGetCnt()-1)
+///
+/// \return Index of the element reference in the collection
+///
+uint16_t gslc_CollectDirtyGetInd(gslc_tsCollect* pCollect,uint16_t nDirtyInd);
+
+
 ///
 /// Determine if any elements in a collection need redraw
 ///
@@ -4125,6 +5738,163 @@ void gslc_ResetFont(gslc_tsFont* pFont);
 ///
 void gslc_ResetElem(gslc_tsElem* pElem);
 
+///
+/// Invalidate the text extent cached for an element
+/// - Called when the element's text, font or text flags change
+///
+/// \param[in]  pElem:       Pointer to Element
+///
+/// \return none
+///
+void gslc_ElemTxtExtInvalidate(gslc_tsElem* pElem);
+
+#if (GSLC_FEATURE_TXT_INCR)
+///
+/// Redraw only the characters of an element's text that changed
+/// - Compares the element's text against the state retained from
+///   the previous draw, erases the changed character cells and
+///   redraws the text clipped to them
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  pElemRef:    Pointer to Element reference
+/// \param[in]  pState:      Pointer to element regions and colors
+///
+/// \return true if the text was updated, false if a full redraw is required
+///
+bool gslc_ElemDrawTxtIncr(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_tsRectState* pState);
+
+///
+/// Record the text drawn in an element for incremental redraw
+/// - Called after a full redraw of the element
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  pElemRef:    Pointer to Element reference
+/// \param[in]  pState:      Pointer to element regions and colors
+///
+/// \return none
+///
+void gslc_ElemTxtIncrSave(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_tsRectState* pState);
+
+///
+/// Determine whether an element's text can be updated incrementally
+///
+/// \param[in]  pElem:       Pointer to Element
+///
+/// \return Length of the element's text, or -1 if a full redraw is required
+///
+int16_t gslc_ElemTxtIncrLen(gslc_tsElem* pElem);
+
+///
+/// Determine whether the driver clips an element's text to the clipping region
+/// - Drivers without DRV_HAS_DRAW_TXT_CLIP only clip opaque text in
+///   fonts rendered through the glyph buffer (DRV_FONTREF_MODE_GLYPHBUF)
+///
+/// \param[in]  pFont:       Pointer to the element's font
+/// \param[in]  colTxt:      Text color
+/// \param[in]  colBg:       Text background color
+///
+/// \return true if the text is clipped
+///
+bool gslc_ElemTxtIncrClip(gslc_tsFont* pFont,gslc_tsColor colTxt,gslc_tsColor colBg);
+
+///
+/// Measure the character positions of an element's text
+/// - Determines the right edge of each character relative to the text origin
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  pElem:       Pointer to Element
+/// \param[in]  nStart:      Index of the first character to measure
+/// \param[in]  nLen:        Length of the element's text
+/// \param[out] anEdgeX:     Array of character edges to update
+///
+/// \return none
+///
+void gslc_ElemTxtIncrEdges(gslc_tsGui* pGui,gslc_tsElem* pElem,int16_t nStart,int16_t nLen,int16_t* anEdgeX);
+#endif // GSLC_FEATURE_TXT_INCR
+
+///
+/// Issue all deferred events in the order they were queued
+///
+/// \param[in]  pGui:        Pointer to GUI
+///
+/// \return none
+///
+void gslc_EventQueueDrain(gslc_tsGui* pGui);
+
+///
+/// Remove the oldest deferred event from the queue and issue it
+///
+/// \param[in]  pGui:        Pointer to GUI
+///
+/// \return true if an event was issued, false if the queue was empty
+///
+bool gslc_EventQueueIssueHead(gslc_tsGui* pGui);
+
+///
+/// Discard the oldest deferred move event of an element to make
+/// room in the queue for a newer move of the same element
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  pvScope:     Element reference of the newer move
+///
+/// \return true if an event was discarded, false if no move event was queued
+///
+bool gslc_EventQueueDropMove(gslc_tsGui* pGui,void* pvScope);
+
+///
+/// Determine whether a touch event only reports movement
+/// - Move events can be coalesced or discarded, while other
+///   events (such as press, release and moves into or out of
+///   an element) are always issued
+///
+/// \param[in]  eTouch:      Touch event type
+///
+/// \return true if a move event
+///
+bool gslc_EventTouchIsMove(gslc_teTouch eTouch);
+
+///
+/// Issue tick callbacks for the registered elements that are due
+/// - Called from gslc_Update() when the tick scheduler is enabled
+///
+/// \param[in]  pGui:        Pointer to GUI
+///
+/// \return none
+///
+void gslc_TickDispatch(gslc_tsGui* pGui);
+
+///
+/// Restore the tick heap ordering after an entry's due time
+/// decreased (or it was appended)
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nInd:        Index of the entry in the heap
+///
+/// \return none
+///
+void gslc_TickSiftUp(gslc_tsGui* pGui,uint16_t nInd);
+
+///
+/// Restore the tick heap ordering after an entry's due time increased
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nInd:        Index of the entry in the heap
+///
+/// \return none
+///
+void gslc_TickSiftDown(gslc_tsGui* pGui,uint16_t nInd);
+
+///
+/// Calculate a hash of a text string
+/// - Used to detect changes in text without retaining a copy
+///
+/// \param[in]  pStr:        Pointer to string
+/// \param[in]  eTxtFlags:   Text string attributes (for memory location)
+///
+/// \return Hash value
+///
+uint32_t gslc_StrHash(const char* pStr,gslc_teTxtFlags eTxtFlags);
+
 
 /// @}
 /// End of Internal Functions
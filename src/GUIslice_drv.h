@@ -45,6 +45,8 @@ extern "C" {
   #include "GUIslice_drv_sdl.h"
 #elif defined(DRV_DISP_SDL2)
   #include "GUIslice_drv_sdl.h"
+#elif defined(DRV_DISP_FB)
+  #include "GUIslice_drv_fb.h"
 #elif defined(DRV_DISP_ADAGFX) || defined(DRV_DISP_ADAGFX_AS)
   #include "GUIslice_drv_adagfx.h"
 #elif defined(DRV_DISP_TFT_ESPI)
@@ -57,6 +59,110 @@ extern "C" {
   #error No driver specified (DRV_DISP_*). Ensure a config is selected in GUIslice_config.h
 #endif
 
+// -----------------------------------------------------------------------
+// Driver instrumentation
+// - When GSLC_FEATURE_DRV_STATS is enabled, the driver drawing APIs
+//   called by the core, the extended elements and the user code are
+//   redirected to wrappers that update the counters in pGui->sDrvStats
+//   before calling the driver.
+// - The redirection is removed (#undef) ahead of the wrappers in
+//   GUIslice.c so that they call the driver directly. Drivers don't
+//   include this header, so their definitions are unaffected.
+// -----------------------------------------------------------------------
+#if (GSLC_FEATURE_DRV_STATS)
+
+#if (DRV_HAS_DRAW_POINT)
+bool gslc_DrvStatsDrawPoint(gslc_tsGui* pGui,int16_t nX,int16_t nY,gslc_tsColor nCol);
+#endif
+#if (DRV_HAS_DRAW_POINTS)
+bool gslc_DrvStatsDrawPoints(gslc_tsGui* pGui,gslc_tsPt* asPt,uint16_t nNumPt,gslc_tsColor nCol);
+#endif
+#if (DRV_HAS_DRAW_LINE)
+bool gslc_DrvStatsDrawLine(gslc_tsGui* pGui,int16_t nX0,int16_t nY0,int16_t nX1,int16_t nY1,gslc_tsColor nCol);
+#endif
+#if (DRV_HAS_DRAW_RECT_FRAME)
+bool gslc_DrvStatsDrawFrameRect(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColor nCol);
+#endif
+#if (DRV_HAS_DRAW_RECT_FILL)
+bool gslc_DrvStatsDrawFillRect(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColor nCol);
+#endif
+#if (DRV_HAS_DRAW_RECT_ROUND_FRAME)
+bool gslc_DrvStatsDrawFrameRoundRect(gslc_tsGui* pGui,gslc_tsRect rRect,int16_t nRadius,gslc_tsColor nCol);
+#endif
+#if (DRV_HAS_DRAW_RECT_ROUND_FILL)
+bool gslc_DrvStatsDrawFillRoundRect(gslc_tsGui* pGui,gslc_tsRect rRect,int16_t nRadius,gslc_tsColor nCol);
+#endif
+#if (DRV_HAS_DRAW_CIRCLE_FRAME)
+bool gslc_DrvStatsDrawFrameCircle(gslc_tsGui* pGui,int16_t nMidX,int16_t nMidY,uint16_t nRadius,gslc_tsColor nCol);
+#endif
+#if (DRV_HAS_DRAW_CIRCLE_FILL)
+bool gslc_DrvStatsDrawFillCircle(gslc_tsGui* pGui,int16_t nMidX,int16_t nMidY,uint16_t nRadius,gslc_tsColor nCol);
+#endif
+#if (DRV_HAS_DRAW_TRI_FRAME)
+bool gslc_DrvStatsDrawFrameTriangle(gslc_tsGui* pGui,int16_t nX0,int16_t nY0,
+        int16_t nX1,int16_t nY1,int16_t nX2,int16_t nY2,gslc_tsColor nCol);
+#endif
+#if (DRV_HAS_DRAW_TRI_FILL)
+bool gslc_DrvStatsDrawFillTriangle(gslc_tsGui* pGui,int16_t nX0,int16_t nY0,
+        int16_t nX1,int16_t nY1,int16_t nX2,int16_t nY2,gslc_tsColor nCol);
+#endif
+#if (DRV_HAS_DRAW_TEXT)
+bool gslc_DrvStatsDrawTxt(gslc_tsGui* pGui,int16_t nTxtX,int16_t nTxtY,gslc_tsFont* pFont,const char* pStr,
+        gslc_teTxtFlags eTxtFlags,gslc_tsColor colTxt,gslc_tsColor colBg);
+#endif
+#if (DRV_OVERRIDE_TXT_ALIGN)
+bool gslc_DrvStatsDrawTxtAlign(gslc_tsGui* pGui,int16_t nX0,int16_t nY0,int16_t nX1,int16_t nY1,int8_t eTxtAlign,
+        gslc_tsFont* pFont,const char* pStr,gslc_teTxtFlags eTxtFlags,gslc_tsColor colTxt,gslc_tsColor colBg);
+#endif
+bool gslc_DrvStatsDrawImage(gslc_tsGui* pGui,int16_t nDstX,int16_t nDstY,gslc_tsImgRef sImgRef);
+void gslc_DrvStatsDrawBkgnd(gslc_tsGui* pGui);
+void gslc_DrvStatsPageFlipNow(gslc_tsGui* pGui);
+
+#if (DRV_HAS_DRAW_POINT)
+  #define gslc_DrvDrawPoint           gslc_DrvStatsDrawPoint
+#endif
+#if (DRV_HAS_DRAW_POINTS)
+  #define gslc_DrvDrawPoints          gslc_DrvStatsDrawPoints
+#endif
+#if (DRV_HAS_DRAW_LINE)
+  #define gslc_DrvDrawLine            gslc_DrvStatsDrawLine
+#endif
+#if (DRV_HAS_DRAW_RECT_FRAME)
+  #define gslc_DrvDrawFrameRect       gslc_DrvStatsDrawFrameRect
+#endif
+#if (DRV_HAS_DRAW_RECT_FILL)
+  #define gslc_DrvDrawFillRect        gslc_DrvStatsDrawFillRect
+#endif
+#if (DRV_HAS_DRAW_RECT_ROUND_FRAME)
+  #define gslc_DrvDrawFrameRoundRect  gslc_DrvStatsDrawFrameRoundRect
+#endif
+#if (DRV_HAS_DRAW_RECT_ROUND_FILL)
+  #define gslc_DrvDrawFillRoundRect   gslc_DrvStatsDrawFillRoundRect
+#endif
+#if (DRV_HAS_DRAW_CIRCLE_FRAME)
+  #define gslc_DrvDrawFrameCircle     gslc_DrvStatsDrawFrameCircle
+#endif
+#if (DRV_HAS_DRAW_CIRCLE_FILL)
+  #define gslc_DrvDrawFillCircle      gslc_DrvStatsDrawFillCircle
+#endif
+#if (DRV_HAS_DRAW_TRI_FRAME)
+  #define gslc_DrvDrawFrameTriangle   gslc_DrvStatsDrawFrameTriangle
+#endif
+#if (DRV_HAS_DRAW_TRI_FILL)
+  #define gslc_DrvDrawFillTriangle    gslc_DrvStatsDrawFillTriangle
+#endif
+#if (DRV_HAS_DRAW_TEXT)
+  #define gslc_DrvDrawTxt             gslc_DrvStatsDrawTxt
+#endif
+#if (DRV_OVERRIDE_TXT_ALIGN)
+  #define gslc_DrvDrawTxtAlign        gslc_DrvStatsDrawTxtAlign
+#endif
+#define gslc_DrvDrawImage             gslc_DrvStatsDrawImage
+#define gslc_DrvDrawBkgnd             gslc_DrvStatsDrawBkgnd
+#define gslc_DrvPageFlipNow           gslc_DrvStatsPageFlipNow
+
+#endif // GSLC_FEATURE_DRV_STATS
+
 
 
 #ifdef __cplusplus
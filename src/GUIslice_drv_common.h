@@ -0,0 +1,267 @@
+#ifndef _GUISLICE_DRV_COMMON_H_
+#define _GUISLICE_DRV_COMMON_H_
+
+// =======================================================================
+// GUIslice library (routines shared by the Adafruit-GFX and TFT_eSPI drivers)
+// - Calvin Hass
+// - https://www.impulseadventure.com/elec/guislice-gui.html
+// - https://github.com/ImpulseAdventure/GUIslice
+// =======================================================================
+//
+// The MIT License
+//
+// Copyright 2016-2020 Calvin Hass
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// =======================================================================
+/// \file GUIslice_drv_common.h
+/// \brief GUIslice library (routines shared by the Adafruit-GFX and TFT_eSPI drivers)
+
+
+// =======================================================================
+// Shared driver routines
+// - Routines common to the drivers whose display libraries render
+//   Adafruit-GFX fonts and accept block writes of raw pixels
+// - This header is included by the driver header. The driver source
+//   includes GUIslice_drv_common_impl.h to compile the routines.
+// - Each driver supplies gslc_DrvDrawRawBlock() to write a block
+//   of pixels with its display library
+// =======================================================================
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+#include "GUIslice.h"
+
+// -----------------------------------------------------------------------
+// Monochrome images (GSLC_IMGREF_FMT_RAW1)
+// - gslc_DrvDrawMonoFromMemOpaque() expands the rows into a local line
+//   buffer of foreground and background colors that is pushed to the
+//   display with gslc_DrvDrawRawBlock(). Narrow images pack several rows
+//   into the buffer so that they are pushed in a single window.
+// - DRV_MONO_LINE_PX_MAX defines the line buffer size in pixels
+//   (allocated on the stack). Wider rows are pushed in pieces
+// -----------------------------------------------------------------------
+#define DRV_HAS_DRAW_MONO_OPAQUE       1 ///< Support gslc_DrvDrawMonoFromMemOpaque()
+
+#if !defined(DRV_MONO_LINE_PX_MAX)
+  #if defined(__AVR__)
+    #define DRV_MONO_LINE_PX_MAX       32 ///< Mono line buffer size (pixels)
+  #else
+    #define DRV_MONO_LINE_PX_MAX       128 ///< Mono line buffer size (pixels)
+  #endif
+#endif
+
+///
+/// Draw a monochrome bitmap from a memory array
+/// - Draw from the bitmap buffer using the foreground color
+///   defined in the header (unset bits are transparent)
+/// - Each run of set bits in a row is drawn with a single fill
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nDstX:       Destination X coord for copy
+/// \param[in]  nDstY:       Destination Y coord for copy
+/// \param[in]  pBitmap:     Pointer to bitmap buffer
+/// \param[in]  bProgMem:    Bitmap is stored in Flash if true, RAM otherwise
+///
+/// \return none
+///
+void gslc_DrvDrawMonoFromMem(gslc_tsGui* pGui,int16_t nDstX, int16_t nDstY, const unsigned char *pBitmap,bool bProgMem);
+
+///
+/// Draw a monochrome bitmap from a memory array with an opaque background
+/// - Set bits are drawn in the foreground color defined in the header
+///   and unset bits in the background color
+/// - The rows are expanded into a line buffer (DRV_MONO_LINE_PX_MAX)
+///   and pushed as blocks, which is faster than the span fills of
+///   gslc_DrvDrawMonoFromMem() when the image has many runs
+/// - Called by gslc_DrawImageMonoOpaque()
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nDstX:       Destination X coord for copy
+/// \param[in]  nDstY:       Destination Y coord for copy
+/// \param[in]  pBitmap:     Pointer to bitmap buffer
+/// \param[in]  bProgMem:    Bitmap is stored in Flash if true, RAM otherwise
+/// \param[in]  nColBg:      Color for unset bits
+///
+/// \return none
+///
+void gslc_DrvDrawMonoFromMemOpaque(gslc_tsGui* pGui,int16_t nDstX, int16_t nDstY,
+  const unsigned char* pBitmap,bool bProgMem,gslc_tsColor nColBg);
+
+// -----------------------------------------------------------------------
+// SD card BMP streaming
+// - BMP images on SD card (24-bit and 16-bit) are read a whole row, or
+//   several rows, at a time into a local buffer, converted in bulk and
+//   pushed to the display with gslc_DrvDrawRawBlock() (one address
+//   window per row, or per block of rows for top-down images)
+// - DRV_SD_ROW_BUF_BYTES defines the buffer size in bytes (allocated on
+//   the stack). Rows wider than the buffer are read in segments
+// -----------------------------------------------------------------------
+#if !defined(DRV_SD_ROW_BUF_BYTES)
+  #if defined(__AVR__)
+    #define DRV_SD_ROW_BUF_BYTES       (3*GSLC_SD_BUFFPIXEL) ///< SD row buffer size (bytes)
+  #else
+    #define DRV_SD_ROW_BUF_BYTES       1440 ///< SD row buffer size (bytes)
+  #endif
+#endif
+
+/// BMP file header information used when streaming from SD card
+typedef struct {
+  uint32_t      nDataOffset;    ///< Start of image data in file
+  int32_t       nW;             ///< Image width (pixels)
+  int32_t       nH;             ///< Image height (pixels)
+  bool          bTopDown;       ///< Rows are stored top-to-bottom
+  uint16_t      nDepth;         ///< Bits per pixel (16 or 24)
+  bool          b565;           ///< 16-bit pixels are RGB565 (else XRGB1555)
+  uint32_t      nRowSize;       ///< Row size in file including padding (bytes)
+} gslc_tsDrvBmpInfo;
+
+///
+/// Convert a row of BMP file pixels (24-bit or 16-bit) to display format
+/// - The conversion may be performed in place (pDst aliasing pSrc)
+/// - When bTrans is set, only pixels that match the transparent color
+///   exactly are converted to nTransRaw
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  pInfo:       Pointer to BMP header information
+/// \param[in]  pSrc:        Pointer to BMP pixel data
+/// \param[out] pDst:        Pointer to output pixel buffer
+/// \param[in]  nPix:        Number of pixels to convert
+/// \param[in]  bTrans:      Transparent pixels are enabled
+/// \param[in]  nTransRaw:   Transparent color in display format
+///
+/// \return none
+///
+void gslc_DrvBmpRowToRaw(gslc_tsGui* pGui,gslc_tsDrvBmpInfo* pInfo,const uint8_t* pSrc,uint16_t* pDst,
+  uint16_t nPix,bool bTrans,uint16_t nTransRaw);
+
+///
+/// Draw a color bitmap (24-bit or 16-bit depth) from SD card
+/// - Rows are read and converted in bulk and pushed to the display
+///   with block writes, clipped to the display and clipping region
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  filename:    Filename on SD card (usually in form "/pic.bmp")
+/// \param[in]  x:           X coordinate to draw bitmap
+/// \param[in]  y:           Y coordinate to draw bitmap
+///
+/// \return none
+///
+void gslc_DrvDrawBmp24FromSD(gslc_tsGui* pGui,const char *filename, uint16_t x, uint16_t y);
+
+#if (DRV_HAS_IMG_CACHE)
+///
+/// Decode a color bitmap (24-bit or 16-bit depth) from SD card into
+/// the image cache
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  sImgRef:     Image reference
+///
+/// \return Pointer to cache entry or NULL if the image could not be cached
+///
+gslc_tsImgCacheEntry* gslc_DrvCacheBmpFromSD(gslc_tsGui* pGui,gslc_tsImgRef sImgRef);
+#endif // DRV_HAS_IMG_CACHE
+
+#if (DRV_HAS_DRAW_TXT_GLYPHBUF)
+
+/// Glyph metrics fetched from an Adafruit-GFX font
+typedef struct {
+  uint16_t  nBmpOffset;   ///< Offset of glyph within the font bitmap
+  uint8_t   nW;           ///< Glyph bitmap width
+  uint8_t   nH;           ///< Glyph bitmap height
+  uint8_t   nAdvX;        ///< Cursor advance after glyph
+  int8_t    nOffX;        ///< Bitmap offset from cursor (X)
+  int8_t    nOffY;        ///< Bitmap offset from baseline (Y)
+} gslc_tsDrvGlyph;
+
+///
+/// Fetch the metrics for a glyph in an Adafruit-GFX font
+///
+/// \param[in]  pvFont:      Pointer to GFXfont
+/// \param[in]  nCh:         Character to look up
+/// \param[out] pGlyph:      Glyph metrics
+///
+/// \return true if the character is defined in the font
+///
+bool gslc_DrvGlyphGet(const void* pvFont,uint8_t nCh,gslc_tsDrvGlyph* pGlyph);
+
+///
+/// Determine the extent of a single row of text
+/// - The row ends at the first newline or string terminator
+/// - The extent is relative to the text cursor and baseline
+///
+/// \param[in]  pvFont:      Pointer to GFXfont
+/// \param[in]  nScale:      Text scale factor
+/// \param[in]  pStr:        String to measure
+/// \param[in]  bProg:       String is located in PROGMEM
+/// \param[out] pnX0:        Left edge of row
+/// \param[out] pnY0:        Top edge of row
+/// \param[out] pnX1:        Right edge of row (exclusive)
+/// \param[out] pnY1:        Bottom edge of row (exclusive)
+///
+/// \return Number of characters in the row
+///
+uint16_t gslc_DrvGlyphBufRowExt(const void* pvFont,uint8_t nScale,const char* pStr,bool bProg,
+  int16_t* pnX0,int16_t* pnY0,int16_t* pnX1,int16_t* pnY1);
+
+///
+/// Determine the extent of a text string rendered through
+/// the glyph buffer, including any newline separated rows
+/// - The extent is relative to the text cursor and the
+///   baseline of the first row
+///
+/// \param[in]  pFont:       Ptr to Font (must reference a GFXfont)
+/// \param[in]  pStr:        String to measure
+/// \param[in]  eTxtFlags:   Flags associated with text string
+/// \param[out] pnX0:        Left edge of text
+/// \param[out] pnY0:        Top edge of text
+/// \param[out] pnX1:        Right edge of text (exclusive)
+/// \param[out] pnY1:        Bottom edge of text (exclusive)
+///
+void gslc_DrvGlyphBufTxtExt(gslc_tsFont* pFont,const char* pStr,gslc_teTxtFlags eTxtFlags,
+  int16_t* pnX0,int16_t* pnY0,int16_t* pnX1,int16_t* pnY1);
+
+///
+/// Draw opaque text through the glyph buffer
+/// - Each text row is expanded with its background color into a
+///   pixel buffer and written to the display in block transfers
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nTxtX:       X coordinate of text cursor
+/// \param[in]  nTxtY:       Y coordinate of text baseline
+/// \param[in]  pFont:       Ptr to Font (must reference a GFXfont)
+/// \param[in]  pStr:        String to display
+/// \param[in]  eTxtFlags:   Flags associated with text string
+/// \param[in]  colTxt:      Color to draw text
+/// \param[in]  colBg:       Color of background
+///
+/// \return true if success, false if failure
+///
+bool gslc_DrvDrawTxtGlyphBuf(gslc_tsGui* pGui,int16_t nTxtX,int16_t nTxtY,gslc_tsFont* pFont,const char* pStr,
+  gslc_teTxtFlags eTxtFlags,gslc_tsColor colTxt,gslc_tsColor colBg);
+
+#endif // DRV_HAS_DRAW_TXT_GLYPHBUF
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+#endif // _GUISLICE_DRV_COMMON_H_
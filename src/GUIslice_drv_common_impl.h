@@ -0,0 +1,750 @@
+#ifndef _GUISLICE_DRV_COMMON_IMPL_H_
+#define _GUISLICE_DRV_COMMON_IMPL_H_
+
+// =======================================================================
+// GUIslice library (implementation of routines shared by the Adafruit-GFX and TFT_eSPI drivers)
+// - Calvin Hass
+// - https://www.impulseadventure.com/elec/guislice-gui.html
+// - https://github.com/ImpulseAdventure/GUIslice
+// =======================================================================
+//
+// The MIT License
+//
+// Copyright 2016-2020 Calvin Hass
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// =======================================================================
+/// \file GUIslice_drv_common_impl.h
+/// \brief GUIslice library (implementation of routines shared by the Adafruit-GFX and TFT_eSPI drivers)
+
+
+// =======================================================================
+// Shared driver routines
+// - Included once by the driver source, after the display and SD card
+//   libraries have been loaded so that GFXfont and File are defined
+// - See GUIslice_drv_common.h
+// =======================================================================
+
+#include "GUIslice_drv_common.h"
+
+// Read a pointer from PROGMEM (eg. the bitmap and glyph tables in a GFXfont)
+#if !defined(__INT_MAX__) || (__INT_MAX__ > 0xFFFF)
+  #define DRV_PGM_READ_PTR(addr) ((void*)pgm_read_dword(addr))
+#else
+  #define DRV_PGM_READ_PTR(addr) ((void*)pgm_read_word(addr))
+#endif
+
+
+#if (DRV_HAS_DRAW_TXT_GLYPHBUF)
+
+bool gslc_DrvGlyphGet(const void* pvFont,uint8_t nCh,gslc_tsDrvGlyph* pGlyph)
+{
+  const GFXfont*  pGfxFont = (const GFXfont*)pvFont;
+  uint8_t         nFirst = (uint8_t)pgm_read_byte(&pGfxFont->first);
+  uint8_t         nLast  = (uint8_t)pgm_read_byte(&pGfxFont->last);
+  if ((nCh < nFirst) || (nCh > nLast)) {
+    return false;
+  }
+  const GFXglyph* pGfxGlyph = (const GFXglyph*)DRV_PGM_READ_PTR(&pGfxFont->glyph) + (nCh - nFirst);
+  pGlyph->nBmpOffset = pgm_read_word(&pGfxGlyph->bitmapOffset);
+  pGlyph->nW         = pgm_read_byte(&pGfxGlyph->width);
+  pGlyph->nH         = pgm_read_byte(&pGfxGlyph->height);
+  pGlyph->nAdvX      = pgm_read_byte(&pGfxGlyph->xAdvance);
+  pGlyph->nOffX      = (int8_t)pgm_read_byte(&pGfxGlyph->xOffset);
+  pGlyph->nOffY      = (int8_t)pgm_read_byte(&pGfxGlyph->yOffset);
+  return true;
+}
+
+uint16_t gslc_DrvGlyphBufRowExt(const void* pvFont,uint8_t nScale,const char* pStr,bool bProg,
+  int16_t* pnX0,int16_t* pnY0,int16_t* pnX1,int16_t* pnY1)
+{
+  gslc_tsDrvGlyph sGlyph;
+  uint16_t        nLen = 0;
+  int16_t         nCurX = 0;
+  int16_t         nGlyphX0,nGlyphY0;
+  bool            bInk = false;
+  uint8_t         nCh;
+
+  *pnX0 = 0;
+  *pnX1 = 0;
+  *pnY0 = 0;
+  *pnY1 = 0;
+  while (1) {
+    nCh = (bProg) ? pgm_read_byte(&pStr[nLen]) : (uint8_t)pStr[nLen];
+    if ((nCh == 0) || (nCh == '\n')) {
+      break;
+    }
+    nLen++;
+    // Characters outside of the font are skipped
+    if (!gslc_DrvGlyphGet(pvFont,nCh,&sGlyph)) {
+      continue;
+    }
+    if ((sGlyph.nW > 0) && (sGlyph.nH > 0)) {
+      nGlyphX0 = nCurX + sGlyph.nOffX * nScale;
+      nGlyphY0 = sGlyph.nOffY * nScale;
+      *pnX0 = GSLC_MIN(*pnX0,nGlyphX0);
+      *pnX1 = GSLC_MAX(*pnX1,nGlyphX0 + sGlyph.nW * nScale);
+      if (!bInk) {
+        *pnY0 = nGlyphY0;
+        *pnY1 = nGlyphY0 + sGlyph.nH * nScale;
+        bInk = true;
+      } else {
+        *pnY0 = GSLC_MIN(*pnY0,nGlyphY0);
+        *pnY1 = GSLC_MAX(*pnY1,nGlyphY0 + sGlyph.nH * nScale);
+      }
+    }
+    nCurX += sGlyph.nAdvX * nScale;
+  }
+  // Include the full advance so that trailing spaces are covered
+  *pnX1 = GSLC_MAX(*pnX1,nCurX);
+  return nLen;
+}
+
+void gslc_DrvGlyphBufTxtExt(gslc_tsFont* pFont,const char* pStr,gslc_teTxtFlags eTxtFlags,
+  int16_t* pnX0,int16_t* pnY0,int16_t* pnX1,int16_t* pnY1)
+{
+  const GFXfont*  pGfxFont  = (const GFXfont*)(pFont->pvFont);
+  uint8_t         nScale    = (pFont->nSize > 0) ? pFont->nSize : 1;
+  int16_t         nAdvY     = pgm_read_byte(&pGfxFont->yAdvance) * nScale;
+  bool            bProg     = ((eTxtFlags & GSLC_TXT_MEM) == GSLC_TXT_MEM_PROG);
+  int16_t         nRowX0,nRowY0,nRowX1,nRowY1;
+  int16_t         nBaseY    = 0;
+  uint16_t        nRowLen;
+  uint8_t         nCh;
+
+  nRowLen = gslc_DrvGlyphBufRowExt(pFont->pvFont,nScale,pStr,bProg,pnX0,pnY0,pnX1,pnY1);
+  while (1) {
+    pStr += nRowLen;
+    nCh = (bProg) ? pgm_read_byte(pStr) : (uint8_t)(*pStr);
+    if (nCh != '\n') {
+      break;
+    }
+    pStr++;
+    nBaseY += nAdvY;
+    nRowLen = gslc_DrvGlyphBufRowExt(pFont->pvFont,nScale,pStr,bProg,&nRowX0,&nRowY0,&nRowX1,&nRowY1);
+    *pnX0 = GSLC_MIN(*pnX0,nRowX0);
+    *pnX1 = GSLC_MAX(*pnX1,nRowX1);
+    *pnY1 = GSLC_MAX(*pnY1,nBaseY + nRowY1);
+  }
+}
+
+bool gslc_DrvDrawTxtGlyphBuf(gslc_tsGui* pGui,int16_t nTxtX,int16_t nTxtY,gslc_tsFont* pFont,const char* pStr,
+  gslc_teTxtFlags eTxtFlags,gslc_tsColor colTxt,gslc_tsColor colBg)
+{
+  const void*     pvFont    = pFont->pvFont;
+  const GFXfont*  pGfxFont  = (const GFXfont*)pvFont;
+  const uint8_t*  pBitmap   = (const uint8_t*)DRV_PGM_READ_PTR(&pGfxFont->bitmap);
+  uint8_t         nAdvY     = pgm_read_byte(&pGfxFont->yAdvance);
+  uint8_t         nScale    = (pFont->nSize > 0) ? pFont->nSize : 1;
+  bool            bProg     = ((eTxtFlags & GSLC_TXT_MEM) == GSLC_TXT_MEM_PROG);
+  uint16_t        nColRaw   = gslc_DrvAdaptColorToRaw(colTxt);
+  uint16_t        nColBgRaw = gslc_DrvAdaptColorToRaw(colBg);
+  uint16_t        anBuf[DRV_GLYPHBUF_PX_MAX];
+  gslc_tsDrvGlyph sGlyph;
+  gslc_tsRect     rRow;
+  uint16_t        nRowLen,nInd;
+  int16_t         nRowX0,nRowY0,nRowX1,nRowY1;
+  int16_t         nTileX,nTileY,nTileW,nTileH,nBandH;
+  int16_t         nCurX,nGlyphX0,nGlyphY0;
+  int16_t         nX,nY,nX0,nY0,nX1,nY1;
+  int16_t         nPx,nSub;
+  uint16_t        nBitRow,nBit;
+  uint16_t*       pnDst;
+  uint8_t         nCh;
+  #if (GSLC_CLIP_EN)
+  gslc_tsDriver*  pDriver   = (gslc_tsDriver*)(pGui->pvDriver);
+  #endif
+
+  while (1) {
+    // Determine the bounds of the current text row
+    // - The row is rendered as a series of tiles that fit within the
+    //   glyph buffer, each pushed with a single block write
+    nRowLen = gslc_DrvGlyphBufRowExt(pvFont,nScale,pStr,bProg,&nRowX0,&nRowY0,&nRowX1,&nRowY1);
+    rRow = (gslc_tsRect){(int16_t)(nTxtX+nRowX0),(int16_t)(nTxtY+nRowY0),
+      (uint16_t)(nRowX1-nRowX0),(uint16_t)(nRowY1-nRowY0)};
+    bool bRowVis = (rRow.w > 0) && (rRow.h > 0);
+    #if (GSLC_CLIP_EN)
+    if ((bRowVis) && (!gslc_ClipRect(&pDriver->rClipRect,&rRow))) { bRowVis = false; }
+    #endif
+
+    if (bRowVis) {
+      nTileW = GSLC_MIN((int16_t)rRow.w,DRV_GLYPHBUF_PX_MAX);
+      nBandH = GSLC_MAX(DRV_GLYPHBUF_PX_MAX / nTileW,1);
+      for (nTileX = rRow.x; nTileX < rRow.x + (int16_t)rRow.w; nTileX += nTileW) {
+        nTileW = GSLC_MIN(nTileW,rRow.x + (int16_t)rRow.w - nTileX);
+        for (nTileY = rRow.y; nTileY < rRow.y + (int16_t)rRow.h; nTileY += nBandH) {
+          nTileH = GSLC_MIN(nBandH,rRow.y + (int16_t)rRow.h - nTileY);
+
+          // Start with the background color
+          for (nInd = 0; nInd < (uint16_t)(nTileW * nTileH); nInd++) {
+            anBuf[nInd] = nColBgRaw;
+          }
+
+          // Expand the portion of each glyph that lies within the tile
+          nCurX = nTxtX;
+          for (nInd = 0; nInd < nRowLen; nInd++) {
+            nCh = (bProg) ? pgm_read_byte(&pStr[nInd]) : (uint8_t)pStr[nInd];
+            if (!gslc_DrvGlyphGet(pvFont,nCh,&sGlyph)) {
+              continue;
+            }
+            nGlyphX0 = nCurX + sGlyph.nOffX * nScale;
+            nGlyphY0 = nTxtY + sGlyph.nOffY * nScale;
+            nCurX += sGlyph.nAdvX * nScale;
+            nX0 = GSLC_MAX(nGlyphX0,nTileX);
+            nY0 = GSLC_MAX(nGlyphY0,nTileY);
+            nX1 = GSLC_MIN(nGlyphX0 + sGlyph.nW * nScale,nTileX + nTileW);
+            nY1 = GSLC_MIN(nGlyphY0 + sGlyph.nH * nScale,nTileY + nTileH);
+            if ((nX0 >= nX1) || (nY0 >= nY1)) {
+              continue;
+            }
+            for (nY = nY0; nY < nY1; nY++) {
+              // Glyph bitmaps are packed MSB first without row padding
+              nBitRow = (uint16_t)((nY - nGlyphY0) / nScale) * sGlyph.nW;
+              nPx     = (nX0 - nGlyphX0) / nScale;
+              nSub    = (nX0 - nGlyphX0) % nScale;
+              pnDst   = &anBuf[(nY - nTileY) * nTileW + (nX0 - nTileX)];
+              for (nX = nX0; nX < nX1; nX++) {
+                nBit = nBitRow + nPx;
+                if (pgm_read_byte(&pBitmap[sGlyph.nBmpOffset + (nBit >> 3)]) & (0x80 >> (nBit & 7))) {
+                  *pnDst = nColRaw;
+                }
+                pnDst++;
+                if (++nSub == nScale) {
+                  nSub = 0;
+                  nPx++;
+                }
+              }
+            }
+          }
+
+          gslc_DrvDrawRawBlock(pGui,nTileX,nTileY,anBuf,nTileW,nTileH,false,0);
+        }
+      }
+    }
+
+    // Advance to the next text row
+    pStr += nRowLen;
+    nCh = (bProg) ? pgm_read_byte(pStr) : (uint8_t)(*pStr);
+    if (nCh != '\n') {
+      break;
+    }
+    pStr++;
+    nTxtY += nAdvY * nScale;
+  }
+
+  return true;
+}
+
+#endif // DRV_HAS_DRAW_TXT_GLYPHBUF
+
+// Read a byte from an image in RAM or Flash
+inline uint8_t gslc_DrvReadImgByte(bool bProgMem,const unsigned char* pByte)
+{
+  return (bProgMem) ? pgm_read_byte(pByte) : *pByte;
+}
+
+// ----- REFERENCE CODE begin
+// The following code was based upon the following reference code but modified to
+// adapt for use in GUIslice.
+//
+//   URL:              https://github.com/adafruit/Adafruit-GFX-Library/blob/master/Adafruit_GFX.cpp
+//   Original author:  Adafruit
+//   Function:         drawBitmap()
+
+// Draw a 1-bit image (bitmap) at the specified (x,y) position from the
+// provided bitmap buffer using the foreground color defined in the
+// header (unset bits are transparent).
+
+// GUIslice modified the raw memory format to add a header:
+// Image array format:
+// - Width[15:8],  Width[7:0],
+// - Height[15:8], Height[7:0],
+// - ColorR[7:0],  ColorG[7:0],
+// - ColorB[7:0],  0x00,
+// - Monochrome bitmap follows...
+//
+void gslc_DrvDrawMonoFromMem(gslc_tsGui* pGui,int16_t nDstX, int16_t nDstY,
+ const unsigned char *pBitmap,bool bProgMem)
+{
+  const unsigned char*  pBits = pBitmap + 7;
+  int16_t         w, h, row, col, nSpan0;
+  uint8_t         nByte = 0;
+  gslc_tsColor    nCol;
+
+  // Read header
+  w       = gslc_DrvReadImgByte(bProgMem,pBitmap+0) << 8;
+  w      |= gslc_DrvReadImgByte(bProgMem,pBitmap+1) << 0;
+  h       = gslc_DrvReadImgByte(bProgMem,pBitmap+2) << 8;
+  h      |= gslc_DrvReadImgByte(bProgMem,pBitmap+3) << 0;
+  nCol.r  = gslc_DrvReadImgByte(bProgMem,pBitmap+4);
+  nCol.g  = gslc_DrvReadImgByte(bProgMem,pBitmap+5);
+  nCol.b  = gslc_DrvReadImgByte(bProgMem,pBitmap+6);
+
+  // Determine the portion of the image within the clipping region
+  int16_t nRow0 = 0;
+  int16_t nRow1 = h;
+  int16_t nCol0 = 0;
+  int16_t nCol1 = w;
+  #if (GSLC_CLIP_EN)
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  gslc_tsRect rImg = (gslc_tsRect) { nDstX, nDstY, (uint16_t)w, (uint16_t)h };
+  if (!gslc_ClipRect(&pDriver->rClipRect,&rImg)) { return; }
+  nCol0 = rImg.x - nDstX;
+  nRow0 = rImg.y - nDstY;
+  nCol1 = nCol0 + rImg.w;
+  nRow1 = nRow0 + rImg.h;
+  #endif
+
+  // Scan each row for runs of set bits and draw each run as a
+  // single horizontal fill. Bytes that are entirely clear or
+  // entirely set are consumed eight pixels at a time.
+  int16_t byteWidth = (w + 7) / 8;
+  for (row=nRow0; row<nRow1; row++) {
+    const unsigned char* pRow = pBits + (int32_t)row * byteWidth;
+    col = nCol0;
+    while (col < nCol1) {
+      nByte = gslc_DrvReadImgByte(bProgMem,pRow + (col >> 3));
+      if (((col & 7) == 0) && (nByte == 0x00)) {
+        col += 8;
+        continue;
+      }
+      if (!(nByte & (0x80 >> (col & 7)))) {
+        col++;
+        continue;
+      }
+      nSpan0 = col;
+      while (col < nCol1) {
+        if ((col & 7) == 0) {
+          nByte = gslc_DrvReadImgByte(bProgMem,pRow + (col >> 3));
+          if (nByte == 0xFF) {
+            col += 8;
+            continue;
+          }
+        }
+        if (!(nByte & (0x80 >> (col & 7)))) {
+          break;
+        }
+        col++;
+      }
+      if (col > nCol1) {
+        col = nCol1;
+      }
+      gslc_DrvDrawFillRect(pGui,(gslc_tsRect){ (int16_t)(nDstX+nSpan0), (int16_t)(nDstY+row), (uint16_t)(col-nSpan0), 1 },nCol);
+    }
+  }
+}
+// ----- REFERENCE CODE end
+
+void gslc_DrvDrawMonoFromMemOpaque(gslc_tsGui* pGui,int16_t nDstX, int16_t nDstY,
+  const unsigned char* pBitmap,bool bProgMem,gslc_tsColor nColBg)
+{
+  const unsigned char*  pBits = pBitmap + 7;
+  uint16_t        anPix[DRV_MONO_LINE_PX_MAX];  // Line buffer
+  int16_t         w, h, row, col, nInd, nSeg0, nSegW, nRows, nRowsMax;
+  uint8_t         nByte = 0;
+  gslc_tsColor    nCol;
+
+  // Read header
+  w       = gslc_DrvReadImgByte(bProgMem,pBitmap+0) << 8;
+  w      |= gslc_DrvReadImgByte(bProgMem,pBitmap+1) << 0;
+  h       = gslc_DrvReadImgByte(bProgMem,pBitmap+2) << 8;
+  h      |= gslc_DrvReadImgByte(bProgMem,pBitmap+3) << 0;
+  nCol.r  = gslc_DrvReadImgByte(bProgMem,pBitmap+4);
+  nCol.g  = gslc_DrvReadImgByte(bProgMem,pBitmap+5);
+  nCol.b  = gslc_DrvReadImgByte(bProgMem,pBitmap+6);
+  if ((w <= 0) || (h <= 0)) {
+    return;
+  }
+
+  // Determine the portion of the image within the clipping region
+  int16_t nRow0 = 0;
+  int16_t nRow1 = h;
+  int16_t nCol0 = 0;
+  int16_t nCol1 = w;
+  #if (GSLC_CLIP_EN)
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  gslc_tsRect rImg = (gslc_tsRect) { nDstX, nDstY, (uint16_t)w, (uint16_t)h };
+  if (!gslc_ClipRect(&pDriver->rClipRect,&rImg)) { return; }
+  nCol0 = rImg.x - nDstX;
+  nRow0 = rImg.y - nDstY;
+  nCol1 = nCol0 + rImg.w;
+  nRow1 = nRow0 + rImg.h;
+  #endif
+
+  uint16_t nColFgRaw = gslc_DrvAdaptColorToRaw(nCol);
+  uint16_t nColBgRaw = gslc_DrvAdaptColorToRaw(nColBg);
+
+  // Expand the visible rows into the line buffer and push each
+  // buffer with a single block write. Narrow images pack several
+  // rows into the buffer, while wider rows are split into segments.
+  int16_t byteWidth = (w + 7) / 8;
+  nSegW    = (nCol1 - nCol0 < DRV_MONO_LINE_PX_MAX) ? nCol1 - nCol0 : DRV_MONO_LINE_PX_MAX;
+  nRowsMax = DRV_MONO_LINE_PX_MAX / nSegW;
+  for (row=nRow0; row<nRow1; row+=nRows) {
+    nRows = (nRow1 - row < nRowsMax) ? nRow1 - row : nRowsMax;
+    for (nSeg0=nCol0; nSeg0<nCol1; nSeg0+=nSegW) {
+      int16_t   nSeg1 = (nSeg0 + nSegW < nCol1) ? nSeg0 + nSegW : nCol1;
+      uint16_t* pPix  = anPix;
+      for (nInd=0; nInd<nRows; nInd++) {
+        const unsigned char* pRow = pBits + (int32_t)(row + nInd) * byteWidth;
+        nByte = gslc_DrvReadImgByte(bProgMem,pRow + (nSeg0 >> 3)) << (nSeg0 & 7);
+        for (col=nSeg0; col<nSeg1; col++) {
+          if ((col != nSeg0) && ((col & 7) == 0)) {
+            nByte = gslc_DrvReadImgByte(bProgMem,pRow + (col >> 3));
+          }
+          *(pPix++) = (nByte & 0x80) ? nColFgRaw : nColBgRaw;
+          nByte <<= 1;
+        }
+      }
+      gslc_DrvDrawRawBlock(pGui,nDstX+nSeg0,nDstY+row,anPix,nSeg1-nSeg0,nRows,false,0);
+    }
+  }
+}
+
+#if (GSLC_SD_EN)
+// ----- REFERENCE CODE begin
+// The following code was based upon the following reference code but modified to
+// adapt for use in GUIslice.
+//
+//   URL:              https://github.com/adafruit/Adafruit_ILI9341/blob/master/examples/spitftbitmap/spitftbitmap.ino
+//   Original author:  Adafruit
+//   Function:         bmpDraw()
+
+// These read 16- and 32-bit types from the SD card file.
+// BMP data is stored little-endian, Arduino is little-endian too.
+// May need to reverse subscript order if porting elsewhere.
+template <typename T>
+uint16_t gslc_DrvRead16SD(T &f) {
+  uint16_t result;
+  ((uint8_t *)&result)[0] = f.read(); // LSB
+  ((uint8_t *)&result)[1] = f.read(); // MSB
+  return result;
+}
+
+template <typename T>
+uint32_t gslc_DrvRead32SD(T &f) {
+  uint32_t result;
+  ((uint8_t *)&result)[0] = f.read(); // LSB
+  ((uint8_t *)&result)[1] = f.read();
+  ((uint8_t *)&result)[2] = f.read();
+  ((uint8_t *)&result)[3] = f.read(); // MSB
+  return result;
+}
+
+// Parse the BMP header
+// - Supports uncompressed 24-bit and 16-bit (XRGB1555) images as well
+//   as 16-bit images with RGB565 or XRGB1555 bitfield masks
+// - Returns false if the format is not supported
+template <typename T>
+bool gslc_DrvReadBmpInfoSD(T &bmpFile,gslc_tsDrvBmpInfo* pInfo)
+{
+  uint32_t nHdrSize;
+  uint32_t nCompress;
+  uint32_t nMaskR, nMaskG, nMaskB;
+
+  if (gslc_DrvRead16SD(bmpFile) != 0x4D42) { // BMP signature
+    return false;
+  }
+  (void)gslc_DrvRead32SD(bmpFile); // Read & ignore file size
+  (void)gslc_DrvRead32SD(bmpFile); // Read & ignore creator bytes
+  pInfo->nDataOffset = gslc_DrvRead32SD(bmpFile); // Start of image data
+  // Read DIB header
+  nHdrSize    = gslc_DrvRead32SD(bmpFile);
+  pInfo->nW   = (int32_t)gslc_DrvRead32SD(bmpFile);
+  pInfo->nH   = (int32_t)gslc_DrvRead32SD(bmpFile);
+  if (gslc_DrvRead16SD(bmpFile) != 1) { // # planes -- must be '1'
+    return false;
+  }
+  pInfo->nDepth = gslc_DrvRead16SD(bmpFile); // bits per pixel
+  nCompress     = gslc_DrvRead32SD(bmpFile);
+  pInfo->b565   = false;
+  if ((pInfo->nDepth == 24) && (nCompress == 0)) {
+    // 0 = uncompressed
+  } else if ((pInfo->nDepth == 16) && (nCompress == 0)) {
+    // Uncompressed 16-bit images are XRGB1555
+  } else if ((pInfo->nDepth == 16) && (nCompress == 3) && (nHdrSize >= 40)) {
+    // 3 = bitfields: the color masks follow the 40-byte info header
+    bmpFile.seek(14 + 40);
+    nMaskR = gslc_DrvRead32SD(bmpFile);
+    nMaskG = gslc_DrvRead32SD(bmpFile);
+    nMaskB = gslc_DrvRead32SD(bmpFile);
+    if ((nMaskR == 0xF800) && (nMaskG == 0x07E0) && (nMaskB == 0x001F)) {
+      pInfo->b565 = true;
+    } else if ((nMaskR != 0x7C00) || (nMaskG != 0x03E0) || (nMaskB != 0x001F)) {
+      return false;
+    }
+  } else {
+    return false;
+  }
+
+  // If the height is negative, image is in top-down order.
+  // This is not canon but has been observed in the wild.
+  pInfo->bTopDown = false;
+  if (pInfo->nH < 0) {
+    pInfo->nH       = -pInfo->nH;
+    pInfo->bTopDown = true;
+  }
+  if ((pInfo->nW <= 0) || (pInfo->nW > 0x7FFF) || (pInfo->nH == 0) || (pInfo->nH > 0x7FFF)) {
+    return false;
+  }
+  // BMP rows are padded (if needed) to 4-byte boundary
+  pInfo->nRowSize = ((uint32_t)pInfo->nW * (pInfo->nDepth / 8) + 3) & ~3;
+  return true;
+}
+// ----- REFERENCE CODE end
+
+void gslc_DrvDrawBmp24FromSD(gslc_tsGui* pGui,const char *filename, uint16_t x, uint16_t y)
+{
+  File              bmpFile;
+  gslc_tsDrvBmpInfo sInfo;
+  // Row buffer. Pixels are converted in place, as each converted
+  // pixel never occupies more space than in the file.
+  uint16_t          anBuf[(DRV_SD_ROW_BUF_BYTES+1)/2];
+  uint8_t*          pBuf = (uint8_t*)anBuf;
+  uint16_t          nBytesPx;       // Bytes per pixel in the file
+  bool              bTrans = false;
+  uint16_t          nTransRaw = 0;
+  int32_t           nRow0, nRow1, nCol0, nCol1;
+  int32_t           nFileRow, nFileRow0, nFileRow1;
+  int32_t           nRowCnt, nRowMax, nRowInd;
+  int32_t           row, col, nChunk, nChunkMax;
+  uint32_t          nPos, nLen;
+
+  if((x >= pGui->nDispW) || (y >= pGui->nDispH)) return;
+
+  // Open requested file on SD card
+  if ((bmpFile = SD.open(filename)) == 0) {
+    GSLC_DEBUG2_PRINT("ERROR: DrvDrawBmp24FromSD() file not found [%s]",filename);
+    return;
+  }
+  // Parse BMP header
+  if (!gslc_DrvReadBmpInfoSD(bmpFile,&sInfo)) {
+    bmpFile.close();
+    GSLC_DEBUG2_PRINT("ERROR: DrvDrawBmp24FromSD() BMP format unknown [%s]",filename);
+    return;
+  }
+  nBytesPx = sInfo.nDepth / 8;
+
+  // Determine the portion of the image that is visible
+  gslc_tsRect rImg  = (gslc_tsRect) { (int16_t)x, (int16_t)y, (uint16_t)sInfo.nW, (uint16_t)sInfo.nH };
+  gslc_tsRect rDisp = (gslc_tsRect) { 0, 0, pGui->nDispW, pGui->nDispH };
+  bool bVisible = gslc_ClipRect(&rDisp,&rImg);
+  #if (GSLC_CLIP_EN)
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  bVisible = bVisible && gslc_ClipRect(&pDriver->rClipRect,&rImg);
+  #endif
+  if (!bVisible) {
+    bmpFile.close();
+    return;
+  }
+  nCol0 = rImg.x - x;
+  nRow0 = rImg.y - y;
+  nCol1 = nCol0 + rImg.w;
+  nRow1 = nRow0 + rImg.h;
+
+  #if (GSLC_BMP_TRANS_EN)
+  bTrans    = true;
+  nTransRaw = gslc_DrvAdaptColorToRaw(pGui->sTransCol);
+  #endif
+
+  // Visit the rows in file order so that the file is read sequentially
+  // and only needs to be repositioned when columns are clipped
+  if (sInfo.bTopDown) {
+    nFileRow0 = nRow0;
+    nFileRow1 = nRow1;
+  } else {
+    nFileRow0 = sInfo.nH - nRow1;
+    nFileRow1 = sInfo.nH - nRow0;
+  }
+
+  if ((nCol0 == 0) && (nCol1 == sInfo.nW) && (sInfo.nRowSize <= DRV_SD_ROW_BUF_BYTES)) {
+    // Whole rows are visible: read as many rows at a time as fit
+    nRowMax = DRV_SD_ROW_BUF_BYTES / sInfo.nRowSize;
+    for (nFileRow=nFileRow0; nFileRow<nFileRow1; nFileRow+=nRowCnt) {
+      nRowCnt = nFileRow1 - nFileRow;
+      if (nRowCnt > nRowMax) {
+        nRowCnt = nRowMax;
+      }
+      nPos = sInfo.nDataOffset + nFileRow * sInfo.nRowSize;
+      if (bmpFile.position() != nPos) {
+        bmpFile.seek(nPos);
+      }
+      // The padding of the last row may be missing at the end of file
+      nLen = (nRowCnt - 1) * sInfo.nRowSize + sInfo.nW * nBytesPx;
+      if ((uint32_t)bmpFile.read(pBuf,nLen) != nLen) {
+        GSLC_DEBUG2_PRINT("ERROR: DrvDrawBmp24FromSD() file truncated [%s]",filename);
+        break;
+      }
+      // Convert the rows into a contiguous block of pixels
+      for (nRowInd=0; nRowInd<nRowCnt; nRowInd++) {
+        gslc_DrvBmpRowToRaw(pGui,&sInfo,pBuf + nRowInd * sInfo.nRowSize,anBuf + nRowInd * sInfo.nW,
+          sInfo.nW,bTrans,nTransRaw);
+      }
+      if (sInfo.bTopDown) {
+        gslc_DrvDrawRawBlock(pGui,x,y+nFileRow,anBuf,sInfo.nW,nRowCnt,bTrans,nTransRaw);
+      } else {
+        // Bottom-up rows are pushed individually
+        for (nRowInd=0; nRowInd<nRowCnt; nRowInd++) {
+          row = sInfo.nH - 1 - (nFileRow + nRowInd);
+          gslc_DrvDrawRawBlock(pGui,x,y+row,anBuf + nRowInd * sInfo.nW,sInfo.nW,1,bTrans,nTransRaw);
+        }
+      }
+    }
+  } else {
+    // Read the visible portion of each row in segments
+    nChunkMax = DRV_SD_ROW_BUF_BYTES / nBytesPx;
+    for (nFileRow=nFileRow0; nFileRow<nFileRow1; nFileRow++) {
+      row = (sInfo.bTopDown) ? nFileRow : (sInfo.nH - 1 - nFileRow);
+      for (col=nCol0; col<nCol1; col+=nChunk) {
+        nChunk = nCol1 - col;
+        if (nChunk > nChunkMax) {
+          nChunk = nChunkMax;
+        }
+        nPos = sInfo.nDataOffset + nFileRow * sInfo.nRowSize + col * nBytesPx;
+        if (bmpFile.position() != nPos) {
+          bmpFile.seek(nPos);
+        }
+        nLen = nChunk * nBytesPx;
+        if ((uint32_t)bmpFile.read(pBuf,nLen) != nLen) {
+          GSLC_DEBUG2_PRINT("ERROR: DrvDrawBmp24FromSD() file truncated [%s]",filename);
+          bmpFile.close();
+          return;
+        }
+        gslc_DrvBmpRowToRaw(pGui,&sInfo,pBuf,anBuf,nChunk,bTrans,nTransRaw);
+        gslc_DrvDrawRawBlock(pGui,x+col,y+row,anBuf,nChunk,1,bTrans,nTransRaw);
+      }
+    }
+  }
+  bmpFile.close();
+}
+
+#if (DRV_HAS_IMG_CACHE)
+gslc_tsImgCacheEntry* gslc_DrvCacheBmpFromSD(gslc_tsGui* pGui,gslc_tsImgRef sImgRef)
+{
+  const char*           filename = sImgRef.pFname;
+  gslc_tsImgCacheEntry* pEntry = NULL;
+  File                  bmpFile;
+  gslc_tsDrvBmpInfo     sInfo;
+  uint8_t               sdbuffer[DRV_SD_ROW_BUF_BYTES];
+  uint16_t              nBytesPx;   // Bytes per pixel in the file
+  int32_t               row, col;
+  int32_t               nChunk, nChunkMax;
+  uint32_t              nPos;
+  uint16_t*             pPix;
+
+  // Open requested file on SD card
+  if ((bmpFile = SD.open(filename)) == 0) {
+    GSLC_DEBUG2_PRINT("ERROR: DrvCacheBmpFromSD() file not found [%s]",filename);
+    return NULL;
+  }
+
+  // Parse BMP header
+  // - Unsupported files are left to gslc_DrvDrawBmp24FromSD() to report
+  if (!gslc_DrvReadBmpInfoSD(bmpFile,&sInfo)) {
+    bmpFile.close();
+    return NULL;
+  }
+  nBytesPx = sInfo.nDepth / 8;
+
+  // Reserve the cache entry. Images that don't fit within the
+  // cache budget are drawn directly from the file instead.
+  pEntry = gslc_ImgCacheAdd(pGui,sImgRef,(uint16_t)sInfo.nW,(uint16_t)sInfo.nH,sInfo.nRowSize * sInfo.nH);
+  if (pEntry == NULL) {
+    bmpFile.close();
+    return NULL;
+  }
+  #if (GSLC_BMP_TRANS_EN)
+  pEntry->bTrans    = true;
+  pEntry->nTransRaw = gslc_DrvAdaptColorToRaw(pGui->sTransCol);
+  #endif
+
+  // Decode the rows in file order so that the file is read sequentially
+  nChunkMax = sizeof(sdbuffer) / nBytesPx;
+  for (row=0; row<sInfo.nH; row++) {
+    nPos = sInfo.nDataOffset + row * sInfo.nRowSize;
+    if (bmpFile.position() != nPos) {
+      bmpFile.seek(nPos);
+    }
+    pPix = pEntry->pPix + ((sInfo.bTopDown) ? row : (sInfo.nH - 1 - row)) * sInfo.nW;
+    for (col=0; col<sInfo.nW; col+=nChunk) {
+      nChunk = sInfo.nW - col;
+      if (nChunk > nChunkMax) {
+        nChunk = nChunkMax;
+      }
+      if (bmpFile.read(sdbuffer, nChunk*nBytesPx) != nChunk*nBytesPx) {
+        GSLC_DEBUG2_PRINT("ERROR: DrvCacheBmpFromSD() file truncated [%s]",filename);
+        gslc_ImgCacheRemove(pGui,pEntry);
+        bmpFile.close();
+        return NULL;
+      }
+      gslc_DrvBmpRowToRaw(pGui,&sInfo,sdbuffer,pPix,nChunk,pEntry->bTrans,pEntry->nTransRaw);
+      pPix += nChunk;
+    }
+  } // end scanline
+  bmpFile.close();
+  return pEntry;
+}
+#endif // DRV_HAS_IMG_CACHE
+#endif // GSLC_SD_EN
+
+void gslc_DrvBmpRowToRaw(gslc_tsGui* pGui,gslc_tsDrvBmpInfo* pInfo,const uint8_t* pSrc,uint16_t* pDst,
+  uint16_t nPix,bool bTrans,uint16_t nTransRaw)
+{
+  gslc_tsColor  nCol;
+  uint16_t      nVal;
+  uint16_t      nColRaw;
+  uint16_t      nInd;
+
+  for (nInd=0; nInd<nPix; nInd++) {
+    // Read the whole source pixel before writing the output, as the
+    // conversion may be performed in place
+    if (pInfo->nDepth == 24) {
+      nCol = (gslc_tsColor){pSrc[2],pSrc[1],pSrc[0]};
+      pSrc += 3;
+    } else {
+      nVal  = pSrc[0] | (pSrc[1] << 8);
+      pSrc += 2;
+      if (pInfo->b565) {
+        nCol = (gslc_tsColor){(uint8_t)((nVal >> 8) & 0xF8),(uint8_t)((nVal >> 3) & 0xFC),(uint8_t)((nVal << 3) & 0xF8)};
+      } else {
+        nCol = (gslc_tsColor){(uint8_t)((nVal >> 7) & 0xF8),(uint8_t)((nVal >> 2) & 0xF8),(uint8_t)((nVal << 3) & 0xF8)};
+      }
+    }
+    nColRaw = gslc_DrvAdaptColorToRaw(nCol);
+    #if !defined(DRV_COLORMODE_MONO)
+    // Only an exact match with the transparent color is masked, so
+    // nudge other colors that convert to the same display value
+    // - 16-bit pixels are compared with the transparent color
+    //   after conversion, as they can't represent it exactly
+    if ((bTrans) && (pInfo->nDepth == 24) && (nColRaw == nTransRaw)) {
+      if (!gslc_ColorEqual(nCol,pGui->sTransCol)) {
+        nColRaw ^= 0x0001;
+      }
+    }
+    #else
+    (void)pGui; // Unused
+    (void)bTrans; // Unused
+    (void)nTransRaw; // Unused
+    #endif
+    pDst[nInd] = nColRaw;
+  }
+}
+
+#endif // _GUISLICE_DRV_COMMON_IMPL_H_
@@ -0,0 +1,1214 @@
+// =======================================================================
+// GUIslice library (driver layer for software framebuffer)
+// - Calvin Hass
+// - https://www.impulseadventure.com/elec/guislice-gui.html
+// - https://github.com/ImpulseAdventure/GUIslice
+// =======================================================================
+//
+// The MIT License
+//
+// Copyright 2016-2020 Calvin Hass
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// =======================================================================
+/// \file GUIslice_drv_fb.c
+
+// Compiler guard for requested driver
+#include "GUIslice_config.h" // Sets DRV_DISP_*
+#if defined(DRV_DISP_FB)
+
+// =======================================================================
+// Driver Layer for software framebuffer
+// =======================================================================
+
+
+// GUIslice library
+#include "GUIslice_drv_fb.h"
+
+#include <stdio.h>
+#include <stdlib.h>     // For malloc()
+#include <string.h>     // For memcpy()
+#include <fcntl.h>      // For open()
+#include <unistd.h>     // For close()
+#include <sys/mman.h>   // For mmap()
+#include <sys/ioctl.h>  // For ioctl()
+#include <linux/fb.h>   // For FBIOGET_*
+
+// ------------------------------------------------------------------------
+// Load display & touch drivers
+// ------------------------------------------------------------------------
+
+// Define driver names
+const char* m_acDrvDisp = "FB";
+const char* m_acDrvTouch = "NONE";
+
+
+// ------------------------------------------------------------------------
+// Built-in font
+// - Classic 5x7 font for ASCII 0x20..0x7E
+// - Each glyph is 5 columns, with bit 0 at the top row
+// - Glyphs are rendered in a 6x8 cell (including spacing)
+// ------------------------------------------------------------------------
+
+#define DRV_FB_FONT_FIRST   0x20
+#define DRV_FB_FONT_LAST    0x7E
+#define DRV_FB_FONT_COLS    5
+#define DRV_FB_FONT_CELL_W  6
+#define DRV_FB_FONT_CELL_H  8
+
+const uint8_t m_anFont5x7[] = {
+  0x00,0x00,0x00,0x00,0x00, // ' '
+  0x00,0x00,0x5F,0x00,0x00, // '!'
+  0x00,0x07,0x00,0x07,0x00, // '"'
+  0x14,0x7F,0x14,0x7F,0x14, // '#'
+  0x24,0x2A,0x7F,0x2A,0x12, // '$'
+  0x23,0x13,0x08,0x64,0x62, // '%'
+  0x36,0x49,0x55,0x22,0x50, // '&'
+  0x00,0x05,0x03,0x00,0x00, // '''
+  0x00,0x1C,0x22,0x41,0x00, // '('
+  0x00,0x41,0x22,0x1C,0x00, // ')'
+  0x14,0x08,0x3E,0x08,0x14, // '*'
+  0x08,0x08,0x3E,0x08,0x08, // '+'
+  0x00,0x50,0x30,0x00,0x00, // ','
+  0x08,0x08,0x08,0x08,0x08, // '-'
+  0x00,0x60,0x60,0x00,0x00, // '.'
+  0x20,0x10,0x08,0x04,0x02, // '/'
+  0x3E,0x51,0x49,0x45,0x3E, // '0'
+  0x00,0x42,0x7F,0x40,0x00, // '1'
+  0x42,0x61,0x51,0x49,0x46, // '2'
+  0x21,0x41,0x45,0x4B,0x31, // '3'
+  0x18,0x14,0x12,0x7F,0x10, // '4'
+  0x27,0x45,0x45,0x45,0x39, // '5'
+  0x3C,0x4A,0x49,0x49,0x30, // '6'
+  0x01,0x71,0x09,0x05,0x03, // '7'
+  0x36,0x49,0x49,0x49,0x36, // '8'
+  0x06,0x49,0x49,0x29,0x1E, // '9'
+  0x00,0x36,0x36,0x00,0x00, // ':'
+  0x00,0x56,0x36,0x00,0x00, // ';'
+  0x08,0x14,0x22,0x41,0x00, // '<'
+  0x14,0x14,0x14,0x14,0x14, // '='
+  0x00,0x41,0x22,0x14,0x08, // '>'
+  0x02,0x01,0x51,0x09,0x06, // '?'
+  0x32,0x49,0x79,0x41,0x3E, // '@'
+  0x7E,0x11,0x11,0x11,0x7E, // 'A'
+  0x7F,0x49,0x49,0x49,0x36, // 'B'
+  0x3E,0x41,0x41,0x41,0x22, // 'C'
+  0x7F,0x41,0x41,0x22,0x1C, // 'D'
+  0x7F,0x49,0x49,0x49,0x41, // 'E'
+  0x7F,0x09,0x09,0x09,0x01, // 'F'
+  0x3E,0x41,0x49,0x49,0x7A, // 'G'
+  0x7F,0x08,0x08,0x08,0x7F, // 'H'
+  0x00,0x41,0x7F,0x41,0x00, // 'I'
+  0x20,0x40,0x41,0x3F,0x01, // 'J'
+  0x7F,0x08,0x14,0x22,0x41, // 'K'
+  0x7F,0x40,0x40,0x40,0x40, // 'L'
+  0x7F,0x02,0x0C,0x02,0x7F, // 'M'
+  0x7F,0x04,0x08,0x10,0x7F, // 'N'
+  0x3E,0x41,0x41,0x41,0x3E, // 'O'
+  0x7F,0x09,0x09,0x09,0x06, // 'P'
+  0x3E,0x41,0x51,0x21,0x5E, // 'Q'
+  0x7F,0x09,0x19,0x29,0x46, // 'R'
+  0x46,0x49,0x49,0x49,0x31, // 'S'
+  0x01,0x01,0x7F,0x01,0x01, // 'T'
+  0x3F,0x40,0x40,0x40,0x3F, // 'U'
+  0x1F,0x20,0x40,0x20,0x1F, // 'V'
+  0x3F,0x40,0x38,0x40,0x3F, // 'W'
+  0x63,0x14,0x08,0x14,0x63, // 'X'
+  0x07,0x08,0x70,0x08,0x07, // 'Y'
+  0x61,0x51,0x49,0x45,0x43, // 'Z'
+  0x00,0x7F,0x41,0x41,0x00, // '['
+  0x02,0x04,0x08,0x10,0x20, // '\'
+  0x00,0x41,0x41,0x7F,0x00, // ']'
+  0x04,0x02,0x01,0x02,0x04, // '^'
+  0x40,0x40,0x40,0x40,0x40, // '_'
+  0x00,0x01,0x02,0x04,0x00, // '`'
+  0x20,0x54,0x54,0x54,0x78, // 'a'
+  0x7F,0x48,0x44,0x44,0x38, // 'b'
+  0x38,0x44,0x44,0x44,0x20, // 'c'
+  0x38,0x44,0x44,0x48,0x7F, // 'd'
+  0x38,0x54,0x54,0x54,0x18, // 'e'
+  0x08,0x7E,0x09,0x01,0x02, // 'f'
+  0x0C,0x52,0x52,0x52,0x3E, // 'g'
+  0x7F,0x08,0x04,0x04,0x78, // 'h'
+  0x00,0x44,0x7D,0x40,0x00, // 'i'
+  0x20,0x40,0x44,0x3D,0x00, // 'j'
+  0x7F,0x10,0x28,0x44,0x00, // 'k'
+  0x00,0x41,0x7F,0x40,0x00, // 'l'
+  0x7C,0x04,0x18,0x04,0x78, // 'm'
+  0x7C,0x08,0x04,0x04,0x78, // 'n'
+  0x38,0x44,0x44,0x44,0x38, // 'o'
+  0x7C,0x14,0x14,0x14,0x08, // 'p'
+  0x08,0x14,0x14,0x18,0x7C, // 'q'
+  0x7C,0x08,0x04,0x04,0x08, // 'r'
+  0x48,0x54,0x54,0x54,0x20, // 's'
+  0x04,0x3F,0x44,0x40,0x20, // 't'
+  0x3C,0x40,0x40,0x20,0x7C, // 'u'
+  0x1C,0x20,0x40,0x20,0x1C, // 'v'
+  0x3C,0x40,0x30,0x40,0x3C, // 'w'
+  0x44,0x28,0x10,0x28,0x44, // 'x'
+  0x0C,0x50,0x50,0x50,0x3C, // 'y'
+  0x44,0x64,0x54,0x4C,0x44, // 'z'
+  0x00,0x08,0x36,0x41,0x00, // '{'
+  0x00,0x00,0x7F,0x00,0x00, // '|'
+  0x00,0x41,0x36,0x08,0x00, // '}'
+  0x08,0x04,0x08,0x10,0x08, // '~'
+};
+
+
+// =======================================================================
+// Public APIs to GUIslice core library
+// =======================================================================
+
+// -----------------------------------------------------------------------
+// Configuration Functions
+// -----------------------------------------------------------------------
+
+bool gslc_DrvInit(gslc_tsGui* pGui)
+{
+  // Primary surface definitions
+  pGui->sImgRefBkgnd = gslc_ResetImage();
+
+  if (pGui->pvDriver == NULL) {
+    GSLC_DEBUG2_PRINT("ERROR: DrvInit(%s) called with NULL driver\n","");
+    return false;
+  }
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+
+  pDriver->pFrame       = NULL;
+  pDriver->anDmgX0      = NULL;
+  pDriver->anDmgX1      = NULL;
+  pDriver->nSinkFd      = -1;
+  pDriver->pSinkMap     = NULL;
+  pDriver->nSinkMapLen  = 0;
+  pDriver->nFlushSpanCnt = 0;
+  pDriver->nFlushPixCnt = 0;
+  pDriver->nStatDrawCnt = 0;
+  pDriver->nStatPixCnt  = 0;
+  pDriver->nColBkgnd    = GSLC_COL_BLACK;
+
+  // The frame persists between page flips, so only the
+  // invalidated regions need to be redrawn
+  pGui->bRedrawPartialEn = true;
+
+  // Open the output sink, which also determines the frame dimensions
+  if (!gslc_DrvFbSinkOpen(pGui)) {
+    return false;
+  }
+
+  // Allocate the frame and damage tracking
+  uint16_t nW = pDriver->nFrameW;
+  uint16_t nH = pDriver->nFrameH;
+  pDriver->pFrame   = (uint8_t*)calloc((size_t)nW*nH,DRV_FB_PIX_BYTES);
+  pDriver->anDmgX0  = (int16_t*)malloc(nH*sizeof(int16_t));
+  pDriver->anDmgX1  = (int16_t*)malloc(nH*sizeof(int16_t));
+  if ((pDriver->pFrame == NULL) || (pDriver->anDmgX0 == NULL) || (pDriver->anDmgX1 == NULL)) {
+    GSLC_DEBUG2_PRINT("ERROR: DrvInit() failed to allocate %ux%u frame\n",nW,nH);
+    return false;
+  }
+  uint16_t nRow;
+  for (nRow=0;nRow<nH;nRow++) {
+    pDriver->anDmgX0[nRow] = (int16_t)nW;
+    pDriver->anDmgX1[nRow] = -1;
+  }
+  pDriver->nDmgY0 = (int16_t)nH;
+  pDriver->nDmgY1 = -1;
+
+  // Save a copy of the display dimensions
+  pGui->nDisp0W     = nW;
+  pGui->nDisp0H     = nH;
+  pGui->nDispW      = nW;
+  pGui->nDispH      = nH;
+  pGui->nDispDepth  = (DRV_FB_FMT == DRV_FB_FMT_RGB565)? 16 : 24;
+
+  pDriver->rClipRect = (gslc_tsRect){0,0,nW,nH};
+
+  #if defined(DBG_DRIVER)
+  GSLC_DEBUG_PRINT("DBG: Frame: %u x %u x %u bit/pixel, sink bpp=%u direct=%u\n",
+          pGui->nDispW,pGui->nDispH,pGui->nDispDepth,pDriver->nSinkBpp,pDriver->bSinkDirect);
+  #endif
+
+  return true;
+}
+
+void* gslc_DrvGetDriverDisp(gslc_tsGui* pGui)
+{
+  return (pGui->pvDriver);
+}
+
+void gslc_DrvDestruct(gslc_tsGui* pGui)
+{
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  if (pDriver == NULL) {
+    return;
+  }
+  if (pDriver->pSinkMap) {
+    munmap(pDriver->pSinkMap,pDriver->nSinkMapLen);
+    pDriver->pSinkMap = NULL;
+  }
+  if (pDriver->nSinkFd >= 0) {
+    close(pDriver->nSinkFd);
+    pDriver->nSinkFd = -1;
+  }
+  free(pDriver->pFrame);
+  free(pDriver->anDmgX0);
+  free(pDriver->anDmgX1);
+  pDriver->pFrame  = NULL;
+  pDriver->anDmgX0 = NULL;
+  pDriver->anDmgX1 = NULL;
+}
+
+const char* gslc_DrvGetNameDisp(gslc_tsGui* pGui)
+{
+  (void)pGui; // Unused
+  return m_acDrvDisp;
+}
+
+const char* gslc_DrvGetNameTouch(gslc_tsGui* pGui)
+{
+  (void)pGui; // Unused
+  return m_acDrvTouch;
+}
+
+// -----------------------------------------------------------------------
+// Image/surface handling Functions
+// -----------------------------------------------------------------------
+
+// Load a BMP file into the native frame format
+// - Supports uncompressed 16-bit (RGB555 / RGB565 bitfields),
+//   24-bit and 32-bit images
+void* gslc_DrvLoadImage(gslc_tsGui* pGui,gslc_tsImgRef sImgRef)
+{
+  (void)pGui; // Unused
+
+  if ((sImgRef.eImgFlags & GSLC_IMGREF_SRC) != GSLC_IMGREF_SRC_FILE) {
+    // Images in memory are drawn directly from their source
+    return NULL;
+  }
+
+  const char* pStrFname = sImgRef.pFname;
+  FILE* pFile = fopen(pStrFname,"rb");
+  if (pFile == NULL) {
+    GSLC_DEBUG2_PRINT("ERROR: DrvLoadImage(%s) failed to open file\n",pStrFname);
+    return NULL;
+  }
+
+  uint8_t anHdr[54];
+  if ((fread(anHdr,1,sizeof(anHdr),pFile) != sizeof(anHdr)) || (anHdr[0] != 'B') || (anHdr[1] != 'M')) {
+    GSLC_DEBUG2_PRINT("ERROR: DrvLoadImage(%s) not a BMP file\n",pStrFname);
+    fclose(pFile);
+    return NULL;
+  }
+  uint32_t nOffset    = anHdr[10] | (anHdr[11]<<8) | (anHdr[12]<<16) | ((uint32_t)anHdr[13]<<24);
+  int32_t  nImgW      = (int32_t)(anHdr[18] | (anHdr[19]<<8) | (anHdr[20]<<16) | ((uint32_t)anHdr[21]<<24));
+  int32_t  nImgH      = (int32_t)(anHdr[22] | (anHdr[23]<<8) | (anHdr[24]<<16) | ((uint32_t)anHdr[25]<<24));
+  uint16_t nBpp       = anHdr[28] | (anHdr[29]<<8);
+  uint32_t nCompress  = anHdr[30] | (anHdr[31]<<8) | (anHdr[32]<<16) | ((uint32_t)anHdr[33]<<24);
+
+  // Rows are stored bottom-up unless the height is negative
+  bool bTopDown = (nImgH < 0);
+  if (bTopDown) { nImgH = -nImgH; }
+  if ((nImgW <= 0) || (nImgH <= 0) || (nImgW > 0xFFFF) || (nImgH > 0xFFFF) ||
+      ((nBpp != 16) && (nBpp != 24) && (nBpp != 32)) ||
+      ((nCompress != 0) && (nCompress != 3))) {
+    GSLC_DEBUG2_PRINT("ERROR: DrvLoadImage(%s) unsupported BMP format (bpp=%u)\n",pStrFname,nBpp);
+    fclose(pFile);
+    return NULL;
+  }
+  // 16-bit images with bitfields are assumed to be RGB565
+  bool bRgb565 = (nBpp == 16) && (nCompress == 3);
+
+  gslc_tsDrvFbImg* pImg = (gslc_tsDrvFbImg*)malloc(sizeof(gslc_tsDrvFbImg));
+  uint32_t nStride = (((uint32_t)nImgW * nBpp + 31) / 32) * 4;
+  uint8_t* pRow = (uint8_t*)malloc(nStride);
+  if (pImg) {
+    pImg->pPix = (uint8_t*)malloc((size_t)nImgW*nImgH*DRV_FB_PIX_BYTES);
+  }
+  if ((pImg == NULL) || (pRow == NULL) || (pImg->pPix == NULL)) {
+    GSLC_DEBUG2_PRINT("ERROR: DrvLoadImage(%s) failed to allocate image\n",pStrFname);
+    if (pImg) { free(pImg->pPix); }
+    free(pImg);
+    free(pRow);
+    fclose(pFile);
+    return NULL;
+  }
+  pImg->nW = (uint16_t)nImgW;
+  pImg->nH = (uint16_t)nImgH;
+
+  fseek(pFile,(long)nOffset,SEEK_SET);
+  int32_t nRow,nCol;
+  for (nRow=0;nRow<nImgH;nRow++) {
+    if (fread(pRow,1,nStride,pFile) != nStride) {
+      GSLC_DEBUG2_PRINT("ERROR: DrvLoadImage(%s) truncated file\n",pStrFname);
+      gslc_DrvImageDestruct(pImg);
+      free(pRow);
+      fclose(pFile);
+      return NULL;
+    }
+    int32_t nDstRow = (bTopDown)? nRow : (nImgH-1-nRow);
+    uint8_t* pDst = pImg->pPix + (size_t)nDstRow*nImgW*DRV_FB_PIX_BYTES;
+    for (nCol=0;nCol<nImgW;nCol++) {
+      gslc_tsColor nCol8;
+      if (nBpp == 16) {
+        uint16_t nPix = pRow[nCol*2] | (pRow[nCol*2+1]<<8);
+        if (bRgb565) {
+          nCol8.r = (uint8_t)(((nPix >> 11) & 0x1F) << 3);
+          nCol8.g = (uint8_t)(((nPix >>  5) & 0x3F) << 2);
+        } else {
+          nCol8.r = (uint8_t)(((nPix >> 10) & 0x1F) << 3);
+          nCol8.g = (uint8_t)(((nPix >>  5) & 0x1F) << 3);
+        }
+        nCol8.b = (uint8_t)((nPix & 0x1F) << 3);
+      } else {
+        uint8_t* pSrc = pRow + nCol*(nBpp/8);
+        nCol8.b = pSrc[0];
+        nCol8.g = pSrc[1];
+        nCol8.r = pSrc[2];
+      }
+      uint32_t nColRaw = gslc_DrvFbAdaptColorRaw(nCol8);
+      #if (DRV_FB_FMT == DRV_FB_FMT_RGB565)
+      ((uint16_t*)pDst)[nCol] = (uint16_t)nColRaw;
+      #else
+      ((uint32_t*)pDst)[nCol] = nColRaw;
+      #endif
+    }
+  }
+
+  free(pRow);
+  fclose(pFile);
+  return (void*)pImg;
+}
+
+
+bool gslc_DrvSetBkgndImage(gslc_tsGui* pGui,gslc_tsImgRef sImgRef)
+{
+  // Dispose of previous background
+  if (pGui->sImgRefBkgnd.eImgFlags != GSLC_IMGREF_NONE) {
+    gslc_DrvImageDestruct(pGui->sImgRefBkgnd.pvImgRaw);
+    pGui->sImgRefBkgnd = gslc_ResetImage();
+  }
+
+  pGui->sImgRefBkgnd = sImgRef;
+  pGui->sImgRefBkgnd.pvImgRaw = gslc_DrvLoadImage(pGui,sImgRef);
+  if (((sImgRef.eImgFlags & GSLC_IMGREF_SRC) == GSLC_IMGREF_SRC_FILE) && (pGui->sImgRefBkgnd.pvImgRaw == NULL)) {
+    GSLC_DEBUG2_PRINT("ERROR: DrvSetBkgndImage(%s) failed\n","");
+    pGui->sImgRefBkgnd = gslc_ResetImage();
+    return false;
+  }
+
+  return true;
+}
+
+bool gslc_DrvSetBkgndColor(gslc_tsGui* pGui,gslc_tsColor nCol)
+{
+  // Dispose of previous background
+  if (pGui->sImgRefBkgnd.eImgFlags != GSLC_IMGREF_NONE) {
+    gslc_DrvImageDestruct(pGui->sImgRefBkgnd.pvImgRaw);
+    pGui->sImgRefBkgnd = gslc_ResetImage();
+  }
+
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  pDriver->nColBkgnd = nCol;
+  return true;
+}
+
+
+bool gslc_DrvSetElemImageNorm(gslc_tsGui* pGui,gslc_tsElem* pElem,gslc_tsImgRef sImgRef)
+{
+  // Dispose of previous image
+  if (pElem->sImgRefNorm.eImgFlags != GSLC_IMGREF_NONE) {
+    gslc_DrvImageDestruct(pElem->sImgRefNorm.pvImgRaw);
+    pElem->sImgRefNorm = gslc_ResetImage();
+  }
+
+  pElem->sImgRefNorm = sImgRef;
+  pElem->sImgRefNorm.pvImgRaw = gslc_DrvLoadImage(pGui,sImgRef);
+  if (((sImgRef.eImgFlags & GSLC_IMGREF_SRC) == GSLC_IMGREF_SRC_FILE) && (pElem->sImgRefNorm.pvImgRaw == NULL)) {
+    GSLC_DEBUG2_PRINT("ERROR: DrvSetElemImageNorm(%s) failed\n","");
+    return false;
+  }
+  return true;
+}
+
+
+bool gslc_DrvSetElemImageGlow(gslc_tsGui* pGui,gslc_tsElem* pElem,gslc_tsImgRef sImgRef)
+{
+  // Dispose of previous image
+  if (pElem->sImgRefGlow.eImgFlags != GSLC_IMGREF_NONE) {
+    gslc_DrvImageDestruct(pElem->sImgRefGlow.pvImgRaw);
+    pElem->sImgRefGlow = gslc_ResetImage();
+  }
+
+  pElem->sImgRefGlow = sImgRef;
+  pElem->sImgRefGlow.pvImgRaw = gslc_DrvLoadImage(pGui,sImgRef);
+  if (((sImgRef.eImgFlags & GSLC_IMGREF_SRC) == GSLC_IMGREF_SRC_FILE) && (pElem->sImgRefGlow.pvImgRaw == NULL)) {
+    GSLC_DEBUG2_PRINT("ERROR: DrvSetElemImageGlow(%s) failed\n","");
+    return false;
+  }
+  return true;
+}
+
+
+void gslc_DrvImageDestruct(void* pvImg)
+{
+  if (pvImg == NULL) {
+    return;
+  }
+  gslc_tsDrvFbImg* pImg = (gslc_tsDrvFbImg*)pvImg;
+  free(pImg->pPix);
+  free(pImg);
+}
+
+bool gslc_DrvSetClipRect(gslc_tsGui* pGui,gslc_tsRect* pRect)
+{
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  gslc_tsRect rFrame = (gslc_tsRect){0,0,pDriver->nFrameW,pDriver->nFrameH};
+  if (pRect == NULL) {
+    pDriver->rClipRect = rFrame;
+  } else {
+    // Limit the clipping region to the frame so that drawing
+    // routines only need to check against the clipping region
+    pDriver->rClipRect = *pRect;
+    if (!gslc_ClipRect(&rFrame,&pDriver->rClipRect)) {
+      pDriver->rClipRect = (gslc_tsRect){0,0,0,0};
+    }
+  }
+  return true;
+}
+
+
+
+// -----------------------------------------------------------------------
+// Font handling Functions
+// -----------------------------------------------------------------------
+
+const void* gslc_DrvFontAdd(gslc_teFontRefType eFontRefType,const void* pvFontRef,uint16_t nFontSz)
+{
+  (void)nFontSz; // Unused
+  if (eFontRefType == GSLC_FONTREF_FNAME) {
+    // Font files are not rendered. Text is drawn with the built-in
+    // font at a scale approximating the requested point size.
+    #if defined(DBG_DRIVER)
+    GSLC_DEBUG_PRINT("DBG: DrvFontAdd(%s) using built-in font\n",(const char*)pvFontRef);
+    #endif
+  } else if (pvFontRef != NULL) {
+    GSLC_DEBUG2_PRINT("ERROR: DrvFontAdd(%s) failed - FB mode only supports the built-in font\n","");
+    return NULL;
+  }
+  return (const void*)m_anFont5x7;
+}
+
+void gslc_DrvFontsDestruct(gslc_tsGui* pGui)
+{
+  (void)pGui; // Nothing to deallocate
+}
+
+uint8_t gslc_DrvFbFontScale(gslc_tsFont* pFont)
+{
+  int16_t nScale = pFont->nSize;
+  if (pFont->eFontRefType == GSLC_FONTREF_FNAME) {
+    // Map the point size to the nearest multiple of the cell height
+    nScale = (pFont->nSize + DRV_FB_FONT_CELL_H/2) / DRV_FB_FONT_CELL_H;
+  }
+  return (nScale < 1)? 1 : (uint8_t)nScale;
+}
+
+bool gslc_DrvGetTxtSize(gslc_tsGui* pGui,gslc_tsFont* pFont,const char* pStr,gslc_teTxtFlags eTxtFlags,
+        int16_t* pnTxtX,int16_t* pnTxtY,uint16_t* pnTxtSzW,uint16_t* pnTxtSzH)
+{
+  (void)pGui; // Unused
+  (void)eTxtFlags; // Unused
+  if ((pFont == NULL) || (pFont->pvFont == NULL)) { return false; }
+
+  uint8_t   nScale = gslc_DrvFbFontScale(pFont);
+  uint16_t  nLineLen = 0;
+  uint16_t  nLineLenMax = 0;
+  uint16_t  nLines = 1;
+  for (;*pStr;pStr++) {
+    if (*pStr == '\n') {
+      nLines++;
+      nLineLen = 0;
+      continue;
+    }
+    nLineLen++;
+    if (nLineLen > nLineLenMax) { nLineLenMax = nLineLen; }
+  }
+  *pnTxtSzW = nLineLenMax * DRV_FB_FONT_CELL_W * nScale;
+  *pnTxtSzH = nLines * DRV_FB_FONT_CELL_H * nScale;
+  // No offset coordinates used
+  *pnTxtX = 0;
+  *pnTxtY = 0;
+  return true;
+}
+
+
+bool gslc_DrvDrawTxt(gslc_tsGui* pGui,int16_t nTxtX,int16_t nTxtY,gslc_tsFont* pFont,const char* pStr,gslc_teTxtFlags eTxtFlags,gslc_tsColor colTxt, gslc_tsColor colBg)
+{
+  (void)eTxtFlags; // Unused
+  (void)colBg; // Unused
+  if ((pGui == NULL) || (pFont == NULL)) {
+    GSLC_DEBUG2_PRINT("ERROR: DrvDrawTxt(%s) with NULL ptr\n","");
+    return false;
+  }
+  if ((pStr == NULL) || (pStr[0] == '\0')) {
+    return true;
+  }
+
+  gslc_tsDriver*  pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  uint32_t        nColRaw = gslc_DrvFbAdaptColorRaw(colTxt);
+  uint8_t         nScale  = gslc_DrvFbFontScale(pFont);
+  int16_t         nX      = nTxtX;
+  int16_t         nY      = nTxtY;
+  uint8_t         nCol,nRow;
+
+  pDriver->nStatDrawCnt++;
+  for (;*pStr;pStr++) {
+    uint8_t nChar = (uint8_t)*pStr;
+    if (nChar == '\n') {
+      nX  = nTxtX;
+      nY += DRV_FB_FONT_CELL_H * nScale;
+      continue;
+    }
+    if ((nChar < DRV_FB_FONT_FIRST) || (nChar > DRV_FB_FONT_LAST)) {
+      nChar = '?';
+    }
+    const uint8_t* pGlyph = &m_anFont5x7[(nChar - DRV_FB_FONT_FIRST) * DRV_FB_FONT_COLS];
+
+    // Render each row of the glyph as horizontal spans so that
+    // runs of set pixels (and scaled pixels) are filled together
+    for (nRow=0;nRow<DRV_FB_FONT_CELL_H-1;nRow++) {
+      int16_t nRunX = -1;
+      for (nCol=0;nCol<=DRV_FB_FONT_COLS;nCol++) {
+        bool bSet = (nCol < DRV_FB_FONT_COLS) && (pGlyph[nCol] & (1 << nRow));
+        if (bSet && (nRunX < 0)) {
+          nRunX = nCol;
+        } else if (!bSet && (nRunX >= 0)) {
+          uint8_t nSub;
+          for (nSub=0;nSub<nScale;nSub++) {
+            gslc_DrvFbFillSpan(pDriver,nX + nRunX*nScale,nY + nRow*nScale + nSub,
+              (int32_t)(nCol-nRunX)*nScale,nColRaw);
+          }
+          nRunX = -1;
+        }
+      }
+    }
+    nX += DRV_FB_FONT_CELL_W * nScale;
+  }
+
+  return true;
+}
+
+
+// -----------------------------------------------------------------------
+// Screen Management Functions
+// -----------------------------------------------------------------------
+
+void gslc_DrvPageFlipNow(gslc_tsGui* pGui)
+{
+  // Copy the modified portion of the frame to the sink
+  gslc_DrvFbFlush(pGui);
+}
+
+
+// -----------------------------------------------------------------------
+// Graphics Primitives Functions
+// -----------------------------------------------------------------------
+
+
+bool gslc_DrvDrawPoint(gslc_tsGui* pGui,int16_t nX,int16_t nY,gslc_tsColor nCol)
+{
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  pDriver->nStatDrawCnt++;
+  gslc_DrvFbFillSpan(pDriver,nX,nY,1,gslc_DrvFbAdaptColorRaw(nCol));
+  return true;
+}
+
+bool gslc_DrvDrawPoints(gslc_tsGui* pGui,gslc_tsPt* asPt,uint16_t nNumPt,gslc_tsColor nCol)
+{
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  pDriver->nStatDrawCnt++;
+  uint32_t nColRaw = gslc_DrvFbAdaptColorRaw(nCol);
+  uint16_t nIndPt;
+  for (nIndPt=0;nIndPt<nNumPt;nIndPt++) {
+    gslc_DrvFbFillSpan(pDriver,asPt[nIndPt].x,asPt[nIndPt].y,1,nColRaw);
+  }
+  return true;
+}
+
+bool gslc_DrvDrawFillRect(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColor nCol)
+{
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  pDriver->nStatDrawCnt++;
+  if (!gslc_ClipRect(&pDriver->rClipRect,&rRect)) {
+    return true;
+  }
+  uint32_t nColRaw = gslc_DrvFbAdaptColorRaw(nCol);
+  int16_t nRow;
+  for (nRow=0;nRow<(int16_t)rRect.h;nRow++) {
+    gslc_DrvFbFillSpan(pDriver,rRect.x,rRect.y+nRow,rRect.w,nColRaw);
+  }
+  return true;
+}
+
+bool gslc_DrvDrawFrameRect(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColor nCol)
+{
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  pDriver->nStatDrawCnt++;
+  uint32_t nColRaw = gslc_DrvFbAdaptColorRaw(nCol);
+  int16_t nX0 = rRect.x;
+  int16_t nY0 = rRect.y;
+  int16_t nX1 = rRect.x + rRect.w - 1;
+  int16_t nY1 = rRect.y + rRect.h - 1;
+  int16_t nRow;
+  gslc_DrvFbFillSpan(pDriver,nX0,nY0,rRect.w,nColRaw);   // Top
+  gslc_DrvFbFillSpan(pDriver,nX0,nY1,rRect.w,nColRaw);   // Bottom
+  for (nRow=nY0+1;nRow<nY1;nRow++) {
+    gslc_DrvFbFillSpan(pDriver,nX0,nRow,1,nColRaw);      // Left
+    gslc_DrvFbFillSpan(pDriver,nX1,nRow,1,nColRaw);      // Right
+  }
+  return true;
+}
+
+
+bool gslc_DrvDrawLine(gslc_tsGui* pGui,int16_t nX0,int16_t nY0,int16_t nX1,int16_t nY1,gslc_tsColor nCol)
+{
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  pDriver->nStatDrawCnt++;
+  uint32_t nColRaw = gslc_DrvFbAdaptColorRaw(nCol);
+
+  // Horizontal lines are drawn as a single span
+  if (nY0 == nY1) {
+    gslc_DrvFbFillSpan(pDriver,GSLC_MIN(nX0,nX1),nY0,abs(nX1-nX0)+1,nColRaw);
+    return true;
+  }
+
+  // Bresenham's line algorithm
+  int16_t nDX = abs(nX1-nX0);
+  int16_t nDY = abs(nY1-nY0);
+  int16_t nSX = (nX0 < nX1)? 1 : -1;
+  int16_t nSY = (nY0 < nY1)? 1 : -1;
+  int16_t nErr = ( (nDX>nDY)? nDX : -nDY )/2;
+  int16_t nE2;
+  for (;;) {
+    gslc_DrvFbFillSpan(pDriver,nX0,nY0,1,nColRaw);
+    if ((nX0 == nX1) && (nY0 == nY1)) break;
+    nE2 = nErr;
+    if (nE2 > -nDX) { nErr -= nDY; nX0 += nSX; }
+    if (nE2 <  nDY) { nErr += nDX; nY0 += nSY; }
+  }
+  return true;
+}
+
+
+void gslc_DrvDrawMonoFromMem(gslc_tsGui* pGui,int16_t nDstX, int16_t nDstY,
+ const unsigned char *pBitmap,bool bProgMem)
+{
+  (void)bProgMem; // No distinction between Flash and RAM in LINUX
+  gslc_tsDriver*        pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  const unsigned char*  pData = pBitmap;
+  int16_t               nW,nH;
+  gslc_tsColor          nCol;
+
+  pDriver->nStatDrawCnt++;
+
+  // Read header
+  nW      = (pData[0] << 8) | pData[1];
+  nH      = (pData[2] << 8) | pData[3];
+  nCol.r  = pData[4];
+  nCol.g  = pData[5];
+  nCol.b  = pData[6];
+  pData  += 7;
+
+  uint32_t  nColRaw = gslc_DrvFbAdaptColorRaw(nCol);
+  int16_t   nByteWidth = (nW + 7) / 8;
+  int16_t   nRow,nCol0,nCol1;
+  for (nRow=0;nRow<nH;nRow++) {
+    const unsigned char* pRow = pData + nRow*nByteWidth;
+    // Fill runs of set bits as spans
+    nCol0 = 0;
+    while (nCol0 < nW) {
+      if (!(pRow[nCol0/8] & (0x80 >> (nCol0 & 7)))) {
+        nCol0++;
+        continue;
+      }
+      nCol1 = nCol0 + 1;
+      while ((nCol1 < nW) && (pRow[nCol1/8] & (0x80 >> (nCol1 & 7)))) {
+        nCol1++;
+      }
+      gslc_DrvFbFillSpan(pDriver,nDstX+nCol0,nDstY+nRow,nCol1-nCol0,nColRaw);
+      nCol0 = nCol1;
+    }
+  }
+}
+
+void gslc_DrvDrawBmp24FromMem(gslc_tsGui* pGui,int16_t nDstX, int16_t nDstY,const unsigned char* pBitmap,bool bProgMem)
+{
+  (void)bProgMem; // No distinction between Flash and RAM in LINUX
+  gslc_tsDriver*  pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  const uint16_t* pImage = (const uint16_t*)pBitmap;
+  pDriver->nStatDrawCnt++;
+  int16_t nH = (int16_t)pImage[0];
+  int16_t nW = (int16_t)pImage[1];
+  pImage += 2;
+
+  // Determine the portion of the image within the clipping region
+  gslc_tsRect rImg = (gslc_tsRect) { nDstX, nDstY, (uint16_t)nW, (uint16_t)nH };
+  if (!gslc_ClipRect(&pDriver->rClipRect,&rImg)) { return; }
+  int16_t nCol0 = rImg.x - nDstX;
+  int16_t nRow0 = rImg.y - nDstY;
+
+  // Pixels are stored as RGB565
+  uint16_t nTransRaw = 0;
+  if (GSLC_BMP_TRANS_EN) {
+    gslc_tsColor nTransCol = pGui->sTransCol;
+    nTransRaw = ((nTransCol.r & 0xF8) << 8) | ((nTransCol.g & 0xFC) << 3) | (nTransCol.b >> 3);
+  }
+  int16_t nRow,nCol;
+  for (nRow=0;nRow<(int16_t)rImg.h;nRow++) {
+    const uint16_t* pSrc = pImage + (int32_t)(nRow0+nRow)*nW + nCol0;
+    uint8_t* pDst = pDriver->pFrame + ((size_t)(rImg.y+nRow)*pDriver->nFrameW + rImg.x)*DRV_FB_PIX_BYTES;
+    for (nCol=0;nCol<(int16_t)rImg.w;nCol++) {
+      uint16_t nPix = pSrc[nCol];
+      if ((GSLC_BMP_TRANS_EN) && (nPix == nTransRaw)) {
+        continue;
+      }
+      #if (DRV_FB_FMT == DRV_FB_FMT_RGB565)
+      ((uint16_t*)pDst)[nCol] = nPix;
+      #else
+      ((uint32_t*)pDst)[nCol] = ((uint32_t)(nPix & 0xF800) << 8) | ((uint32_t)(nPix & 0x07E0) << 5) | ((nPix & 0x001F) << 3);
+      #endif
+    }
+  }
+  gslc_DrvFbDamage(pDriver,rImg.x,rImg.y,rImg.x+rImg.w-1,rImg.y+rImg.h-1);
+  pDriver->nStatPixCnt += (uint32_t)rImg.w * rImg.h;
+}
+
+void gslc_DrvDrawRle16FromMem(gslc_tsGui* pGui,int16_t nDstX, int16_t nDstY,const unsigned char* pBitmap,bool bProgMem)
+{
+  (void)bProgMem; // No distinction between Flash and RAM in LINUX
+  gslc_tsDriver*  pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  const uint16_t* pImage = (const uint16_t*)pBitmap;
+  pDriver->nStatDrawCnt++;
+  int16_t nH = (int16_t)pImage[0];
+  int16_t nW = (int16_t)pImage[1];
+  pImage += 3;
+
+  // Determine the portion of the image within the clipping region
+  gslc_tsRect rImg = (gslc_tsRect) { nDstX, nDstY, (uint16_t)nW, (uint16_t)nH };
+  if (!gslc_ClipRect(&pDriver->rClipRect,&rImg)) { return; }
+  int16_t nCol0 = rImg.x - nDstX;
+  int16_t nRow0 = rImg.y - nDstY;
+  int16_t nCol1 = nCol0 + rImg.w;
+  int16_t nRow1 = nRow0 + rImg.h;
+
+  // Fill runs are written as spans and literal runs are copied.
+  // Rows above the clipping region are only parsed.
+  int16_t   nRow,nCol,nInd,nVis0,nVis1;
+  uint16_t  nCode,nRun,nPix;
+  uint32_t  nColRaw;
+  #if (DRV_FB_FMT == DRV_FB_FMT_RGB565)
+  uint16_t* pDst = NULL;
+  #else
+  uint32_t* pDst = NULL;
+  #endif
+  for (nRow=0;nRow<nRow1;nRow++) {
+    if (nRow >= nRow0) {
+      #if (DRV_FB_FMT == DRV_FB_FMT_RGB565)
+      pDst = (uint16_t*)pDriver->pFrame + (size_t)(nDstY+nRow)*pDriver->nFrameW;
+      #else
+      pDst = (uint32_t*)pDriver->pFrame + (size_t)(nDstY+nRow)*pDriver->nFrameW;
+      #endif
+    }
+    nCol = 0;
+    while (nCol < nW) {
+      nCode = *(pImage++);
+      nRun  = nCode & GSLC_IMG_RLE16_LEN;
+      if (nRun == 0) {
+        break; // Malformed run
+      }
+      if ((nCode & GSLC_IMG_RLE16_TYPE) == GSLC_IMG_RLE16_SKIP) {
+        nCol += nRun;
+        continue;
+      }
+      if (nRow >= nRow0) {
+        nVis0 = GSLC_MAX(nCol,nCol0);
+        nVis1 = GSLC_MIN(nCol+(int16_t)nRun,nCol1);
+        if ((nCode & GSLC_IMG_RLE16_TYPE) == GSLC_IMG_RLE16_FILL) {
+          nPix = pImage[0];
+          #if (DRV_FB_FMT == DRV_FB_FMT_RGB565)
+          nColRaw = nPix;
+          #else
+          nColRaw = ((uint32_t)(nPix & 0xF800) << 8) | ((uint32_t)(nPix & 0x07E0) << 5) | ((nPix & 0x001F) << 3);
+          #endif
+          gslc_DrvFbFillSpan(pDriver,nDstX+nVis0,nDstY+nRow,nVis1-nVis0,nColRaw);
+        } else {
+          for (nInd=nVis0;nInd<nVis1;nInd++) {
+            nPix = pImage[nInd-nCol];
+            #if (DRV_FB_FMT == DRV_FB_FMT_RGB565)
+            pDst[nDstX+nInd] = nPix;
+            #else
+            pDst[nDstX+nInd] = ((uint32_t)(nPix & 0xF800) << 8) | ((uint32_t)(nPix & 0x07E0) << 5) | ((nPix & 0x001F) << 3);
+            #endif
+          }
+          if (nVis1 > nVis0) {
+            gslc_DrvFbDamage(pDriver,nDstX+nVis0,nDstY+nRow,nDstX+nVis1-1,nDstY+nRow);
+            pDriver->nStatPixCnt += (uint32_t)(nVis1 - nVis0);
+          }
+        }
+      }
+      pImage += ((nCode & GSLC_IMG_RLE16_TYPE) == GSLC_IMG_RLE16_FILL) ? 1 : nRun;
+      nCol   += nRun;
+    }
+  }
+}
+
+bool gslc_DrvDrawImage(gslc_tsGui* pGui,int16_t nDstX,int16_t nDstY,gslc_tsImgRef sImgRef)
+{
+  if (pGui == NULL) {
+    GSLC_DEBUG2_PRINT("ERROR: DrvDrawImage(%s) with NULL ptr\n","");
+    return false;
+  }
+
+  if (sImgRef.eImgFlags == GSLC_IMGREF_NONE) {
+    return true;  // Nothing to do
+
+  } else if ((sImgRef.eImgFlags & GSLC_IMGREF_SRC) == GSLC_IMGREF_SRC_FILE) {
+    // File-based images are pre-loaded
+    if (sImgRef.pvImgRaw == NULL) {
+      GSLC_DEBUG2_PRINT("ERROR: DrvDrawImage(%s) with NULL pvImgRaw\n","");
+      return false;
+    }
+    gslc_DrvFbPasteImage(pGui,nDstX,nDstY,(gslc_tsDrvFbImg*)sImgRef.pvImgRaw);
+    return true;
+
+  } else if (((sImgRef.eImgFlags & GSLC_IMGREF_SRC) == GSLC_IMGREF_SRC_RAM) ||
+             ((sImgRef.eImgFlags & GSLC_IMGREF_SRC) == GSLC_IMGREF_SRC_PROG)) {
+    bool bProgMem = ((sImgRef.eImgFlags & GSLC_IMGREF_SRC) == GSLC_IMGREF_SRC_PROG);
+    if ((sImgRef.eImgFlags & GSLC_IMGREF_FMT) == GSLC_IMGREF_FMT_RAW1) {
+      gslc_DrvDrawMonoFromMem(pGui,nDstX,nDstY,sImgRef.pImgBuf,bProgMem);
+      return true;
+    } else if ((sImgRef.eImgFlags & GSLC_IMGREF_FMT) == GSLC_IMGREF_FMT_BMP24) {
+      gslc_DrvDrawBmp24FromMem(pGui,nDstX,nDstY,sImgRef.pImgBuf,bProgMem);
+      return true;
+    } else if ((sImgRef.eImgFlags & GSLC_IMGREF_FMT) == GSLC_IMGREF_FMT_RLE16) {
+      gslc_DrvDrawRle16FromMem(pGui,nDstX,nDstY,sImgRef.pImgBuf,bProgMem);
+      return true;
+    }
+  }
+
+  // Unsupported source or format
+  GSLC_DEBUG2_PRINT("ERROR: DrvDrawImage() unsupported eImgFlags=%d\n", sImgRef.eImgFlags);
+  return false;
+}
+
+
+/// NOTE: Background image is stored in pGui->sImgRefBkgnd
+void gslc_DrvDrawBkgnd(gslc_tsGui* pGui)
+{
+  if (pGui == NULL) {
+    GSLC_DEBUG2_PRINT("ERROR: DrvDrawBkgnd(%s) with NULL ptr\n","");
+    return;
+  }
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+
+  if (pGui->sImgRefBkgnd.eImgFlags == GSLC_IMGREF_NONE) {
+    // Flat color background
+    // - Filling is limited to the clipping region
+    gslc_tsRect rRect = (gslc_tsRect) { 0, 0, pGui->nDispW, pGui->nDispH };
+    gslc_DrvDrawFillRect(pGui, rRect, pDriver->nColBkgnd);
+  } else {
+    gslc_DrvDrawImage(pGui,0,0,pGui->sImgRefBkgnd);
+  }
+}
+
+
+
+// ------------------------------------------------------------------------
+// Touch Functions
+// ------------------------------------------------------------------------
+
+bool gslc_DrvInitTouch(gslc_tsGui* pGui,const char* acDev)
+{
+  (void)pGui; // Unused
+  (void)acDev; // Unused
+  // No touch input is provided by the framebuffer driver
+  return true;
+}
+
+void* gslc_DrvGetDriverTouch(gslc_tsGui* pGui)
+{
+  (void)pGui; // Unused
+  return NULL;
+}
+
+bool gslc_DrvGetTouch(gslc_tsGui* pGui,int16_t* pnX,int16_t* pnY,uint16_t* pnPress,gslc_teInputRawEvent* peInputEvent,int16_t* pnInputVal)
+{
+  (void)pGui; // Unused
+  (void)pnX; // Unused
+  (void)pnY; // Unused
+  (void)pnPress; // Unused
+  (void)pnInputVal; // Unused
+  *peInputEvent = GSLC_INPUT_NONE;
+  return false;
+}
+
+
+/// Change display rotation and any associated touch orientation
+bool gslc_DrvRotate(gslc_tsGui* pGui, uint8_t nRotation)
+{
+  (void)pGui; // Unused
+  (void)nRotation; // Unused
+  // TODO: Implement support for display rotation
+  GSLC_DEBUG2_PRINT("ERROR: DrvRotate(%s) not supported in DRV_DISP_FB mode yet\n","");
+  return false;
+}
+
+// =======================================================================
+// Private Functions
+// =======================================================================
+
+bool gslc_DrvFbSinkOpen(gslc_tsGui* pGui)
+{
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+
+  // Default to the configured dimensions with a sink that
+  // shares the layout of the frame
+  pDriver->nFrameW      = DRV_FB_WIDTH;
+  pDriver->nFrameH      = DRV_FB_HEIGHT;
+  pDriver->nSinkBpp     = DRV_FB_PIX_BYTES*8;
+  pDriver->nSinkStride  = DRV_FB_WIDTH*DRV_FB_PIX_BYTES;
+  pDriver->bSinkDirect  = true;
+
+#if (DRV_FB_SINK == DRV_FB_SINK_FBDEV)
+  pDriver->nSinkFd = open(GSLC_DEV_FB,O_RDWR);
+  if (pDriver->nSinkFd < 0) {
+    GSLC_DEBUG2_PRINT("ERROR: DrvFbSinkOpen() failed to open %s\n",GSLC_DEV_FB);
+    return false;
+  }
+  struct fb_var_screeninfo sVarInfo;
+  struct fb_fix_screeninfo sFixInfo;
+  if ((ioctl(pDriver->nSinkFd,FBIOGET_VSCREENINFO,&sVarInfo) != 0) ||
+      (ioctl(pDriver->nSinkFd,FBIOGET_FSCREENINFO,&sFixInfo) != 0)) {
+    GSLC_DEBUG2_PRINT("ERROR: DrvFbSinkOpen() failed to query %s\n",GSLC_DEV_FB);
+    return false;
+  }
+  if ((sVarInfo.bits_per_pixel != 16) && (sVarInfo.bits_per_pixel != 24) && (sVarInfo.bits_per_pixel != 32)) {
+    GSLC_DEBUG2_PRINT("ERROR: DrvFbSinkOpen() unsupported depth %u\n",sVarInfo.bits_per_pixel);
+    return false;
+  }
+  pDriver->nFrameW      = (uint16_t)sVarInfo.xres;
+  pDriver->nFrameH      = (uint16_t)sVarInfo.yres;
+  pDriver->nSinkBpp     = (uint8_t)sVarInfo.bits_per_pixel;
+  pDriver->nSinkStride  = sFixInfo.line_length;
+  pDriver->nSinkMapLen  = sFixInfo.line_length * sVarInfo.yres;
+  pDriver->anSinkOffset[0] = (uint8_t)sVarInfo.red.offset;
+  pDriver->anSinkOffset[1] = (uint8_t)sVarInfo.green.offset;
+  pDriver->anSinkOffset[2] = (uint8_t)sVarInfo.blue.offset;
+  pDriver->anSinkLength[0] = (uint8_t)sVarInfo.red.length;
+  pDriver->anSinkLength[1] = (uint8_t)sVarInfo.green.length;
+  pDriver->anSinkLength[2] = (uint8_t)sVarInfo.blue.length;
+  // Spans can be copied directly if the device uses the frame layout
+  #if (DRV_FB_FMT == DRV_FB_FMT_RGB565)
+  pDriver->bSinkDirect = (sVarInfo.bits_per_pixel == 16) &&
+    (sVarInfo.red.offset == 11) && (sVarInfo.green.offset == 5) && (sVarInfo.blue.offset == 0);
+  #else
+  pDriver->bSinkDirect = (sVarInfo.bits_per_pixel == 32) &&
+    (sVarInfo.red.offset == 16) && (sVarInfo.green.offset == 8) && (sVarInfo.blue.offset == 0);
+  #endif
+
+#elif (DRV_FB_SINK == DRV_FB_SINK_FILE)
+  // The file holds the raw frame in DRV_FB_FMT
+  pDriver->nSinkFd = open(DRV_FB_FILE,O_RDWR | O_CREAT,0644);
+  if (pDriver->nSinkFd < 0) {
+    GSLC_DEBUG2_PRINT("ERROR: DrvFbSinkOpen() failed to open %s\n",DRV_FB_FILE);
+    return false;
+  }
+  pDriver->nSinkMapLen = pDriver->nSinkStride * DRV_FB_HEIGHT;
+  if (ftruncate(pDriver->nSinkFd,pDriver->nSinkMapLen) != 0) {
+    GSLC_DEBUG2_PRINT("ERROR: DrvFbSinkOpen() failed to size %s\n",DRV_FB_FILE);
+    return false;
+  }
+
+#else
+  // No output
+  return true;
+#endif
+
+#if (DRV_FB_SINK != DRV_FB_SINK_NONE)
+  pDriver->pSinkMap = (uint8_t*)mmap(NULL,pDriver->nSinkMapLen,PROT_READ | PROT_WRITE,MAP_SHARED,pDriver->nSinkFd,0);
+  if (pDriver->pSinkMap == MAP_FAILED) {
+    pDriver->pSinkMap = NULL;
+    GSLC_DEBUG2_PRINT("ERROR: DrvFbSinkOpen() failed to map sink (%u bytes)\n",pDriver->nSinkMapLen);
+    return false;
+  }
+  return true;
+#endif
+}
+
+void gslc_DrvFbFlush(gslc_tsGui* pGui)
+{
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  int16_t   nRow;
+  uint32_t  nSpanCnt = 0;
+  uint32_t  nPixCnt = 0;
+
+  for (nRow=pDriver->nDmgY0;nRow<=pDriver->nDmgY1;nRow++) {
+    int16_t nX0 = pDriver->anDmgX0[nRow];
+    int16_t nX1 = pDriver->anDmgX1[nRow];
+    if (nX1 < nX0) {
+      continue;
+    }
+    uint16_t nW = (uint16_t)(nX1 - nX0 + 1);
+    nSpanCnt++;
+    nPixCnt += nW;
+    pDriver->anDmgX0[nRow] = (int16_t)pDriver->nFrameW;
+    pDriver->anDmgX1[nRow] = -1;
+
+    if (pDriver->pSinkMap == NULL) {
+      continue;
+    }
+    const uint8_t* pSrc = pDriver->pFrame + ((size_t)nRow*pDriver->nFrameW + nX0)*DRV_FB_PIX_BYTES;
+    uint8_t* pDst = pDriver->pSinkMap + (size_t)nRow*pDriver->nSinkStride + (size_t)nX0*(pDriver->nSinkBpp/8);
+    if (pDriver->bSinkDirect) {
+      memcpy(pDst,pSrc,(size_t)nW*DRV_FB_PIX_BYTES);
+      continue;
+    }
+    // Convert each pixel to the sink layout
+    uint16_t nCol;
+    for (nCol=0;nCol<nW;nCol++) {
+      uint8_t anRgb[3];
+      #if (DRV_FB_FMT == DRV_FB_FMT_RGB565)
+      uint16_t nPix = ((const uint16_t*)pSrc)[nCol];
+      anRgb[0] = (uint8_t)((nPix >> 8) & 0xF8);
+      anRgb[1] = (uint8_t)((nPix >> 3) & 0xFC);
+      anRgb[2] = (uint8_t)((nPix << 3) & 0xF8);
+      #else
+      uint32_t nPix = ((const uint32_t*)pSrc)[nCol];
+      anRgb[0] = (uint8_t)(nPix >> 16);
+      anRgb[1] = (uint8_t)(nPix >> 8);
+      anRgb[2] = (uint8_t)(nPix);
+      #endif
+      uint32_t nOut = 0;
+      uint8_t nComp;
+      for (nComp=0;nComp<3;nComp++) {
+        nOut |= (uint32_t)(anRgb[nComp] >> (8 - pDriver->anSinkLength[nComp])) << pDriver->anSinkOffset[nComp];
+      }
+      if (pDriver->nSinkBpp == 16) {
+        ((uint16_t*)pDst)[nCol] = (uint16_t)nOut;
+      } else if (pDriver->nSinkBpp == 24) {
+        pDst[nCol*3+0] = (uint8_t)(nOut);
+        pDst[nCol*3+1] = (uint8_t)(nOut >> 8);
+        pDst[nCol*3+2] = (uint8_t)(nOut >> 16);
+      } else {
+        ((uint32_t*)pDst)[nCol] = nOut;
+      }
+    }
+  }
+
+  pDriver->nDmgY0 = (int16_t)pDriver->nFrameH;
+  pDriver->nDmgY1 = -1;
+  pDriver->nFlushSpanCnt = nSpanCnt;
+  pDriver->nFlushPixCnt  = nPixCnt;
+}
+
+void gslc_DrvFbDamage(gslc_tsDriver* pDriver,int16_t nX0,int16_t nY0,int16_t nX1,int16_t nY1)
+{
+  int16_t nRow;
+  for (nRow=nY0;nRow<=nY1;nRow++) {
+    if (nX0 < pDriver->anDmgX0[nRow]) { pDriver->anDmgX0[nRow] = nX0; }
+    if (nX1 > pDriver->anDmgX1[nRow]) { pDriver->anDmgX1[nRow] = nX1; }
+  }
+  if (nY0 < pDriver->nDmgY0) { pDriver->nDmgY0 = nY0; }
+  if (nY1 > pDriver->nDmgY1) { pDriver->nDmgY1 = nY1; }
+}
+
+uint32_t gslc_DrvFbAdaptColorRaw(gslc_tsColor nCol)
+{
+#if (DRV_FB_FMT == DRV_FB_FMT_RGB565)
+  return ((nCol.r & 0xF8) << 8) | ((nCol.g & 0xFC) << 3) | (nCol.b >> 3);
+#else
+  return ((uint32_t)nCol.r << 16) | ((uint32_t)nCol.g << 8) | nCol.b;
+#endif
+}
+
+void gslc_DrvFbFillSpan(gslc_tsDriver* pDriver,int16_t nX,int16_t nY,int32_t nW,uint32_t nColRaw)
+{
+  // Clip the span
+  gslc_tsRect* pClip = &pDriver->rClipRect;
+  if ((nY < pClip->y) || (nY >= pClip->y + (int16_t)pClip->h)) {
+    return;
+  }
+  int32_t nX0 = GSLC_MAX(nX,pClip->x);
+  int32_t nX1 = GSLC_MIN((int32_t)nX + nW,(int32_t)pClip->x + pClip->w) - 1;
+  if (nX1 < nX0) {
+    return;
+  }
+
+  int32_t nInd;
+  #if (DRV_FB_FMT == DRV_FB_FMT_RGB565)
+  uint16_t* pDst = (uint16_t*)pDriver->pFrame + (size_t)nY*pDriver->nFrameW;
+  uint16_t  nPix = (uint16_t)nColRaw;
+  #else
+  uint32_t* pDst = (uint32_t*)pDriver->pFrame + (size_t)nY*pDriver->nFrameW;
+  uint32_t  nPix = nColRaw;
+  #endif
+  for (nInd=nX0;nInd<=nX1;nInd++) {
+    pDst[nInd] = nPix;
+  }
+  pDriver->nStatPixCnt += (uint32_t)(nX1 - nX0 + 1);
+
+  if (nX0 < pDriver->anDmgX0[nY]) { pDriver->anDmgX0[nY] = (int16_t)nX0; }
+  if (nX1 > pDriver->anDmgX1[nY]) { pDriver->anDmgX1[nY] = (int16_t)nX1; }
+  if (nY < pDriver->nDmgY0) { pDriver->nDmgY0 = nY; }
+  if (nY > pDriver->nDmgY1) { pDriver->nDmgY1 = nY; }
+}
+
+void gslc_DrvFbPasteImage(gslc_tsGui* pGui,int16_t nDstX,int16_t nDstY,gslc_tsDrvFbImg* pImg)
+{
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  gslc_tsRect rImg = (gslc_tsRect) { nDstX, nDstY, pImg->nW, pImg->nH };
+  pDriver->nStatDrawCnt++;
+  if (!gslc_ClipRect(&pDriver->rClipRect,&rImg)) { return; }
+  int16_t nCol0 = rImg.x - nDstX;
+  int16_t nRow0 = rImg.y - nDstY;
+
+  uint32_t nTransRaw = gslc_DrvFbAdaptColorRaw(pGui->sTransCol);
+  int16_t nRow,nCol;
+  for (nRow=0;nRow<(int16_t)rImg.h;nRow++) {
+    const uint8_t* pSrc = pImg->pPix + ((size_t)(nRow0+nRow)*pImg->nW + nCol0)*DRV_FB_PIX_BYTES;
+    uint8_t* pDst = pDriver->pFrame + ((size_t)(rImg.y+nRow)*pDriver->nFrameW + rImg.x)*DRV_FB_PIX_BYTES;
+    if (!GSLC_BMP_TRANS_EN) {
+      memcpy(pDst,pSrc,(size_t)rImg.w*DRV_FB_PIX_BYTES);
+      continue;
+    }
+    for (nCol=0;nCol<(int16_t)rImg.w;nCol++) {
+      #if (DRV_FB_FMT == DRV_FB_FMT_RGB565)
+      uint16_t nPix = ((const uint16_t*)pSrc)[nCol];
+      if (nPix != (uint16_t)nTransRaw) { ((uint16_t*)pDst)[nCol] = nPix; }
+      #else
+      uint32_t nPix = ((const uint32_t*)pSrc)[nCol];
+      if (nPix != nTransRaw) { ((uint32_t*)pDst)[nCol] = nPix; }
+      #endif
+    }
+  }
+  gslc_DrvFbDamage(pDriver,rImg.x,rImg.y,rImg.x+rImg.w-1,rImg.y+rImg.h-1);
+  pDriver->nStatPixCnt += (uint32_t)rImg.w * rImg.h;
+}
+
+#endif // DRV_DISP_FB
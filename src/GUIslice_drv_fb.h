@@ -0,0 +1,709 @@
+#ifndef _GUISLICE_DRV_FB_H_
+#define _GUISLICE_DRV_FB_H_
+
+// =======================================================================
+// GUIslice library (driver layer for software framebuffer)
+// - Calvin Hass
+// - https://www.impulseadventure.com/elec/guislice-gui.html
+// - https://github.com/ImpulseAdventure/GUIslice
+// =======================================================================
+//
+// The MIT License
+//
+// Copyright 2016-2020 Calvin Hass
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// =======================================================================
+/// \file GUIslice_drv_fb.h
+/// \brief GUIslice library (driver layer for LINUX / software framebuffer)
+
+
+// =======================================================================
+// Driver Layer for software framebuffer
+// - All drawing is performed in software into an off-screen frame
+//   held in memory. No display server or graphics library is required.
+// - The rows and columns modified since the last page flip are tracked
+//   and only these spans are copied to the output sink during
+//   gslc_DrvPageFlipNow().
+// - The output sink is one of:
+//   - DRV_FB_SINK_FBDEV: LINUX framebuffer device (eg. /dev/fb0)
+//   - DRV_FB_SINK_FILE:  File of raw pixels in DRV_FB_FMT. Placing
+//                        the file in /dev/shm provides a shared-memory
+//                        frame that can be read by another process.
+//   - DRV_FB_SINK_NONE:  No output (eg. for benchmarking)
+// =======================================================================
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+#include "GUIslice.h"
+
+#include <stdio.h>
+
+// =======================================================================
+// Driver configuration
+// =======================================================================
+
+// Output sink types
+#define DRV_FB_SINK_NONE    0 ///< No output sink
+#define DRV_FB_SINK_FBDEV   1 ///< LINUX framebuffer device
+#define DRV_FB_SINK_FILE    2 ///< Memory-mapped file (or shared memory)
+
+// Frame pixel formats
+#define DRV_FB_FMT_RGB565   0 ///< 16-bit RGB565 pixels
+#define DRV_FB_FMT_RGB888   1 ///< 24-bit RGB pixels stored as 32-bit 0x00RRGGBB
+
+// Provide defaults for any settings not defined in the config
+#if !defined(DRV_FB_SINK)
+  #define DRV_FB_SINK       DRV_FB_SINK_FBDEV
+#endif
+#if !defined(DRV_FB_FMT)
+  #define DRV_FB_FMT        DRV_FB_FMT_RGB565
+#endif
+#if !defined(DRV_FB_FILE)
+  #define DRV_FB_FILE       "/dev/shm/guislice_fb"
+#endif
+// Frame dimensions when not determined by the framebuffer device
+#if !defined(DRV_FB_WIDTH)
+  #define DRV_FB_WIDTH      480
+#endif
+#if !defined(DRV_FB_HEIGHT)
+  #define DRV_FB_HEIGHT     320
+#endif
+
+#if (DRV_FB_FMT == DRV_FB_FMT_RGB565)
+  #define DRV_FB_PIX_BYTES  2 ///< Bytes per pixel in the frame
+#else
+  #define DRV_FB_PIX_BYTES  4 ///< Bytes per pixel in the frame
+#endif
+
+// =======================================================================
+// API support definitions
+// - These defines indicate whether the driver includes optimized
+//   support for various APIs. If a define is set to 0, then the
+//   GUIslice core emulation will be used instead.
+// - At the very minimum, the point draw routine must be available:
+//   gslc_DrvDrawPoint()
+// =======================================================================
+
+#define DRV_HAS_DRAW_POINT             1 ///< Support gslc_DrvDrawPoint()
+
+#define DRV_HAS_DRAW_POINTS            1 ///< Support gslc_DrvDrawPoints()
+#define DRV_HAS_DRAW_LINE              1 ///< Support gslc_DrvDrawLine()
+#define DRV_HAS_DRAW_RECT_FRAME        1 ///< Support gslc_DrvDrawFrameRect()
+#define DRV_HAS_DRAW_RECT_FILL         1 ///< Support gslc_DrvDrawFillRect()
+#define DRV_HAS_DRAW_RECT_ROUND_FRAME  0 ///< Support gslc_DrvDrawFrameRoundRect()
+#define DRV_HAS_DRAW_RECT_ROUND_FILL   0 ///< Support gslc_DrvDrawFillRoundRect()
+#define DRV_HAS_DRAW_CIRCLE_FRAME      0 ///< Support gslc_DrvDrawFrameCircle()
+#define DRV_HAS_DRAW_CIRCLE_FILL       0 ///< Support gslc_DrvDrawFillCircle()
+#define DRV_HAS_DRAW_TRI_FRAME         0 ///< Support gslc_DrvDrawFrameTriangle()
+#define DRV_HAS_DRAW_TRI_FILL          0 ///< Support gslc_DrvDrawFillTriangle()
+#define DRV_HAS_DRAW_TEXT              1 ///< Support gslc_DrvDrawTxt()
+#define DRV_HAS_DRAW_BMP_MEM           1 ///< Support gslc_DrvDrawBmp24FromMem()
+
+#define DRV_OVERRIDE_TXT_ALIGN         0 ///< Driver provides text alignment
+#define DRV_HAS_DRAW_TXT_CLIP          1 ///< gslc_DrvDrawTxt() clips to the clipping region
+#define DRV_HAS_WAIT_INPUT             0 ///< Support gslc_DrvWaitInput()
+
+// =======================================================================
+// Driver-specific members
+// =======================================================================
+
+/// Image loaded into the native frame pixel format
+typedef struct {
+  uint16_t            nW;               ///< Image width
+  uint16_t            nH;               ///< Image height
+  uint8_t*            pPix;             ///< Pixel data (nW*nH pixels in DRV_FB_FMT)
+} gslc_tsDrvFbImg;
+
+typedef struct {
+
+  // Off-screen frame
+  uint8_t*            pFrame;           ///< Frame pixel data (DRV_FB_FMT)
+  uint16_t            nFrameW;          ///< Frame width
+  uint16_t            nFrameH;          ///< Frame height
+
+  // Damage tracking
+  // - For each row, the range of columns modified since the
+  //   last flush. A clean row has X0 > X1.
+  int16_t*            anDmgX0;          ///< First modified column of each row
+  int16_t*            anDmgX1;          ///< Last modified column of each row
+  int16_t             nDmgY0;           ///< First row that may contain damage
+  int16_t             nDmgY1;           ///< Last row that may contain damage
+
+  // Output sink
+  int                 nSinkFd;          ///< File descriptor of the sink (-1 if none)
+  uint8_t*            pSinkMap;         ///< Memory-mapped sink pixels
+  uint32_t            nSinkMapLen;      ///< Length of the sink mapping
+  uint32_t            nSinkStride;      ///< Bytes per row in the sink
+  uint8_t             nSinkBpp;         ///< Bits per pixel in the sink
+  bool                bSinkDirect;      ///< Sink layout matches the frame (spans can be copied)
+  uint8_t             anSinkOffset[3];  ///< Bit offset of R,G,B fields in a sink pixel
+  uint8_t             anSinkLength[3];  ///< Bit length of R,G,B fields in a sink pixel
+
+  // Statistics from the most recent flush
+  uint32_t            nFlushSpanCnt;    ///< Number of row spans copied to the sink
+  uint32_t            nFlushPixCnt;     ///< Number of pixels copied to the sink
+
+  // Cumulative drawing statistics
+  uint32_t            nStatDrawCnt;     ///< Number of drawing calls into the driver
+  uint32_t            nStatPixCnt;      ///< Number of pixels written to the frame
+
+  gslc_tsColor        nColBkgnd;        ///< Background color (if not image-based)
+
+  gslc_tsRect         rClipRect;        ///< Clipping rectangle
+
+} gslc_tsDriver;
+
+
+
+// =======================================================================
+// Public APIs to GUIslice core library
+// - These functions define the renderer / driver-dependent
+//   implementations for the core drawing operations within
+//   GUIslice.
+// =======================================================================
+
+
+// -----------------------------------------------------------------------
+// Configuration Functions
+// -----------------------------------------------------------------------
+
+///
+/// Initialize the framebuffer driver
+/// - Opens the output sink (if any) and determines the display dimensions
+/// - Allocates the off-screen frame
+///
+/// \param[in]  pGui:      Pointer to GUI
+///
+/// \return true if success, false if fail
+///
+bool gslc_DrvInit(gslc_tsGui* pGui);
+
+
+///
+/// Free up any members associated with the driver
+/// - Eg. the off-screen frame and the sink mapping
+///
+/// \param[in]  pGui:         Pointer to GUI
+///
+/// \return none
+///
+void gslc_DrvDestruct(gslc_tsGui* pGui);
+
+
+///
+/// Get the display driver name
+///
+/// \param[in]  pGui:      Pointer to GUI
+///
+/// \return String containing driver name
+///
+const char* gslc_DrvGetNameDisp(gslc_tsGui* pGui);
+
+
+///
+/// Get the touch driver name
+///
+/// \param[in]  pGui:      Pointer to GUI
+///
+/// \return String containing driver name
+///
+const char* gslc_DrvGetNameTouch(gslc_tsGui* pGui);
+
+///
+/// Get the native display driver instance
+/// - This can be useful to access special commands
+///   available in the selected driver.
+///
+/// \param[in]  pGui:      Pointer to GUI
+///
+/// \return Void pointer to the display driver instance.
+///         This pointer should be typecast to the particular
+///         driver being used. If no driver was created then
+///         this function will return NULL.
+///
+void* gslc_DrvGetDriverDisp(gslc_tsGui* pGui);
+
+///
+/// Get the native touch driver instance
+/// - This can be useful to access special commands
+///   available in the selected driver.
+///
+/// \param[in]  pGui:      Pointer to GUI
+///
+/// \return Void pointer to the touch driver instance.
+///         This pointer should be typecast to the particular
+///         driver being used. If no driver was created then
+///         this function will return NULL.
+///
+void* gslc_DrvGetDriverTouch(gslc_tsGui* pGui);
+
+
+// -----------------------------------------------------------------------
+// Image/surface handling Functions
+// -----------------------------------------------------------------------
+
+
+///
+/// Load a bitmap (*.bmp) and create a new image resource.
+/// - Only file-based images are pre-loaded. Images in memory
+///   are drawn directly from their source.
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  sImgRef:     Image reference
+///
+/// \return Image pointer (gslc_tsDrvFbImg) or NULL if error
+///
+void* gslc_DrvLoadImage(gslc_tsGui* pGui,gslc_tsImgRef sImgRef);
+
+
+///
+/// Configure the background to use a bitmap image
+/// - The background is used when redrawing the entire page
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  sImgRef:     Image reference
+///
+/// \return true if success, false if fail
+///
+bool gslc_DrvSetBkgndImage(gslc_tsGui* pGui,gslc_tsImgRef sImgRef);
+
+///
+/// Configure the background to use a solid color
+/// - The background is used when redrawing the entire page
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nCol:        RGB Color to use
+///
+/// \return true if success, false if fail
+///
+bool gslc_DrvSetBkgndColor(gslc_tsGui* pGui,gslc_tsColor nCol);
+
+///
+/// Set an element's normal-state image
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  pElem:       Pointer to Element to update
+/// \param[in]  sImgRef:     Image reference
+///
+/// \return true if success, false if error
+///
+bool gslc_DrvSetElemImageNorm(gslc_tsGui* pGui,gslc_tsElem* pElem,gslc_tsImgRef sImgRef);
+
+///
+/// Set an element's glow-state image
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  pElem:       Pointer to Element to update
+/// \param[in]  sImgRef:     Image reference
+///
+/// \return true if success, false if error
+///
+bool gslc_DrvSetElemImageGlow(gslc_tsGui* pGui,gslc_tsElem* pElem,gslc_tsImgRef sImgRef);
+
+
+///
+/// Release an image surface
+///
+/// \param[in]  pvImg:          Void ptr to image
+///
+/// \return none
+///
+void gslc_DrvImageDestruct(void* pvImg);
+
+
+///
+/// Set the clipping rectangle for future drawing updates
+///
+/// \param[in]  pGui:          Pointer to GUI
+/// \param[in]  pRect:         Rectangular region to constrain edits
+///
+/// \return true if success, false if error
+///
+bool gslc_DrvSetClipRect(gslc_tsGui* pGui,gslc_tsRect* pRect);
+
+
+// -----------------------------------------------------------------------
+// Font handling Functions
+// -----------------------------------------------------------------------
+
+
+///
+/// Load a font from a resource and return pointer to it
+/// - The framebuffer driver renders all text with its built-in
+///   5x7 font. For GSLC_FONTREF_PTR, nFontSz is the text scale
+///   factor. For GSLC_FONTREF_FNAME (eg. a TTF file), the file is not
+///   opened and the nearest scale to the point size nFontSz is used.
+///
+/// \param[in]  eFontRefType:   Font reference type
+/// \param[in]  pvFontRef:      Font reference pointer
+/// \param[in]  nFontSz:        Typeface size to use
+///
+/// \return Void ptr to driver-specific font if load was successful, NULL otherwise
+///
+const void* gslc_DrvFontAdd(gslc_teFontRefType eFontRefType,const void* pvFontRef,uint16_t nFontSz);
+
+///
+/// Release all fonts defined in the GUI
+///
+/// \param[in]  pGui:          Pointer to GUI
+///
+/// \return none
+///
+void gslc_DrvFontsDestruct(gslc_tsGui* pGui);
+
+
+///
+/// Get the extent (width and height) of a text string
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  pFont:       Ptr to Font structure
+/// \param[in]  pStr:        String to display
+/// \param[in]  eTxtFlags:   Flags associated with text string
+/// \param[out] pnTxtX:      Ptr to offset X of text
+/// \param[out] pnTxtY:      Ptr to offset Y of text
+/// \param[out] pnTxtSzW:    Ptr to width of text
+/// \param[out] pnTxtSzH:    Ptr to height of text
+///
+/// \return true if success, false if failure
+///
+bool gslc_DrvGetTxtSize(gslc_tsGui* pGui,gslc_tsFont* pFont,const char* pStr,gslc_teTxtFlags eTxtFlags,
+        int16_t* pnTxtX,int16_t* pnTxtY,uint16_t* pnTxtSzW,uint16_t* pnTxtSzH);
+
+
+///
+/// Draw a text string at the given coordinate
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nTxtX:       X coordinate of top-left text string
+/// \param[in]  nTxtY:       Y coordinate of top-left text string
+/// \param[in]  pFont:       Ptr to Font
+/// \param[in]  pStr:        String to display
+/// \param[in]  eTxtFlags:   Flags associated with text string
+/// \param[in]  colTxt:      Color to draw text
+/// \param[in]  colBg:       unused, text is drawn with a transparent background
+///
+/// \return true if success, false if failure
+///
+bool gslc_DrvDrawTxt(gslc_tsGui* pGui,int16_t nTxtX,int16_t nTxtY,gslc_tsFont* pFont,const char* pStr,gslc_teTxtFlags eTxtFlags,gslc_tsColor colTxt,gslc_tsColor colBg);
+
+
+// -----------------------------------------------------------------------
+// Screen Management Functions
+// -----------------------------------------------------------------------
+
+///
+/// Force a page flip to occur. This copies the damaged spans
+/// of the off-screen frame to the output sink.
+///
+/// \param[in]  pGui:        Pointer to GUI
+///
+/// \return none
+///
+void gslc_DrvPageFlipNow(gslc_tsGui* pGui);
+
+
+// -----------------------------------------------------------------------
+// Graphics Primitives Functions
+// -----------------------------------------------------------------------
+
+///
+/// Draw a point
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nX:          X coordinate of point
+/// \param[in]  nY:          Y coordinate of point
+/// \param[in]  nCol:        Color RGB value to draw
+///
+/// \return true if success, false if error
+///
+bool gslc_DrvDrawPoint(gslc_tsGui* pGui,int16_t nX,int16_t nY,gslc_tsColor nCol);
+
+///
+/// Draw a point
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  asPt:        Array of points to draw
+/// \param[in]  nNumPt:      Number of points in array
+/// \param[in]  nCol:        Color RGB value to draw
+///
+/// \return true if success, false if error
+///
+bool gslc_DrvDrawPoints(gslc_tsGui* pGui,gslc_tsPt* asPt,uint16_t nNumPt,gslc_tsColor nCol);
+
+///
+/// Draw a framed rectangle
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  rRect:       Rectangular region to frame
+/// \param[in]  nCol:        Color RGB value to frame
+///
+/// \return true if success, false if error
+///
+bool gslc_DrvDrawFrameRect(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColor nCol);
+
+
+///
+/// Draw a filled rectangle
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  rRect:       Rectangular region to fill
+/// \param[in]  nCol:        Color RGB value to fill
+///
+/// \return true if success, false if error
+///
+bool gslc_DrvDrawFillRect(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColor nCol);
+
+
+///
+/// Draw a line
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nX0:         Line start (X coordinate)
+/// \param[in]  nY0:         Line start (Y coordinate)
+/// \param[in]  nX1:         Line finish (X coordinate)
+/// \param[in]  nY1:         Line finish (Y coordinate)
+/// \param[in]  nCol:        Color RGB value to draw
+///
+/// \return true if success, false if error
+///
+bool gslc_DrvDrawLine(gslc_tsGui* pGui,int16_t nX0,int16_t nY0,int16_t nX1,int16_t nY1,gslc_tsColor nCol);
+
+
+///
+/// Draw a monochrome bitmap from a memory array
+/// - Draw from the bitmap buffer using the foreground color
+///   defined in the header (unset bits are transparent)
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nDstX:       Destination X coord
+/// \param[in]  nDstY:       Destination Y coord
+/// \param[in]  pBitmap:     Pointer to bitmap buffer
+/// \param[in]  bProgMem:    Bitmap is stored in Flash if true, RAM otherwise
+///
+/// \return none
+///
+void gslc_DrvDrawMonoFromMem(gslc_tsGui* pGui,int16_t nDstX, int16_t nDstY, const unsigned char *pBitmap,bool bProgMem);
+
+
+///
+/// Draw a color 24-bit depth bitmap from a memory array
+/// - Note that users must convert images from their native
+///   format (eg. BMP, PNG, etc.) into a C array. Please
+///   refer to the following guide for details:
+///   https://github.com/ImpulseAdventure/GUIslice/wiki/Display-Images-from-FLASH
+/// - The converted file (c array) can then be included in the sketch.
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nDstX:       X coord for copy
+/// \param[in]  nDstY:       Y coord for copy
+/// \param[in]  pBitmap:     Pointer to bitmap buffer
+/// \param[in]  bProgMem:    Bitmap is stored in Flash if true, RAM otherwise
+///
+/// \return none
+///
+void gslc_DrvDrawBmp24FromMem(gslc_tsGui* pGui,int16_t nDstX, int16_t nDstY,const unsigned char* pBitmap,bool bProgMem);
+
+
+///
+/// Draw a run-length encoded RGB565 image (GSLC_IMGREF_FMT_RLE16)
+/// from a memory array
+/// - Transparent runs are skipped, fill runs are written as spans
+/// - Arrays are generated from BMP files with tools/img2rle16
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nDstX:       X coord for copy
+/// \param[in]  nDstY:       Y coord for copy
+/// \param[in]  pBitmap:     Pointer to image array
+/// \param[in]  bProgMem:    Image is stored in Flash if true, RAM otherwise
+///
+/// \return none
+///
+void gslc_DrvDrawRle16FromMem(gslc_tsGui* pGui,int16_t nDstX, int16_t nDstY,const unsigned char* pBitmap,bool bProgMem);
+
+
+///
+/// Copy all of source image to destination screen at specified coordinate
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nDstX:       Destination X coord for copy
+/// \param[in]  nDstY:       Destination Y coord for copy
+/// \param[in]  sImgRef:     Image reference
+///
+/// \return true if success, false if fail
+///
+bool gslc_DrvDrawImage(gslc_tsGui* pGui,int16_t nDstX,int16_t nDstY,gslc_tsImgRef sImgRef);
+
+
+///
+/// Copy the background image to destination screen
+///
+/// \param[in]  pGui:        Pointer to GUI
+///
+/// \return true if success, false if fail
+///
+void gslc_DrvDrawBkgnd(gslc_tsGui* pGui);
+
+
+// -----------------------------------------------------------------------
+// Touch Functions
+// -----------------------------------------------------------------------
+
+///
+/// Perform any touchscreen-specific initialization
+/// - The framebuffer driver does not provide touch input
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  acDev:       Device path to touchscreen
+///
+/// \return true if successful
+///
+bool gslc_DrvInitTouch(gslc_tsGui* pGui,const char* acDev);
+
+
+///
+/// Get the last touch event
+/// - The framebuffer driver does not provide touch input
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[out] pnX:         Ptr to X coordinate of last touch event
+/// \param[out] pnY:         Ptr to Y coordinate of last touch event
+/// \param[out] pnPress:     Ptr to Pressure level of last touch event (0 for none, 1 for touch)
+/// \param[out] peInputEvent Indication of event type
+/// \param[out] pnInputVal   Additional data for event type
+///
+/// \return true if an event was detected or false otherwise
+///
+bool gslc_DrvGetTouch(gslc_tsGui* pGui,int16_t* pnX,int16_t* pnY,uint16_t* pnPress,gslc_teInputRawEvent* peInputEvent,int16_t* pnInputVal);
+
+
+// -----------------------------------------------------------------------
+// Dynamic Screen rotation and Touch axes swap/flip functions
+// -----------------------------------------------------------------------
+
+///
+/// Change rotation, automatically adapt touchscreen axes swap/flip
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nRotation:   Screen Rotation value (0, 1, 2 or 3)
+///
+/// \return true if successful
+///
+bool gslc_DrvRotate(gslc_tsGui* pGui, uint8_t nRotation);
+
+
+// =======================================================================
+// Private Functions
+// - These functions are not included in the scope of APIs used by
+//   the core GUIslice library. Instead, these functions are used
+//   to support the operations within this driver layer.
+// =======================================================================
+
+///
+/// Open the output sink and determine the frame dimensions
+///
+/// \param[in]  pGui:        Pointer to GUI
+///
+/// \return true if success, false otherwise
+///
+bool gslc_DrvFbSinkOpen(gslc_tsGui* pGui);
+
+
+///
+/// Copy the damaged spans of the frame to the output sink
+/// and reset the damage tracking
+///
+/// \param[in]  pGui:        Pointer to GUI
+///
+/// \return none
+///
+void gslc_DrvFbFlush(gslc_tsGui* pGui);
+
+
+///
+/// Record a modified region of the frame
+/// - The region must already be clipped to the frame
+///
+/// \param[in]  pDriver:     Pointer to driver
+/// \param[in]  nX0:         Left column
+/// \param[in]  nY0:         Top row
+/// \param[in]  nX1:         Right column (inclusive)
+/// \param[in]  nY1:         Bottom row (inclusive)
+///
+/// \return none
+///
+void gslc_DrvFbDamage(gslc_tsDriver* pDriver,int16_t nX0,int16_t nY0,int16_t nX1,int16_t nY1);
+
+
+///
+/// Convert an RGB color into the frame pixel value
+///
+/// \param[in]  nCol:        RGB value for conversion
+///
+/// \return A pixel value in DRV_FB_FMT
+///
+uint32_t gslc_DrvFbAdaptColorRaw(gslc_tsColor nCol);
+
+
+///
+/// Fill a horizontal span of the frame with a raw pixel value
+/// - The span is clipped to the clipping rectangle
+///
+/// \param[in]  pDriver:     Pointer to driver
+/// \param[in]  nX:          Starting column
+/// \param[in]  nY:          Row
+/// \param[in]  nW:          Number of pixels
+/// \param[in]  nColRaw:     Raw pixel value
+///
+/// \return none
+///
+void gslc_DrvFbFillSpan(gslc_tsDriver* pDriver,int16_t nX,int16_t nY,int32_t nW,uint32_t nColRaw);
+
+
+///
+/// Determine the scale factor used to render the built-in font
+///
+/// \param[in]  pFont:       Pointer to font
+///
+/// \return Integer scale factor (minimum 1)
+///
+uint8_t gslc_DrvFbFontScale(gslc_tsFont* pFont);
+
+
+///
+/// Copy a native-format image into the frame
+/// - The image is clipped to the clipping rectangle
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nDstX:       Destination X coordinate
+/// \param[in]  nDstY:       Destination Y coordinate
+/// \param[in]  pImg:        Pointer to image
+///
+/// \return none
+///
+void gslc_DrvFbPasteImage(gslc_tsGui* pGui,int16_t nDstX,int16_t nDstY,gslc_tsDrvFbImg* pImg);
+
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+#endif // _GUISLICE_DRV_FB_H_
@@ -869,7 +869,10 @@ void gslc_DrvDrawBkgnd(gslc_tsGui* pGui)
       //       we may be redrawing the page with a clipping
       //       region enabled, it is important that we don't
       //       redraw the entire screen.
+      // - Limit the fill to the current clipping region so that
+      //   a partial redraw only repaints the exposed background
       gslc_tsRect rRect = (gslc_tsRect) { 0, 0, pGui->nDispW, pGui->nDispH };
+      if (!gslc_ClipRect(&pDriver->rClipRect,&rRect)) { return; }
       gslc_DrvDrawFillRect(pGui, rRect, pDriver->nColBkgnd);
     } else {
       // An image should be loaded
@@ -44,6 +44,10 @@
 
 #include <stdio.h>
 
+#if defined(DRV_TOUCH_TSLIB)
+  #include <poll.h>       // For poll()
+#endif
+
 // ------------------------------------------------------------------------
 // Load display & touch drivers
 // ------------------------------------------------------------------------
@@ -72,6 +76,13 @@
   const char* m_acDrvTouch = "SDL";
 #endif
 
+// Shared in-memory images
+// - Kept at module scope since gslc_DrvImageDestruct() is not
+//   passed the GUI context
+#if (DRV_SDL_IMG_SHARE_MAX > 0)
+  gslc_tsDrvImgShareEntry m_asDrvImgShare[DRV_SDL_IMG_SHARE_MAX];
+#endif
+
 
 // =======================================================================
 // Public APIs to GUIslice core library
@@ -95,6 +106,22 @@ bool gslc_DrvInit(gslc_tsGui* pGui)
   if (pGui->pvDriver) {
     gslc_tsDriver*  pDriver = (gslc_tsDriver*)(pGui->pvDriver);
 
+    // Start with empty text caches
+    #if (DRV_SDL_TXT_CACHE_MAX > 0)
+    memset(pDriver->asTxtCache,0,sizeof(pDriver->asTxtCache));
+    #endif
+    #if (DRV_SDL_TXT_SIZE_CACHE_MAX > 0)
+    memset(pDriver->asTxtSizeCache,0,sizeof(pDriver->asTxtSizeCache));
+    #endif
+    memset(&pDriver->sTxtCacheStat,0,sizeof(gslc_tsDrvTxtCacheStat));
+    memset(&pDriver->sTxtSizeCacheStat,0,sizeof(gslc_tsDrvTxtCacheStat));
+    pDriver->nTxtCacheUse = 0;
+
+    // Start with no shared images
+    #if (DRV_SDL_IMG_SHARE_MAX > 0)
+    memset(m_asDrvImgShare,0,sizeof(m_asDrvImgShare));
+    #endif
+
     #if defined(DRV_DISP_SDL1)
     pDriver->pSurfScreen = NULL;
     pGui->bRedrawPartialEn = true;
@@ -249,6 +276,10 @@ void* gslc_DrvGetDriverDisp(gslc_tsGui* pGui)
 
 void gslc_DrvDestruct(gslc_tsGui* pGui)
 {
+  // Release any cached text textures and preloaded images before the renderer
+  gslc_DrvTxtCacheFlush(pGui);
+  gslc_DrvImagePreloadRelease(pGui);
+
 #if defined(DRV_DISP_SDL2)
   gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
   if (pDriver->pRender) {
@@ -288,14 +319,46 @@ void* gslc_DrvLoadImage(gslc_tsGui* pGui,gslc_tsImgRef sImgRef)
     // Load image from SD card
     // TODO: Not yet supported
     return NULL;
-  } else if ((sImgRef.eImgFlags & GSLC_IMGREF_SRC) == GSLC_IMGREF_SRC_RAM) {
-    // Load image from RAM
-    // TODO: Not yet supported
-    return NULL;
-  } else if ((sImgRef.eImgFlags & GSLC_IMGREF_SRC) == GSLC_IMGREF_SRC_PROG) {
-    // Load image from FLASH
-    // TODO: Not yet supported
-    return NULL;
+  } else if (((sImgRef.eImgFlags & GSLC_IMGREF_SRC) == GSLC_IMGREF_SRC_RAM) ||
+             ((sImgRef.eImgFlags & GSLC_IMGREF_SRC) == GSLC_IMGREF_SRC_PROG)) {
+    // Load image from RAM or FLASH
+    // - Program memory is directly addressable on the SDL targets
+    //   so both sources are handled the same way
+    // - The converted image is shared by image data pointer, which
+    //   assumes that the image data is not modified once loaded
+    #if (DRV_SDL_IMG_SHARE_MAX > 0)
+    // Reuse the image if it has already been converted
+    gslc_tsDrvImgShareEntry* pEntry = gslc_DrvImgShareFind(sImgRef.pImgBuf,sImgRef.eImgFlags,NULL);
+    if (pEntry != NULL) {
+      pEntry->nRefCnt++;
+      return pEntry->pvImg;
+    }
+    #endif
+
+    bool          bAlpha = false;
+    SDL_Surface*  pSurfLoaded = gslc_DrvLoadSurfaceMem(sImgRef,&bAlpha);
+    if (pSurfLoaded == NULL) {
+      return NULL;
+    }
+    void* pvImg = gslc_DrvImageFromSurface(pGui,pSurfLoaded,bAlpha);
+    if (pvImg == NULL) {
+      return NULL;
+    }
+
+    #if (DRV_SDL_IMG_SHARE_MAX > 0)
+    // Track the image for sharing
+    // - If the table is full the image is simply not shared
+    pEntry = gslc_DrvImgShareFind(NULL,GSLC_IMGREF_NONE,NULL);
+    if (pEntry != NULL) {
+      pEntry->pImgBuf   = sImgRef.pImgBuf;
+      pEntry->eImgFlags = sImgRef.eImgFlags;
+      pEntry->pvImg     = pvImg;
+      pEntry->nRefCnt   = 1;
+      pEntry->bPreload  = false;
+    }
+    #endif
+    return pvImg;
+
   } else if ((sImgRef.eImgFlags & GSLC_IMGREF_SRC) == GSLC_IMGREF_SRC_FILE) {
     // Load image from file system
     const char* pStrFname = sImgRef.pFname;
@@ -315,63 +378,7 @@ void* gslc_DrvLoadImage(gslc_tsGui* pGui,gslc_tsImgRef sImgRef)
       return NULL;
     }
 
-    #if defined(DRV_DISP_SDL1)
-
-    //Create an optimized surface
-
-    //The optimized surface that will be used
-    SDL_Surface* pSurfOptimized = SDL_DisplayFormat( pSurfLoaded );
-
-    //Free the old surface
-    SDL_FreeSurface( pSurfLoaded );
-
-    //If the surface was optimized
-    if( pSurfOptimized != NULL ) {
-
-      // Support optional transparency
-      if (GSLC_BMP_TRANS_EN) {
-        // Color key surface
-        // - Use transparency color key defined in BMP_TRANS_RGB
-        SDL_SetColorKey( pSurfOptimized, SDL_SRCCOLORKEY,
-          SDL_MapRGB( pSurfOptimized->format, GSLC_BMP_TRANS_RGB ) );
-      } // GSLC_BMP_TRANS_EN
-    }
-
-    //Return the optimized surface
-    return (void*)(pSurfOptimized);
-
-    #endif
-
-    #if defined(DRV_DISP_SDL2)
-    gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
-    SDL_Texture*  pTex = NULL;
-
-    if( pSurfLoaded != NULL ) {
-
-      // Support optional transparency
-      if (GSLC_BMP_TRANS_EN) {
-        // Color key surface
-        // - Use transparency color key defined in BMP_TRANS_RGB
-        // - SDL2 passes SDL_TRUE instead of SDL_SRCCOLORKEY
-        SDL_SetColorKey( pSurfLoaded, SDL_TRUE,
-          SDL_MapRGB( pSurfLoaded->format, GSLC_BMP_TRANS_RGB ) );
-      } // GSLC_BMP_TRANS_EN
-    }
-
-    pTex = (void*)SDL_CreateTextureFromSurface(pDriver->pRender,pSurfLoaded);
-    if (pTex == NULL) {
-      GSLC_DEBUG2_PRINT("ERROR: DrvLoadBmp(%s) SDL_CreateTextureFromSurface() failed: %s\n",pStrFname,SDL_GetError());
-      return NULL;
-    }
-
-    // Dispose of surface
-    SDL_FreeSurface(pSurfLoaded);
-    pSurfLoaded = NULL;
-
-    //Return the texture
-    return (void*)pTex;
-
-    #endif
+    return gslc_DrvImageFromSurface(pGui,pSurfLoaded,false);
 
   } // eImgFlags
 
@@ -494,6 +501,17 @@ void gslc_DrvImageDestruct(void* pvImg)
   if (pvImg == NULL) {
     return;
   }
+  #if (DRV_SDL_IMG_SHARE_MAX > 0)
+  // Shared images are only released with the last reference
+  gslc_tsDrvImgShareEntry* pEntry = gslc_DrvImgShareFind(NULL,GSLC_IMGREF_NONE,pvImg);
+  if (pEntry != NULL) {
+    if (pEntry->nRefCnt > 1) {
+      pEntry->nRefCnt--;
+      return;
+    }
+    memset(pEntry,0,sizeof(gslc_tsDrvImgShareEntry));
+  }
+  #endif
   #if defined(DRV_DISP_SDL1)
   SDL_FreeSurface((SDL_Surface*)pvImg);
   #endif
@@ -502,6 +520,65 @@ void gslc_DrvImageDestruct(void* pvImg)
   #endif
 }
 
+bool gslc_DrvImagePreload(gslc_tsGui* pGui,const gslc_tsImgRef* asImgRef,uint16_t nNumImg)
+{
+  if ((pGui == NULL) || (asImgRef == NULL)) {
+    GSLC_DEBUG2_PRINT("ERROR: DrvImagePreload(%s) with NULL ptr\n","");
+    return false;
+  }
+  #if (DRV_SDL_IMG_SHARE_MAX > 0)
+  bool      bOk = true;
+  uint16_t  nInd;
+  for (nInd=0;nInd<nNumImg;nInd++) {
+    gslc_tsImgRef sImgRef = asImgRef[nInd];
+    if (((sImgRef.eImgFlags & GSLC_IMGREF_SRC) != GSLC_IMGREF_SRC_RAM) &&
+        ((sImgRef.eImgFlags & GSLC_IMGREF_SRC) != GSLC_IMGREF_SRC_PROG)) {
+      continue;
+    }
+    // Skip images that are already held by a previous preload
+    gslc_tsDrvImgShareEntry* pEntry = gslc_DrvImgShareFind(sImgRef.pImgBuf,sImgRef.eImgFlags,NULL);
+    if ((pEntry != NULL) && (pEntry->bPreload)) {
+      continue;
+    }
+    // Load the image (or take a reference on the shared copy)
+    void* pvImg = gslc_DrvLoadImage(pGui,sImgRef);
+    if (pvImg == NULL) {
+      GSLC_DEBUG2_PRINT("ERROR: DrvImagePreload(%u) failed to load image\n",nInd);
+      bOk = false;
+      continue;
+    }
+    pEntry = gslc_DrvImgShareFind(NULL,GSLC_IMGREF_NONE,pvImg);
+    if (pEntry == NULL) {
+      // The share table is full so the image can't be retained
+      GSLC_DEBUG2_PRINT("ERROR: DrvImagePreload(%u) exceeds DRV_SDL_IMG_SHARE_MAX\n",nInd);
+      gslc_DrvImageDestruct(pvImg);
+      bOk = false;
+      continue;
+    }
+    pEntry->bPreload = true;
+  }
+  return bOk;
+  #else
+  (void)nNumImg; // Unused
+  return false;
+  #endif
+}
+
+void gslc_DrvImagePreloadRelease(gslc_tsGui* pGui)
+{
+  (void)pGui; // Unused
+  #if (DRV_SDL_IMG_SHARE_MAX > 0)
+  uint16_t  nInd;
+  for (nInd=0;nInd<DRV_SDL_IMG_SHARE_MAX;nInd++) {
+    gslc_tsDrvImgShareEntry* pEntry = &m_asDrvImgShare[nInd];
+    if ((pEntry->pImgBuf != NULL) && (pEntry->bPreload)) {
+      pEntry->bPreload = false;
+      gslc_DrvImageDestruct(pEntry->pvImg);
+    }
+  }
+  #endif
+}
+
 bool gslc_DrvSetClipRect(gslc_tsGui* pGui,gslc_tsRect* pRect)
 {
   gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
@@ -557,6 +634,8 @@ void gslc_DrvFontsDestruct(gslc_tsGui* pGui)
 {
   uint16_t  nFontInd;
   TTF_Font* pFont = NULL;
+  // Cached text refers to the fonts being released
+  gslc_DrvTxtCacheFlush(pGui);
   for (nFontInd=0;nFontInd<pGui->nFontCnt;nFontInd++) {
     if (pGui->asFont[nFontInd].pvFont != NULL) {
       pFont = (TTF_Font*)(pGui->asFont[nFontInd].pvFont);
@@ -575,6 +654,29 @@ bool gslc_DrvGetTxtSize(gslc_tsGui* pGui,gslc_tsFont* pFont,const char* pStr,gsl
   int32_t nTxtSzW,nTxtSzH;
   TTF_Font* pDrvFont = (TTF_Font*)(pFont->pvFont);
   if (!pDrvFont) { return false; }
+  // No offset coordinates used
+  *pnTxtX = 0;
+  *pnTxtY = 0;
+
+  #if (DRV_SDL_TXT_SIZE_CACHE_MAX > 0)
+  // Check for a cached measurement
+  gslc_tsDriver*           pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  gslc_tsDrvTxtCacheStat*  pStat = &pDriver->sTxtSizeCacheStat;
+  gslc_tsDrvTxtCacheEntry* pEntry;
+  uint8_t                  eTxtEnc = eTxtFlags & GSLC_TXT_ENC;
+  uint32_t                 nHash = gslc_DrvTxtCacheHash(pStr);
+  pEntry = gslc_DrvTxtCacheFind(pDriver->asTxtSizeCache,DRV_SDL_TXT_SIZE_CACHE_MAX,nHash,
+    pDrvFont,eTxtEnc,false,GSLC_COL_BLACK,pStr);
+  if (pEntry) {
+    pStat->nHits++;
+    pEntry->nLastUse = ++pDriver->nTxtCacheUse;
+    *pnTxtSzW = pEntry->nTxtSzW;
+    *pnTxtSzH = pEntry->nTxtSzH;
+    return true;
+  }
+  pStat->nMisses++;
+  #endif // DRV_SDL_TXT_SIZE_CACHE_MAX
+
   if ((eTxtFlags & GSLC_TXT_ENC) == GSLC_TXT_ENC_UTF8) {
     TTF_SizeUTF8(pDrvFont,pStr,&nTxtSzW,&nTxtSzH);
   } else {
@@ -582,9 +684,31 @@ bool gslc_DrvGetTxtSize(gslc_tsGui* pGui,gslc_tsFont* pFont,const char* pStr,gsl
   }
   *pnTxtSzW = (uint16_t)nTxtSzW;
   *pnTxtSzH = (uint16_t)nTxtSzH;
-  // No offset coordinates used
-  *pnTxtX = 0;
-  *pnTxtY = 0;
+
+  #if (DRV_SDL_TXT_SIZE_CACHE_MAX > 0)
+  // Retain the measurement
+  size_t   nStrLen = strlen(pStr);
+  uint32_t nBytes = (uint32_t)(sizeof(gslc_tsDrvTxtCacheEntry) + nStrLen + 1);
+  pEntry = gslc_DrvTxtCacheAlloc(pDriver->asTxtSizeCache,DRV_SDL_TXT_SIZE_CACHE_MAX,pStat,
+    DRV_SDL_TXT_SIZE_CACHE_BYTES,nBytes);
+  if (pEntry) {
+    pEntry->pStr = (char*)malloc(nStrLen + 1);
+    if (pEntry->pStr) {
+      memcpy(pEntry->pStr,pStr,nStrLen + 1);
+      pEntry->nHash = nHash;
+      pEntry->pvFont = pDrvFont;
+      pEntry->eTxtEnc = eTxtEnc;
+      pEntry->nTxtSzW = *pnTxtSzW;
+      pEntry->nTxtSzH = *pnTxtSzH;
+      pEntry->nBytes = nBytes;
+      pEntry->nLastUse = ++pDriver->nTxtCacheUse;
+      pEntry->pvImg = NULL;
+      pStat->nBytes += nBytes;
+      pStat->nEntries++;
+    }
+  }
+  #endif // DRV_SDL_TXT_SIZE_CACHE_MAX
+
   return true;
 }
 
@@ -608,6 +732,31 @@ bool gslc_DrvDrawTxt(gslc_tsGui* pGui,int16_t nTxtX,int16_t nTxtY,gslc_tsFont* p
   SDL_Surface*    pSurfTxt  = NULL;
   TTF_Font*       pDrvFont  = (TTF_Font*)(pFont->pvFont);
   if (!pDrvFont) { return false; }
+
+  #if (DRV_SDL_TXT_CACHE_MAX > 0)
+  // Check for previously rendered text
+  // - The cache retains the surface (SDL1) or texture (SDL2)
+  gslc_tsDrvTxtCacheStat*  pStat = &pDriver->sTxtCacheStat;
+  gslc_tsDrvTxtCacheEntry* pEntry;
+  uint8_t                  eTxtEnc = eTxtFlags & GSLC_TXT_ENC;
+  uint32_t                 nHash = gslc_DrvTxtCacheHash(pStr);
+  pEntry = gslc_DrvTxtCacheFind(pDriver->asTxtCache,DRV_SDL_TXT_CACHE_MAX,nHash,
+    pDrvFont,eTxtEnc,true,colTxt,pStr);
+  if (pEntry) {
+    pStat->nHits++;
+    pEntry->nLastUse = ++pDriver->nTxtCacheUse;
+    #if defined(DRV_DISP_SDL1)
+    gslc_DrvPasteSurface(pGui,nTxtX,nTxtY,pEntry->pvImg,pDriver->pSurfScreen);
+    #endif
+    #if defined(DRV_DISP_SDL2)
+    SDL_Rect rRectCache = (SDL_Rect){nTxtX,nTxtY,pEntry->nTxtSzW,pEntry->nTxtSzH};
+    SDL_RenderCopy(pDriver->pRender,(SDL_Texture*)(pEntry->pvImg),NULL,&rRectCache);
+    #endif
+    return true;
+  }
+  pStat->nMisses++;
+  #endif // DRV_SDL_TXT_CACHE_MAX
+
   if ((eTxtFlags & GSLC_TXT_ENC) == GSLC_TXT_ENC_UTF8) {
     pSurfTxt = TTF_RenderUTF8_Blended(pDrvFont,pStr,gslc_DrvAdaptColor(colTxt));
   } else {
@@ -618,6 +767,8 @@ bool gslc_DrvDrawTxt(gslc_tsGui* pGui,int16_t nTxtX,int16_t nTxtY,gslc_tsFont* p
     return false;
   }
 
+  // Rendered image to draw and potentially retain
+  void* pvImg = (void*)pSurfTxt;
 
 #if defined(DRV_DISP_SDL1)
   gslc_DrvPasteSurface(pGui,nTxtX,nTxtY,pSurfTxt,pDriver->pSurfScreen);
@@ -628,26 +779,97 @@ bool gslc_DrvDrawTxt(gslc_tsGui* pGui,int16_t nTxtX,int16_t nTxtY,gslc_tsFont* p
   SDL_Texture* pTex = SDL_CreateTextureFromSurface(pRender,pSurfTxt);
   if (pTex == NULL) {
     GSLC_DEBUG2_PRINT("ERROR: DrvDrawTxt() error in SDL_CreateTextureFromSurface(): %s\n",SDL_GetError());
+    SDL_FreeSurface(pSurfTxt);
     return false;
   }
   SDL_RenderCopy(pRender,pTex,NULL,&rRect);
-
-  // Destroy texture
-  // TODO: Consider if worth optimizing by retaining texture in case
-  //       we need to redraw it without changing content
-  SDL_DestroyTexture(pTex);
-  pTex = NULL;
+  pvImg = (void*)pTex;
 #endif
 
-  // Dispose of temporary surface
-  if (pSurfTxt != NULL) {
+  #if (DRV_SDL_TXT_CACHE_MAX > 0)
+  // Retain the rendered text
+  // - Account for the pixel data of the surface or texture
+  //   along with the copy of the string
+  size_t   nStrLen = strlen(pStr);
+  uint32_t nBytes = (uint32_t)pSurfTxt->w * pSurfTxt->h * 4 + nStrLen + 1;
+  pEntry = gslc_DrvTxtCacheAlloc(pDriver->asTxtCache,DRV_SDL_TXT_CACHE_MAX,pStat,
+    DRV_SDL_TXT_CACHE_BYTES,nBytes);
+  if (pEntry) {
+    pEntry->pStr = (char*)malloc(nStrLen + 1);
+    if (pEntry->pStr) {
+      memcpy(pEntry->pStr,pStr,nStrLen + 1);
+      pEntry->nHash = nHash;
+      pEntry->pvFont = pDrvFont;
+      pEntry->colTxt = colTxt;
+      pEntry->eTxtEnc = eTxtEnc;
+      pEntry->nTxtSzW = (uint16_t)pSurfTxt->w;
+      pEntry->nTxtSzH = (uint16_t)pSurfTxt->h;
+      pEntry->nBytes = nBytes;
+      pEntry->nLastUse = ++pDriver->nTxtCacheUse;
+      pEntry->pvImg = pvImg;
+      pStat->nBytes += nBytes;
+      pStat->nEntries++;
+      // Ownership of the image has moved to the cache
+      pvImg = NULL;
+    }
+  }
+  #endif // DRV_SDL_TXT_CACHE_MAX
+
+#if defined(DRV_DISP_SDL2)
+  // The surface is no longer needed once the texture is created
+  SDL_FreeSurface(pSurfTxt);
+  pSurfTxt = NULL;
+  // Destroy the texture if it wasn't retained
+  if (pvImg != NULL) {
+    SDL_DestroyTexture((SDL_Texture*)pvImg);
+  }
+#else
+  // Dispose of temporary surface if it wasn't retained
+  if (pvImg != NULL) {
     SDL_FreeSurface(pSurfTxt);
-    pSurfTxt = NULL;
   }
+  pSurfTxt = NULL;
+#endif
 
   return true;
 }
 
+void gslc_DrvTxtCacheFlush(gslc_tsGui* pGui)
+{
+  if (pGui == NULL) {
+    GSLC_DEBUG2_PRINT("ERROR: DrvTxtCacheFlush(%s) with NULL ptr\n","");
+    return;
+  }
+  gslc_tsDriver*  pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  uint16_t        nInd;
+  (void)nInd; // Unused if both caches are disabled
+  #if (DRV_SDL_TXT_CACHE_MAX > 0)
+  for (nInd=0;nInd<DRV_SDL_TXT_CACHE_MAX;nInd++) {
+    gslc_DrvTxtCacheRelease(&pDriver->asTxtCache[nInd],&pDriver->sTxtCacheStat);
+  }
+  #endif
+  #if (DRV_SDL_TXT_SIZE_CACHE_MAX > 0)
+  for (nInd=0;nInd<DRV_SDL_TXT_SIZE_CACHE_MAX;nInd++) {
+    gslc_DrvTxtCacheRelease(&pDriver->asTxtSizeCache[nInd],&pDriver->sTxtSizeCacheStat);
+  }
+  #endif
+}
+
+void gslc_DrvTxtCacheGetStats(gslc_tsGui* pGui,gslc_tsDrvTxtCacheStat* pStatTxt,gslc_tsDrvTxtCacheStat* pStatSize)
+{
+  if (pGui == NULL) {
+    GSLC_DEBUG2_PRINT("ERROR: DrvTxtCacheGetStats(%s) with NULL ptr\n","");
+    return;
+  }
+  gslc_tsDriver*  pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  if (pStatTxt) {
+    *pStatTxt = pDriver->sTxtCacheStat;
+  }
+  if (pStatSize) {
+    *pStatSize = pDriver->sTxtSizeCacheStat;
+  }
+}
+
 
 // -----------------------------------------------------------------------
 // Screen Management Functions
@@ -1023,6 +1245,72 @@ bool gslc_DrvGetTouch(gslc_tsGui* pGui,int16_t* pnX,int16_t* pnY,uint16_t* pnPre
 }
 
 
+bool gslc_DrvWaitInput(gslc_tsGui* pGui,uint32_t nTimeoutMs)
+{
+  if (pGui == NULL) {
+    GSLC_DEBUG2_PRINT("ERROR: DrvWaitInput(%s) called with NULL ptr\n","");
+    return false;
+  }
+
+  #if defined(DRV_DISP_SDL2) && !defined(DRV_TOUCH_TSLIB)
+  // Wait for an event without removing it from the queue
+  return (SDL_WaitEventTimeout(NULL,(int)nTimeoutMs) != 0);
+
+  #else
+  // SDL1.2 has no timed wait, and tslib input arrives outside of the
+  // SDL event queue (which still carries the keyboard and quit events),
+  // so wait in slices of DRV_SDL_WAIT_POLL_MS and check both sources
+  #if defined(DRV_TOUCH_TSLIB)
+  // - If tslib was not loaded, only the SDL event queue is checked
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  struct pollfd  sPoll;
+  int            nFdCnt = 0;
+  if (pDriver->pTsDev != NULL) {
+    sPoll.fd      = ts_fd(pDriver->pTsDev);
+    sPoll.events  = POLLIN;
+    nFdCnt = 1;
+  }
+  #endif
+  #if defined(DRV_DISP_SDL1)
+  SDL_Event sEvent;
+  #endif
+  Uint32    nStartMs = SDL_GetTicks();
+  Uint32    nElapsedMs;
+  Uint32    nSliceMs;
+  while (1) {
+    SDL_PumpEvents();
+    #if defined(DRV_DISP_SDL1)
+    if (SDL_PeepEvents(&sEvent,1,SDL_PEEKEVENT,SDL_ALLEVENTS) > 0) {
+      return true;
+    }
+    #else
+    if (SDL_HasEvents(SDL_FIRSTEVENT,SDL_LASTEVENT)) {
+      return true;
+    }
+    #endif
+    nElapsedMs = SDL_GetTicks() - nStartMs;
+    if (nElapsedMs >= nTimeoutMs) {
+      return false;
+    }
+    nSliceMs = nTimeoutMs - nElapsedMs;
+    if (nSliceMs > DRV_SDL_WAIT_POLL_MS) {
+      nSliceMs = DRV_SDL_WAIT_POLL_MS;
+    }
+    #if defined(DRV_TOUCH_TSLIB)
+    if (nFdCnt > 0) {
+      sPoll.revents = 0;
+      if (poll(&sPoll,nFdCnt,(int)nSliceMs) > 0) {
+        return true;
+      }
+      continue;
+    }
+    #endif
+    SDL_Delay(nSliceMs);
+  }
+  #endif
+}
+
+
 /// Change display rotation and any associated touch orientation
 bool gslc_DrvRotate(gslc_tsGui* pGui, uint8_t nRotation)
 {
@@ -1215,6 +1503,324 @@ SDL_Color  gslc_DrvAdaptColor(gslc_tsColor sCol)
 }
 
 
+// -----------------------------------------------------------------------
+// Private Image Functions
+// -----------------------------------------------------------------------
+
+void* gslc_DrvImageFromSurface(gslc_tsGui* pGui,SDL_Surface* pSurf,bool bAlpha)
+{
+  if (pSurf == NULL) {
+    return NULL;
+  }
+
+  // Support optional transparency
+  // - The color key is assigned to the source surface so that it
+  //   is carried through the conversion to the display format
+  if ((!bAlpha) && (GSLC_BMP_TRANS_EN)) {
+    // Color key surface
+    // - Use transparency color key defined in BMP_TRANS_RGB
+    #if defined(DRV_DISP_SDL1)
+    SDL_SetColorKey( pSurf, SDL_SRCCOLORKEY | SDL_RLEACCEL,
+      SDL_MapRGB( pSurf->format, GSLC_BMP_TRANS_RGB ) );
+    #endif
+    #if defined(DRV_DISP_SDL2)
+    // - SDL2 passes SDL_TRUE instead of SDL_SRCCOLORKEY
+    SDL_SetColorKey( pSurf, SDL_TRUE,
+      SDL_MapRGB( pSurf->format, GSLC_BMP_TRANS_RGB ) );
+    #endif
+  } // GSLC_BMP_TRANS_EN
+
+  #if defined(DRV_DISP_SDL1)
+  (void)pGui; // Unused
+
+  // Create an optimized surface in the display format so that
+  // blits to the screen don't need to convert pixels
+  SDL_Surface* pSurfOptimized = NULL;
+  if (bAlpha) {
+    pSurfOptimized = SDL_DisplayFormatAlpha(pSurf);
+  } else {
+    pSurfOptimized = SDL_DisplayFormat(pSurf);
+  }
+  SDL_FreeSurface(pSurf);
+  if (pSurfOptimized == NULL) {
+    GSLC_DEBUG2_PRINT("ERROR: DrvImageFromSurface() SDL_DisplayFormat() failed: %s\n",SDL_GetError());
+    return NULL;
+  }
+  return (void*)pSurfOptimized;
+  #endif
+
+  #if defined(DRV_DISP_SDL2)
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+
+  // Upload the surface to a texture
+  // - Surfaces with a color key or alpha channel produce a texture
+  //   that is blended when copied
+  SDL_Texture* pTex = SDL_CreateTextureFromSurface(pDriver->pRender,pSurf);
+  SDL_FreeSurface(pSurf);
+  if (pTex == NULL) {
+    GSLC_DEBUG2_PRINT("ERROR: DrvImageFromSurface() SDL_CreateTextureFromSurface() failed: %s\n",SDL_GetError());
+    return NULL;
+  }
+  return (void*)pTex;
+  #endif
+}
+
+uint32_t gslc_DrvRgb565ToArgb(uint16_t nCol)
+{
+  // Replicate the upper bits so that full intensity maps to 0xFF
+  uint32_t nR = ((nCol >> 8) & 0xF8) | (nCol >> 13);
+  uint32_t nG = ((nCol >> 3) & 0xFC) | ((nCol >> 9) & 0x03);
+  uint32_t nB = ((nCol << 3) & 0xF8) | ((nCol >> 2) & 0x07);
+  return 0xFF000000 | (nR << 16) | (nG << 8) | nB;
+}
+
+SDL_Surface* gslc_DrvLoadSurfaceMem(gslc_tsImgRef sImgRef,bool* pbAlpha)
+{
+  const unsigned char*  pImgBuf = sImgRef.pImgBuf;
+  gslc_teImgRefFlags    eFmt = (gslc_teImgRefFlags)(sImgRef.eImgFlags & GSLC_IMGREF_FMT);
+  SDL_Surface*          pSurf = NULL;
+  int16_t               nW,nH;
+  int16_t               nX,nY;
+
+  *pbAlpha = false;
+  if (pImgBuf == NULL) {
+    GSLC_DEBUG2_PRINT("ERROR: DrvLoadSurfaceMem(%s) with NULL ptr\n","");
+    return NULL;
+  }
+
+  if ((eFmt == GSLC_IMGREF_FMT_BMP24) || (eFmt == GSLC_IMGREF_FMT_BMP16)) {
+    if ((pImgBuf[0] == 'B') && (pImgBuf[1] == 'M')) {
+      // Complete BMP file image
+      // - Let SDL parse the BMP variants just as it does for files
+      uint32_t nFileSize = (uint32_t)pImgBuf[2] | ((uint32_t)pImgBuf[3] << 8) |
+        ((uint32_t)pImgBuf[4] << 16) | ((uint32_t)pImgBuf[5] << 24);
+      pSurf = SDL_LoadBMP_RW(SDL_RWFromConstMem(pImgBuf,(int)nFileSize),1);
+      if (pSurf == NULL) {
+        GSLC_DEBUG2_PRINT("ERROR: DrvLoadSurfaceMem() SDL_LoadBMP_RW() failed: %s\n",SDL_GetError());
+      }
+      return pSurf;
+    }
+
+    // RGB565 array: height, width followed by the pixels
+    // - Wrap the pixels in a surface without copying them, since
+    //   the conversion to the display format makes the copy
+    const uint16_t* pImage = (const uint16_t*)pImgBuf;
+    nH = (int16_t)pImage[0];
+    nW = (int16_t)pImage[1];
+    if ((nW <= 0) || (nH <= 0)) {
+      GSLC_DEBUG2_PRINT("ERROR: DrvLoadSurfaceMem() invalid dimensions %d x %d\n",nW,nH);
+      return NULL;
+    }
+    pSurf = SDL_CreateRGBSurfaceFrom((void*)(pImage+2),nW,nH,16,nW*2,0xF800,0x07E0,0x001F,0);
+    if (pSurf == NULL) {
+      GSLC_DEBUG2_PRINT("ERROR: DrvLoadSurfaceMem() SDL_CreateRGBSurfaceFrom() failed: %s\n",SDL_GetError());
+    }
+    return pSurf;
+  }
+
+  if ((eFmt != GSLC_IMGREF_FMT_RAW1) && (eFmt != GSLC_IMGREF_FMT_RLE16)) {
+    GSLC_DEBUG2_PRINT("ERROR: DrvLoadSurfaceMem() unsupported format 0x%X\n",(unsigned)eFmt);
+    return NULL;
+  }
+
+  // Monochrome and run-length encoded images are expanded into
+  // a surface with an alpha channel that marks the transparent pixels
+  const uint16_t* pRle = NULL;
+  uint32_t        nColMono = 0;
+  if (eFmt == GSLC_IMGREF_FMT_RAW1) {
+    // Header: width, height (big-endian) and color
+    nW = (int16_t)((pImgBuf[0] << 8) | pImgBuf[1]);
+    nH = (int16_t)((pImgBuf[2] << 8) | pImgBuf[3]);
+    nColMono = 0xFF000000 | ((uint32_t)pImgBuf[4] << 16) | ((uint32_t)pImgBuf[5] << 8) | pImgBuf[6];
+  } else {
+    // Header: height, width, number of run words
+    pRle = (const uint16_t*)pImgBuf;
+    nH = (int16_t)pRle[0];
+    nW = (int16_t)pRle[1];
+    pRle += 3;
+  }
+  if ((nW <= 0) || (nH <= 0)) {
+    GSLC_DEBUG2_PRINT("ERROR: DrvLoadSurfaceMem() invalid dimensions %d x %d\n",nW,nH);
+    return NULL;
+  }
+
+  #if defined(DRV_DISP_SDL1)
+  pSurf = SDL_CreateRGBSurface(SDL_SWSURFACE,nW,nH,32,0x00FF0000,0x0000FF00,0x000000FF,0xFF000000);
+  #endif
+  #if defined(DRV_DISP_SDL2)
+  pSurf = SDL_CreateRGBSurface(0,nW,nH,32,0x00FF0000,0x0000FF00,0x000000FF,0xFF000000);
+  #endif
+  if (pSurf == NULL) {
+    GSLC_DEBUG2_PRINT("ERROR: DrvLoadSurfaceMem() SDL_CreateRGBSurface() failed: %s\n",SDL_GetError());
+    return NULL;
+  }
+  if (SDL_MUSTLOCK(pSurf)) {
+    if (SDL_LockSurface(pSurf) < 0) {
+      GSLC_DEBUG2_PRINT("ERROR: DrvLoadSurfaceMem() can't lock surface: %s\n",SDL_GetError());
+      SDL_FreeSurface(pSurf);
+      return NULL;
+    }
+  }
+
+  if (eFmt == GSLC_IMGREF_FMT_RAW1) {
+    const unsigned char* pBits = pImgBuf + 7;
+    int16_t nByteWidth = (nW + 7) / 8;
+    for (nY=0;nY<nH;nY++) {
+      uint32_t* pDst = (uint32_t*)((uint8_t*)pSurf->pixels + nY*pSurf->pitch);
+      const unsigned char* pRow = pBits + nY*nByteWidth;
+      for (nX=0;nX<nW;nX++) {
+        pDst[nX] = (pRow[nX>>3] & (0x80 >> (nX & 7))) ? nColMono : 0;
+      }
+    }
+  } else {
+    for (nY=0;nY<nH;nY++) {
+      uint32_t* pDst = (uint32_t*)((uint8_t*)pSurf->pixels + nY*pSurf->pitch);
+      nX = 0;
+      while (nX < nW) {
+        uint16_t nRun   = *(pRle++);
+        uint16_t nType  = nRun & GSLC_IMG_RLE16_TYPE;
+        int16_t  nLen   = (int16_t)(nRun & GSLC_IMG_RLE16_LEN);
+        int16_t  nInd;
+        if (nX + nLen > nW) {
+          nLen = nW - nX; // Guard against malformed runs
+        }
+        if (nType == GSLC_IMG_RLE16_SKIP) {
+          for (nInd=0;nInd<nLen;nInd++) { pDst[nX+nInd] = 0; }
+        } else if (nType == GSLC_IMG_RLE16_FILL) {
+          uint32_t nPix = gslc_DrvRgb565ToArgb(*(pRle++));
+          for (nInd=0;nInd<nLen;nInd++) { pDst[nX+nInd] = nPix; }
+        } else {
+          for (nInd=0;nInd<nLen;nInd++) {
+            pDst[nX+nInd] = gslc_DrvRgb565ToArgb(*(pRle++));
+          }
+        }
+        if (nLen == 0) {
+          break; // Malformed run
+        }
+        nX += nLen;
+      }
+    }
+  }
+
+  if (SDL_MUSTLOCK(pSurf)) {
+    SDL_UnlockSurface(pSurf);
+  }
+  *pbAlpha = true;
+  return pSurf;
+}
+
+gslc_tsDrvImgShareEntry* gslc_DrvImgShareFind(const unsigned char* pImgBuf,gslc_teImgRefFlags eImgFlags,void* pvImg)
+{
+  #if (DRV_SDL_IMG_SHARE_MAX > 0)
+  uint16_t  nInd;
+  for (nInd=0;nInd<DRV_SDL_IMG_SHARE_MAX;nInd++) {
+    gslc_tsDrvImgShareEntry* pEntry = &m_asDrvImgShare[nInd];
+    if (pImgBuf != NULL) {
+      if ((pEntry->pImgBuf == pImgBuf) && (pEntry->eImgFlags == eImgFlags)) {
+        return pEntry;
+      }
+    } else if (pvImg != NULL) {
+      if ((pEntry->pImgBuf != NULL) && (pEntry->pvImg == pvImg)) {
+        return pEntry;
+      }
+    } else if (pEntry->pImgBuf == NULL) {
+      return pEntry;
+    }
+  }
+  #else
+  (void)pImgBuf;   // Unused
+  (void)eImgFlags; // Unused
+  (void)pvImg;     // Unused
+  #endif
+  return NULL;
+}
+
+
+// -----------------------------------------------------------------------
+// Private Text Cache Functions
+// -----------------------------------------------------------------------
+
+uint32_t gslc_DrvTxtCacheHash(const char* pStr)
+{
+  uint32_t nHash = 2166136261UL;
+  while (*pStr) {
+    nHash ^= (uint8_t)(*pStr++);
+    nHash *= 16777619UL;
+  }
+  return nHash;
+}
+
+gslc_tsDrvTxtCacheEntry* gslc_DrvTxtCacheFind(gslc_tsDrvTxtCacheEntry* asEntry,uint16_t nEntryMax,uint32_t nHash,
+  void* pvFont,uint8_t eTxtEnc,bool bMatchCol,gslc_tsColor colTxt,const char* pStr)
+{
+  uint16_t                 nInd;
+  gslc_tsDrvTxtCacheEntry* pEntry;
+  for (nInd=0;nInd<nEntryMax;nInd++) {
+    pEntry = &asEntry[nInd];
+    if ((pEntry->pStr == NULL) || (pEntry->nHash != nHash)) { continue; }
+    if ((pEntry->pvFont != pvFont) || (pEntry->eTxtEnc != eTxtEnc)) { continue; }
+    if (bMatchCol && !gslc_ColorEqual(pEntry->colTxt,colTxt)) { continue; }
+    // Confirm the content in case of a hash collision
+    if (strcmp(pEntry->pStr,pStr) != 0) { continue; }
+    return pEntry;
+  }
+  return NULL;
+}
+
+gslc_tsDrvTxtCacheEntry* gslc_DrvTxtCacheAlloc(gslc_tsDrvTxtCacheEntry* asEntry,uint16_t nEntryMax,
+  gslc_tsDrvTxtCacheStat* pStat,uint32_t nBytesMax,uint32_t nBytes)
+{
+  if (nBytes > nBytesMax) {
+    return NULL;
+  }
+  uint16_t                 nInd;
+  gslc_tsDrvTxtCacheEntry* pEntry;
+  gslc_tsDrvTxtCacheEntry* pEntryFree;
+  gslc_tsDrvTxtCacheEntry* pEntryLru;
+  for (;;) {
+    // Locate a free entry and the least recently used entry
+    pEntryFree = NULL;
+    pEntryLru = NULL;
+    for (nInd=0;nInd<nEntryMax;nInd++) {
+      pEntry = &asEntry[nInd];
+      if (pEntry->pStr == NULL) {
+        if (pEntryFree == NULL) { pEntryFree = pEntry; }
+      } else if ((pEntryLru == NULL) || ((int32_t)(pEntry->nLastUse - pEntryLru->nLastUse) < 0)) {
+        pEntryLru = pEntry;
+      }
+    }
+    if ((pEntryFree) && (pStat->nBytes + nBytes <= nBytesMax)) {
+      return pEntryFree;
+    }
+    if (pEntryLru == NULL) {
+      return NULL;
+    }
+    gslc_DrvTxtCacheRelease(pEntryLru,pStat);
+    pStat->nEvicts++;
+  }
+}
+
+void gslc_DrvTxtCacheRelease(gslc_tsDrvTxtCacheEntry* pEntry,gslc_tsDrvTxtCacheStat* pStat)
+{
+  if (pEntry->pStr == NULL) {
+    return;
+  }
+  if (pEntry->pvImg) {
+    #if defined(DRV_DISP_SDL1)
+    SDL_FreeSurface((SDL_Surface*)(pEntry->pvImg));
+    #endif
+    #if defined(DRV_DISP_SDL2)
+    SDL_DestroyTexture((SDL_Texture*)(pEntry->pvImg));
+    #endif
+    pEntry->pvImg = NULL;
+  }
+  free(pEntry->pStr);
+  pEntry->pStr = NULL;
+  pStat->nBytes -= pEntry->nBytes;
+  pStat->nEntries--;
+}
+
+
 // -----------------------------------------------------------------------
 // Private Drawing Functions
 // -----------------------------------------------------------------------
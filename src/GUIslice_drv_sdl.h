@@ -104,6 +104,93 @@ extern "C" {
 #endif
 
 #define DRV_OVERRIDE_TXT_ALIGN      0 ///< Driver provides text alignment
+#define DRV_HAS_DRAW_TXT_CLIP       1 ///< gslc_DrvDrawTxt() clips to the clipping region
+#define DRV_HAS_WAIT_INPUT          1 ///< Support gslc_DrvWaitInput()
+#define DRV_HAS_IMG_PRELOAD         1 ///< Support gslc_DrvImagePreload()
+
+// Interval between input checks in gslc_DrvWaitInput() with SDL1.2 or tslib
+#if !defined(DRV_SDL_WAIT_POLL_MS)
+  #define DRV_SDL_WAIT_POLL_MS      10
+#endif
+
+// =======================================================================
+// Text cache configuration
+// - Rendering text through SDL_ttf is expensive, so the rendered
+//   text (surfaces in SDL1, textures in SDL2) and the text extents
+//   are retained in least-recently-used caches keyed by the font,
+//   string content, color and encoding.
+// - DRV_SDL_TXT_CACHE_MAX:        Maximum number of rendered strings
+//                                 retained. Set to 0 to disable.
+// - DRV_SDL_TXT_CACHE_BYTES:      Maximum bytes retained for rendered
+//                                 strings (pixel data and strings)
+// - DRV_SDL_TXT_SIZE_CACHE_MAX:   Maximum number of text extents
+//                                 retained. Set to 0 to disable.
+// - DRV_SDL_TXT_SIZE_CACHE_BYTES: Maximum bytes retained for text
+//                                 extents (entries and strings)
+// =======================================================================
+#if !defined(DRV_SDL_TXT_CACHE_MAX)
+  #define DRV_SDL_TXT_CACHE_MAX         64
+#endif
+#if !defined(DRV_SDL_TXT_CACHE_BYTES)
+  #define DRV_SDL_TXT_CACHE_BYTES       (2*1024*1024)
+#endif
+#if !defined(DRV_SDL_TXT_SIZE_CACHE_MAX)
+  #define DRV_SDL_TXT_SIZE_CACHE_MAX    128
+#endif
+#if !defined(DRV_SDL_TXT_SIZE_CACHE_BYTES)
+  #define DRV_SDL_TXT_SIZE_CACHE_BYTES  (16*1024)
+#endif
+
+/// Entry in a text cache
+typedef struct {
+  char*               pStr;             ///< Copy of string content (NULL if entry is unused)
+  uint32_t            nHash;            ///< Hash of string content
+  void*               pvFont;           ///< Font used to render or measure the string
+  gslc_tsColor        colTxt;           ///< Text color (rendered strings only)
+  uint8_t             eTxtEnc;          ///< Text encoding (GSLC_TXT_ENC_*)
+  uint16_t            nTxtSzW;          ///< Width of rendered text
+  uint16_t            nTxtSzH;          ///< Height of rendered text
+  uint32_t            nBytes;           ///< Bytes accounted to the entry
+  uint32_t            nLastUse;         ///< Use counter value at last access (for LRU)
+  void*               pvImg;            ///< Rendered surface (SDL1) or texture (SDL2)
+} gslc_tsDrvTxtCacheEntry;
+
+/// Statistics for a text cache
+typedef struct {
+  uint32_t            nHits;            ///< Number of lookups found in the cache
+  uint32_t            nMisses;          ///< Number of lookups not found in the cache
+  uint32_t            nEvicts;          ///< Number of entries evicted to make space
+  uint32_t            nBytes;           ///< Bytes currently held by the cache
+  uint16_t            nEntries;         ///< Number of entries currently in use
+} gslc_tsDrvTxtCacheStat;
+
+// =======================================================================
+// Image share configuration
+// - Images referenced from RAM or program memory (GSLC_IMGREF_SRC_RAM,
+//   GSLC_IMGREF_SRC_PROG) are converted once into a display-format
+//   surface (SDL1) or texture (SDL2) and shared by all elements that
+//   reference the same image data, using a reference count.
+// - gslc_DrvImagePreload() holds an additional reference so that the
+//   images stay resident across element and page changes.
+// - Sharing is keyed on the image data pointer, so in-memory images
+//   must not be modified after they are first loaded. The SDL targets
+//   don't use PROGMEM, so gslc_GetImageFromProg() images are also
+//   flagged as GSLC_IMGREF_SRC_RAM and can't be told apart.
+// - DRV_SDL_IMG_SHARE_MAX: Maximum number of distinct in-memory images
+//                          shared. Set to 0 to disable sharing.
+// =======================================================================
+#if !defined(DRV_SDL_IMG_SHARE_MAX)
+  #define DRV_SDL_IMG_SHARE_MAX         32
+#endif
+
+/// Entry in the image share table
+typedef struct {
+  const unsigned char* pImgBuf;         ///< Source image data (NULL if entry is unused)
+  gslc_teImgRefFlags  eImgFlags;        ///< Source image flags (GSLC_IMGREF_*)
+  void*               pvImg;            ///< Converted surface (SDL1) or texture (SDL2)
+  uint16_t            nRefCnt;          ///< Number of references held
+  bool                bPreload;         ///< Reference held by gslc_DrvImagePreload()
+} gslc_tsDrvImgShareEntry;
 
 // =======================================================================
 // Driver-specific members
@@ -125,6 +212,16 @@ typedef struct {
 
   gslc_tsRect         rClipRect;        ///< Clipping rectangle
 
+  #if (DRV_SDL_TXT_CACHE_MAX > 0)
+  gslc_tsDrvTxtCacheEntry asTxtCache[DRV_SDL_TXT_CACHE_MAX];         ///< Cache of rendered strings
+  #endif
+  #if (DRV_SDL_TXT_SIZE_CACHE_MAX > 0)
+  gslc_tsDrvTxtCacheEntry asTxtSizeCache[DRV_SDL_TXT_SIZE_CACHE_MAX]; ///< Cache of text extents
+  #endif
+  gslc_tsDrvTxtCacheStat  sTxtCacheStat;      ///< Statistics for rendered string cache
+  gslc_tsDrvTxtCacheStat  sTxtSizeCacheStat;  ///< Statistics for text extent cache
+  uint32_t                nTxtCacheUse;       ///< Use counter for text caches
+
 } gslc_tsDriver;
 
 
@@ -227,6 +324,9 @@ void* gslc_DrvGetDriverTouch(gslc_tsGui* pGui);
 /// Load a bitmap (*.bmp) and create a new image resource.
 /// Transparency is enabled by GSLC_BMP_TRANS_EN
 /// through use of color (GSLC_BMP_TRANS_RGB).
+/// - Images may be loaded from the file system, RAM or program memory
+/// - In-memory images are shared between references to the same data
+///   (see DRV_SDL_IMG_SHARE_MAX)
 ///
 /// \param[in]  pGui:        Pointer to GUI
 /// \param[in]  sImgRef:     Image reference
@@ -291,6 +391,39 @@ bool gslc_DrvSetElemImageGlow(gslc_tsGui* pGui,gslc_tsElem* pElem,gslc_tsImgRef
 void gslc_DrvImageDestruct(void* pvImg);
 
 
+///
+/// Load a set of images ahead of use
+/// - Converts each in-memory image (GSLC_IMGREF_SRC_RAM or
+///   GSLC_IMGREF_SRC_PROG) into a surface (SDL1) or texture (SDL2)
+///   and keeps it resident until gslc_DrvImagePreloadRelease().
+/// - Elements that later reference the same image data reuse the
+///   preloaded image instead of converting it again, so the image
+///   data must not be modified afterwards.
+/// - Image references from other sources are ignored.
+/// - Should be called after gslc_Init() and before the pages are created
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  asImgRef:    Array of image references
+/// \param[in]  nNumImg:     Number of image references in the array
+///
+/// \return true if all images were loaded, false if any failed
+///
+bool gslc_DrvImagePreload(gslc_tsGui* pGui,const gslc_tsImgRef* asImgRef,uint16_t nNumImg);
+
+
+///
+/// Release the images held by gslc_DrvImagePreload()
+/// - Images still referenced by elements remain loaded until
+///   the elements are destroyed
+/// - Called automatically by gslc_DrvDestruct()
+///
+/// \param[in]  pGui:        Pointer to GUI
+///
+/// \return none
+///
+void gslc_DrvImagePreloadRelease(gslc_tsGui* pGui);
+
+
 ///
 /// Set the clipping rectangle for future drawing updates
 ///
@@ -362,6 +495,27 @@ bool gslc_DrvGetTxtSize(gslc_tsGui* pGui,gslc_tsFont* pFont,const char* pStr,gsl
 ///
 bool gslc_DrvDrawTxt(gslc_tsGui* pGui,int16_t nTxtX,int16_t nTxtY,gslc_tsFont* pFont,const char* pStr,gslc_teTxtFlags eTxtFlags,gslc_tsColor colTxt,gslc_tsColor colBg);
 
+///
+/// Release all entries in the text caches
+/// - Called automatically when the fonts are released
+///
+/// \param[in]  pGui:        Pointer to GUI
+///
+/// \return none
+///
+void gslc_DrvTxtCacheFlush(gslc_tsGui* pGui);
+
+///
+/// Fetch the statistics for the text caches
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[out] pStatTxt:    Ptr to statistics for the rendered string cache (or NULL)
+/// \param[out] pStatSize:   Ptr to statistics for the text extent cache (or NULL)
+///
+/// \return none
+///
+void gslc_DrvTxtCacheGetStats(gslc_tsGui* pGui,gslc_tsDrvTxtCacheStat* pStatTxt,gslc_tsDrvTxtCacheStat* pStatSize);
+
 
 // -----------------------------------------------------------------------
 // Screen Management Functions
@@ -496,6 +650,21 @@ void gslc_DrvDrawBkgnd(gslc_tsGui* pGui);
 ///
 bool gslc_DrvGetTouch(gslc_tsGui* pGui,int16_t* pnX,int16_t* pnY,uint16_t* pnPress,gslc_teInputRawEvent* peInputEvent,int16_t* pnInputVal);
 
+///
+/// Wait until input is available from the touch / keyboard driver
+/// - Waits for an SDL event, and with tslib also for the touchscreen
+///   device file descriptor
+/// - With SDL1.2 or tslib there is no single timed wait covering all
+///   of the input, so the sources are checked every DRV_SDL_WAIT_POLL_MS
+/// - The input is not consumed
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nTimeoutMs:  Maximum time to wait (ms)
+///
+/// \return true if input is available, false if the timeout elapsed
+///
+bool gslc_DrvWaitInput(gslc_tsGui* pGui,uint32_t nTimeoutMs);
+
 
 // -----------------------------------------------------------------------
 // Dynamic Screen rotation and Touch axes swap/flip functions
@@ -668,6 +837,119 @@ void gslc_DrvPasteSurface(gslc_tsGui* pGui,int16_t nX, int16_t nY, void* pvSrc,
 
 
 
+// -----------------------------------------------------------------------
+// Private Image Functions
+// -----------------------------------------------------------------------
+
+///
+/// Convert a loaded surface into the image used for drawing
+/// - SDL1: Surface in the display format
+/// - SDL2: Texture for the renderer
+/// - The source surface is released
+///
+/// \param[in]  pGui:          Pointer to GUI
+/// \param[in]  pSurf:         Ptr to loaded surface
+/// \param[in]  bAlpha:        Surface carries per-pixel alpha, otherwise
+///                            GSLC_BMP_TRANS_EN selects the color key
+///
+/// \return Image pointer (surface/texture) or NULL if error
+///
+void* gslc_DrvImageFromSurface(gslc_tsGui* pGui,SDL_Surface* pSurf,bool bAlpha);
+
+///
+/// Convert an RGB565 color into an opaque ARGB8888 pixel
+///
+/// \param[in]  nCol:          RGB565 color
+///
+/// \return ARGB8888 pixel value
+///
+uint32_t gslc_DrvRgb565ToArgb(uint16_t nCol);
+
+///
+/// Load an image from RAM or program memory into a surface
+/// - BMP24/BMP16 images may either be a complete BMP file or the
+///   RGB565 array format (height, width, pixels) used by the
+///   other drivers
+/// - RAW1 and RLE16 images are expanded into a surface with
+///   per-pixel alpha
+///
+/// \param[in]  sImgRef:       Image reference
+/// \param[out] pbAlpha:       Set if the surface carries per-pixel alpha
+///
+/// \return Ptr to surface or NULL if error
+///
+SDL_Surface* gslc_DrvLoadSurfaceMem(gslc_tsImgRef sImgRef,bool* pbAlpha);
+
+///
+/// Locate an entry in the image share table
+/// - By source image data (pImgBuf), else by converted image (pvImg),
+///   else the first unused entry
+///
+/// \param[in]  pImgBuf:       Source image data (or NULL)
+/// \param[in]  eImgFlags:     Source image flags (if pImgBuf)
+/// \param[in]  pvImg:         Converted image (or NULL)
+///
+/// \return Ptr to matching entry or NULL if not found
+///
+gslc_tsDrvImgShareEntry* gslc_DrvImgShareFind(const unsigned char* pImgBuf,gslc_teImgRefFlags eImgFlags,void* pvImg);
+
+
+// -----------------------------------------------------------------------
+// Private Text Cache Functions
+// -----------------------------------------------------------------------
+
+///
+/// Calculate the hash of a string (FNV-1a)
+///
+/// \param[in]  pStr:          String to hash
+///
+/// \return Hash value
+///
+uint32_t gslc_DrvTxtCacheHash(const char* pStr);
+
+///
+/// Locate an entry in a text cache
+///
+/// \param[in]  asEntry:       Array of cache entries
+/// \param[in]  nEntryMax:     Number of entries in asEntry
+/// \param[in]  nHash:         Hash of string content
+/// \param[in]  pvFont:        Font
+/// \param[in]  eTxtEnc:       Text encoding
+/// \param[in]  bMatchCol:     Require that the text color matches
+/// \param[in]  colTxt:        Text color (if bMatchCol)
+/// \param[in]  pStr:          String content
+///
+/// \return Ptr to matching entry or NULL if not found
+///
+gslc_tsDrvTxtCacheEntry* gslc_DrvTxtCacheFind(gslc_tsDrvTxtCacheEntry* asEntry,uint16_t nEntryMax,uint32_t nHash,
+  void* pvFont,uint8_t eTxtEnc,bool bMatchCol,gslc_tsColor colTxt,const char* pStr);
+
+///
+/// Allocate an entry in a text cache, evicting the least recently
+/// used entries until both the entry and byte budgets are met
+///
+/// \param[in]  asEntry:       Array of cache entries
+/// \param[in]  nEntryMax:     Number of entries in asEntry
+/// \param[in]  pStat:         Ptr to cache statistics
+/// \param[in]  nBytesMax:     Byte budget for the cache
+/// \param[in]  nBytes:        Bytes required by the new entry
+///
+/// \return Ptr to unused entry or NULL if the entry can't fit within the budget
+///
+gslc_tsDrvTxtCacheEntry* gslc_DrvTxtCacheAlloc(gslc_tsDrvTxtCacheEntry* asEntry,uint16_t nEntryMax,
+  gslc_tsDrvTxtCacheStat* pStat,uint32_t nBytesMax,uint32_t nBytes);
+
+///
+/// Release a text cache entry and any resources associated with it
+///
+/// \param[in]  pEntry:        Ptr to cache entry
+/// \param[in]  pStat:         Ptr to cache statistics
+///
+/// \return none
+///
+void gslc_DrvTxtCacheRelease(gslc_tsDrvTxtCacheEntry* pEntry,gslc_tsDrvTxtCacheStat* pStat);
+
+
 // -----------------------------------------------------------------------
 // Private Touchscreen Functions (if using SDL)
 // -----------------------------------------------------------------------
@@ -95,7 +95,9 @@
     #error "GSLC_SD_EN=2 not yet implemented in TFT_eSPI mode"
   #endif
 #endif
- 
+
+// Routines shared with other drivers
+#include "GUIslice_drv_common_impl.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -417,6 +419,32 @@ bool gslc_DrvGetTxtSize(gslc_tsGui* pGui,gslc_tsFont* pFont,const char* pStr,gsl
 bool gslc_DrvDrawTxtAlign(gslc_tsGui* pGui,int16_t nX0,int16_t nY0,int16_t nX1,int16_t nY1,int8_t eTxtAlign,
         gslc_tsFont* pFont,const char* pStr,gslc_teTxtFlags eTxtFlags,gslc_tsColor colTxt, gslc_tsColor colBg=GSLC_COL_BLACK)
 {
+  #if (DRV_HAS_DRAW_TXT_GLYPHBUF)
+  // Render through the glyph buffer if selected for this font
+  // - As TFT_eSPI isn't performing the rendering, the alignment
+  //   is calculated here from the glyph extents
+  // - Transparent text (indicated by matching text and background
+  //   colors) is left to the library renderer
+  if ((pFont->eFontRefMode == DRV_FONTREF_MODE_GLYPHBUF) && (pFont->eFontRefType == GSLC_FONTREF_PTR) &&
+      (pFont->pvFont != NULL) && (!gslc_ColorEqual(colTxt,colBg))) {
+    int16_t nExtX0,nExtY0,nExtX1,nExtY1;
+    int16_t nCurX,nCurY;
+    gslc_DrvGlyphBufTxtExt(pFont,pStr,eTxtFlags,&nExtX0,&nExtY0,&nExtX1,&nExtY1);
+
+    // Check for ALIGNH_LEFT & ALIGNH_RIGHT. Default to ALIGNH_MID
+    if      (eTxtAlign & GSLC_ALIGNH_LEFT)     { nCurX = nX0 - nExtX0; }
+    else if (eTxtAlign & GSLC_ALIGNH_RIGHT)    { nCurX = nX1 - nExtX1; }
+    else                                       { nCurX = nX0 + (nX1-nX0)/2 - (nExtX0+nExtX1)/2; }
+
+    // Check for ALIGNV_TOP & ALIGNV_BOT. Default to ALIGNV_MID
+    if      (eTxtAlign & GSLC_ALIGNV_TOP)      { nCurY = nY0 - nExtY0; }
+    else if (eTxtAlign & GSLC_ALIGNV_BOT)      { nCurY = nY1 - nExtY1; }
+    else                                       { nCurY = nY0 + (nY1-nY0)/2 - (nExtY0+nExtY1)/2; }
+
+    return gslc_DrvDrawTxtGlyphBuf(pGui,nCurX,nCurY,pFont,pStr,eTxtFlags,colTxt,colBg);
+  }
+  #endif // DRV_HAS_DRAW_TXT_GLYPHBUF
+
   gslc_tsDriver*  pDriver = (gslc_tsDriver*)(pGui->pvDriver);
   uint16_t nColRaw = gslc_DrvAdaptColorToRaw(colTxt);
   uint16_t nColBgRaw = gslc_DrvAdaptColorToRaw(colBg);
@@ -491,6 +519,18 @@ bool gslc_DrvDrawTxtAlign(gslc_tsGui* pGui,int16_t nX0,int16_t nY0,int16_t nX1,i
 // should be used instead.
 bool gslc_DrvDrawTxt(gslc_tsGui* pGui,int16_t nTxtX,int16_t nTxtY,gslc_tsFont* pFont,const char* pStr,gslc_teTxtFlags eTxtFlags,gslc_tsColor colTxt, gslc_tsColor colBg=GSLC_COL_BLACK)
 {
+  #if (DRV_HAS_DRAW_TXT_GLYPHBUF)
+  // Render through the glyph buffer if selected for this font
+  // - The coordinate is treated as the top-left of the text
+  //   to match the TL_DATUM used below
+  if ((pFont->eFontRefMode == DRV_FONTREF_MODE_GLYPHBUF) && (pFont->eFontRefType == GSLC_FONTREF_PTR) &&
+      (pFont->pvFont != NULL) && (!gslc_ColorEqual(colTxt,colBg))) {
+    int16_t nExtX0,nExtY0,nExtX1,nExtY1;
+    gslc_DrvGlyphBufTxtExt(pFont,pStr,eTxtFlags,&nExtX0,&nExtY0,&nExtX1,&nExtY1);
+    return gslc_DrvDrawTxtGlyphBuf(pGui,nTxtX-nExtX0,nTxtY-nExtY0,pFont,pStr,eTxtFlags,colTxt,colBg);
+  }
+  #endif // DRV_HAS_DRAW_TXT_GLYPHBUF
+
   gslc_tsDriver*  pDriver = (gslc_tsDriver*)(pGui->pvDriver);
   uint16_t nTxtScale = pFont->nSize;
   uint16_t nColRaw = gslc_DrvAdaptColorToRaw(colTxt);
@@ -737,63 +777,6 @@ bool gslc_DrvDrawFillTriangle(gslc_tsGui* pGui,int16_t nX0,int16_t nY0,
 
 
 
-// ----- REFERENCE CODE begin
-// The following code was based upon the following reference code but modified to
-// adapt for use in GUIslice.
-//
-//   URL:              https://github.com/adafruit/Adafruit-GFX-Library/blob/master/Adafruit_GFX.cpp
-//   Original author:  Adafruit
-//   Function:         drawBitmap()
-
-// Draw a 1-bit image (bitmap) at the specified (x,y) position from the
-// provided bitmap buffer using the foreground color defined in the
-// header (unset bits are transparent).
-
-// GUIslice modified the raw memory format to add a header:
-// Image array format:
-// - Width[15:8],  Width[7:0],
-// - Height[15:8], Height[7:0],
-// - ColorR[7:0],  ColorG[7:0],
-// - ColorB[7:0],  0x00,
-// - Monochrome bitmap follows...
-//
-void gslc_DrvDrawMonoFromMem(gslc_tsGui* pGui,int16_t nDstX, int16_t nDstY,
- const unsigned char *pBitmap,bool bProgMem)
- {
-  const unsigned char*  bmap_base = pBitmap;
-  int16_t         w,h;
-  gslc_tsColor    nCol;
-
-  // Read header
-  w       = ( (bProgMem)? pgm_read_byte(bmap_base++) : *(bmap_base++) ) << 8;
-  w      |= ( (bProgMem)? pgm_read_byte(bmap_base++) : *(bmap_base++) ) << 0;
-  h       = ( (bProgMem)? pgm_read_byte(bmap_base++) : *(bmap_base++) ) << 8;
-  h      |= ( (bProgMem)? pgm_read_byte(bmap_base++) : *(bmap_base++) ) << 0;
-  nCol.r  =   (bProgMem)? pgm_read_byte(bmap_base++) : *(bmap_base++);
-  nCol.g  =   (bProgMem)? pgm_read_byte(bmap_base++) : *(bmap_base++);
-  nCol.b  =   (bProgMem)? pgm_read_byte(bmap_base++) : *(bmap_base++);
-
-  int16_t i, j, byteWidth = (w + 7) / 8;
-  uint8_t nByte = 0;
-
-  for(j=0; j<h; j++) {
-    for(i=0; i<w; i++) {
-      if(i & 7) nByte <<= 1;
-      else {
-        if (bProgMem) {
-          nByte = pgm_read_byte(bmap_base + j * byteWidth + i / 8);
-        } else {
-          nByte = bmap_base[j * byteWidth + i / 8];
-        }
-      }
-      if(nByte & 0x80) {
-        gslc_DrvDrawPoint(pGui,nDstX+i,nDstY+j,nCol);
-      }
-    }
-  }
-}
-// ----- REFERENCE CODE end
-
 void gslc_DrvDrawBmp24FromMem(gslc_tsGui* pGui,int16_t nDstX, int16_t nDstY,const unsigned char* pBitmap,bool bProgMem)
 {
   const uint16_t* pImage = (const uint16_t*)pBitmap;
@@ -802,6 +785,39 @@ void gslc_DrvDrawBmp24FromMem(gslc_tsGui* pGui,int16_t nDstX, int16_t nDstY,cons
 
   // Swap the colour byte order when rendering
   m_disp.setSwapBytes(true); 
+
+  #if (GSLC_CLIP_EN)
+  // If the image extends beyond the clipping region, push only
+  // the visible portion of each row. This avoids repainting the
+  // entire image when it is redrawn for a small region (such
+  // as a background image during a partial redraw).
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  gslc_tsRect rImg = (gslc_tsRect) { nDstX, nDstY, (uint16_t)w, (uint16_t)h };
+  if (!gslc_ClipRect(&pDriver->rClipRect,&rImg)) { return; }
+  if ((rImg.w != (uint16_t)w) || (rImg.h != (uint16_t)h)) {
+    int16_t nCol0 = rImg.x - nDstX;
+    int16_t nRow0 = rImg.y - nDstY;
+    for (int16_t nRow = 0; nRow < (int16_t)rImg.h; nRow++) {
+      const uint16_t* pRow = pImage + ((int32_t)(nRow0 + nRow) * w) + nCol0;
+      #if (GSLC_BMP_TRANS_EN)
+        uint16_t nTransRaw = gslc_DrvAdaptColorToRaw(pGui->sTransCol);
+        if (bProgMem) {
+          m_disp.pushImage(rImg.x, rImg.y + nRow, rImg.w, 1, pRow, nTransRaw);
+        } else {
+          m_disp.pushImage(rImg.x, rImg.y + nRow, rImg.w, 1, (uint16_t*) pRow, nTransRaw);
+        }
+      #else
+        if (bProgMem) {
+          m_disp.pushImage(rImg.x, rImg.y + nRow, rImg.w, 1, pRow);
+        } else {
+          m_disp.pushImage(rImg.x, rImg.y + nRow, rImg.w, 1, (uint16_t*) pRow);
+        }
+      #endif
+    }
+    return;
+  }
+  #endif // GSLC_CLIP_EN
+
   #if (GSLC_BMP_TRANS_EN)
     uint16_t nTransRaw = gslc_DrvAdaptColorToRaw(pGui->sTransCol);
     if (bProgMem) {
@@ -818,161 +834,148 @@ void gslc_DrvDrawBmp24FromMem(gslc_tsGui* pGui,int16_t nDstX, int16_t nDstY,cons
   #endif // GSLC_BMP_TRANS_EN
 }
 
-#if (GSLC_SD_EN)
-// ----- REFERENCE CODE begin
-// The following code was based upon the following reference code but modified to
-// adapt for use in GUIslice.
-//
-//   URL:              https://github.com/adafruit/Adafruit_ILI9341/blob/master/examples/spitftbitmap/spitftbitmap.ino
-//   Original author:  Adafruit
-//   Function:         bmpDraw()
-
-// These read 16- and 32-bit types from the SD card file.
-// BMP data is stored little-endian, Arduino is little-endian too.
-// May need to reverse subscript order if porting elsewhere.
-uint16_t gslc_DrvRead16SD(fs::File &f) {
-  uint16_t result;
-  ((uint8_t *)&result)[0] = f.read(); // LSB
-  ((uint8_t *)&result)[1] = f.read(); // MSB
-  return result;
+// Convert an RGB565 image word to the display's color mode
+inline uint16_t gslc_DrvAdaptRgb565ToRaw(uint16_t nCol565)
+{
+  #if defined(DRV_COLORMODE_MONO) || defined(DRV_COLORMODE_BGR565)
+  gslc_tsColor nCol;
+  nCol.r = (uint8_t)((nCol565 >> 8) & 0xF8);
+  nCol.g = (uint8_t)((nCol565 >> 3) & 0xFC);
+  nCol.b = (uint8_t)((nCol565 << 3) & 0xF8);
+  return gslc_DrvAdaptColorToRaw(nCol);
+  #else
+  return nCol565;
+  #endif // DRV_COLORMODE_*
 }
 
-uint32_t gslc_DrvRead32SD(fs::File &f) {
-  uint32_t result;
-  ((uint8_t *)&result)[0] = f.read(); // LSB
-  ((uint8_t *)&result)[1] = f.read();
-  ((uint8_t *)&result)[2] = f.read();
-  ((uint8_t *)&result)[3] = f.read(); // MSB
-  return result;
+void gslc_DrvDrawRle16FromMem(gslc_tsGui* pGui,int16_t nDstX, int16_t nDstY,const unsigned char* pBitmap,bool bProgMem)
+{
+  const uint16_t* pImage = (const uint16_t*)pBitmap;
+  uint16_t  anSpan[DRV_RLE16_SPAN_PX_MAX];  // Opaque span buffer
+  uint16_t  nSpanLen = 0;
+  int16_t   nSpanX = 0;
+  int16_t   h, w, row, col, nInd, nVis0, nVis1;
+  uint16_t  nCode, nRun;
+  uint16_t  nColRaw = 0;
+  (void)bProgMem; // Flash is directly addressable
+
+  h = *(pImage++);
+  w = *(pImage++);
+  pImage++; // Skip run word count
+  #if defined(DBG_DRIVER)
+  GSLC_DEBUG_PRINT("DBG: DrvDrawRle16FromMem() w=%d h=%d\n", w, h);
+  #endif
+
+  // Determine the portion of the image within the clipping region
+  int16_t nRow0 = 0;
+  int16_t nRow1 = h;
+  int16_t nCol0 = 0;
+  int16_t nCol1 = w;
+  #if (GSLC_CLIP_EN)
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  gslc_tsRect rImg = (gslc_tsRect) { nDstX, nDstY, (uint16_t)w, (uint16_t)h };
+  if (!gslc_ClipRect(&pDriver->rClipRect,&rImg)) { return; }
+  nCol0 = rImg.x - nDstX;
+  nRow0 = rImg.y - nDstY;
+  nCol1 = nCol0 + rImg.w;
+  nRow1 = nRow0 + rImg.h;
+  #endif
+
+  // Decode the runs of each row, collecting adjacent opaque pixels
+  // into spans that are each pushed with a single block write.
+  // Rows above the clipping region are only parsed.
+  for (row=0; row<nRow1; row++) {
+    col = 0;
+    while (col < w) {
+      nCode = *(pImage++);
+      nRun  = nCode & GSLC_IMG_RLE16_LEN;
+      if (nRun == 0) {
+        break; // Malformed run
+      }
+      if ((nCode & GSLC_IMG_RLE16_TYPE) == GSLC_IMG_RLE16_SKIP) {
+        // Transparent run ends the current span
+        if (nSpanLen > 0) {
+          gslc_DrvDrawRawBlock(pGui,nDstX+nSpanX,nDstY+row,anSpan,nSpanLen,1,false,0);
+          nSpanLen = 0;
+        }
+        col += nRun;
+        continue;
+      }
+      if ((nCode & GSLC_IMG_RLE16_TYPE) == GSLC_IMG_RLE16_FILL) {
+        nColRaw = gslc_DrvAdaptRgb565ToRaw(*(pImage));
+      }
+      if (row >= nRow0) {
+        // Append the visible portion of the run to the span
+        nVis0 = (col > nCol0) ? col : nCol0;
+        nVis1 = (col + nRun < nCol1) ? col + nRun : nCol1;
+        for (nInd=nVis0; nInd<nVis1; nInd++) {
+          if ((nCode & GSLC_IMG_RLE16_TYPE) == GSLC_IMG_RLE16_COPY) {
+            nColRaw = gslc_DrvAdaptRgb565ToRaw(*(pImage + (nInd - col)));
+          }
+          if (nSpanLen == 0) {
+            nSpanX = nInd;
+          }
+          anSpan[nSpanLen++] = nColRaw;
+          if (nSpanLen == DRV_RLE16_SPAN_PX_MAX) {
+            gslc_DrvDrawRawBlock(pGui,nDstX+nSpanX,nDstY+row,anSpan,nSpanLen,1,false,0);
+            nSpanLen = 0;
+          }
+        }
+      }
+      pImage += ((nCode & GSLC_IMG_RLE16_TYPE) == GSLC_IMG_RLE16_FILL) ? 1 : nRun;
+      col    += nRun;
+    }
+    // End of row ends the current span
+    if (nSpanLen > 0) {
+      gslc_DrvDrawRawBlock(pGui,nDstX+nSpanX,nDstY+row,anSpan,nSpanLen,1,false,0);
+      nSpanLen = 0;
+    }
+  }
 }
 
-void gslc_DrvDrawBmp24FromSD(gslc_tsGui* pGui,const char *filename, uint16_t x, uint16_t y)
+void gslc_DrvDrawRawBlock(gslc_tsGui* pGui,int16_t nDstX,int16_t nDstY,uint16_t* pPix,
+  uint16_t nW,uint16_t nH,bool bTrans,uint16_t nTransRaw)
 {
-  File     bmpFile;
-  int      bmpWidth, bmpHeight;   // W+H in pixels
-  uint8_t  bmpDepth;              // Bit depth (currently must be 24)
-  uint32_t bmpImageoffset;        // Start of image data in file
-  uint32_t rowSize;               // Not always = bmpWidth; may have padding
-  uint8_t  sdbuffer[3*GSLC_SD_BUFFPIXEL]; // pixel buffer (R+G+B per pixel)
-  uint8_t  buffidx = sizeof(sdbuffer); // Current position in sdbuffer
-  boolean  goodBmp = false;       // Set to true on valid header parse
-  boolean  flip    = true;        // BMP is stored bottom-to-top
-  int      w, h, row, col;
-  uint8_t  r, g, b;
-  uint32_t pos = 0, startTime = millis();
-  (void)startTime; // Unused
-
-  if((x >= pGui->nDispW) || (y >= pGui->nDispH)) return;
-
-  //Serial.println();
-  //Serial.print("Loading image '");
-  //Serial.print(filename);
-  //Serial.println('\'');
-
-  // Open requested file on SD card
-  if ((bmpFile = SD.open(filename)) == 0) {
-    GSLC_DEBUG2_PRINT("ERROR: DrvDrawBmp24FromSD() file not found [%s]",filename);
-    return;
+  (void)pGui; // Unused
+  // The pixels are native-endian RGB565
+  m_disp.setSwapBytes(true);
+  if (bTrans) {
+    m_disp.pushImage(nDstX, nDstY, nW, nH, pPix, nTransRaw);
+  } else {
+    m_disp.pushImage(nDstX, nDstY, nW, nH, pPix);
   }
-  // Parse BMP header
-  if(gslc_DrvRead16SD(bmpFile) == 0x4D42) { // BMP signature
-    uint32_t nFileSize = gslc_DrvRead32SD(bmpFile);
-    (void)nFileSize; // Unused
-    //Serial.print("File size: "); Serial.println(nFileSize);
-    (void)gslc_DrvRead32SD(bmpFile); // Read & ignore creator bytes
-    bmpImageoffset = gslc_DrvRead32SD(bmpFile); // Start of image data
-    //Serial.print("Image Offset: "); Serial.println(bmpImageoffset, DEC);
-    // Read DIB header
-    uint32_t nHdrSize = gslc_DrvRead32SD(bmpFile);
-    (void)nHdrSize; // Unused
-    //Serial.print("Header size: "); Serial.println(nHdrSize);
-    bmpWidth  = gslc_DrvRead32SD(bmpFile);
-    bmpHeight = gslc_DrvRead32SD(bmpFile);
-    if(gslc_DrvRead16SD(bmpFile) == 1) { // # planes -- must be '1'
-      bmpDepth = gslc_DrvRead16SD(bmpFile); // bits per pixel
-      //Serial.print("Bit Depth: "); Serial.println(bmpDepth);
-      if((bmpDepth == 24) && (gslc_DrvRead32SD(bmpFile) == 0)) { // 0 = uncompressed
-        goodBmp = true; // Supported BMP format -- proceed!
-        //Serial.print("Image size: ");
-        //Serial.print(bmpWidth);
-        //Serial.print('x');
-        //Serial.println(bmpHeight);
-
-        // BMP rows are padded (if needed) to 4-byte boundary
-        rowSize = (bmpWidth * 3 + 3) & ~3;
-
-        // If bmpHeight is negative, image is in top-down order.
-        // This is not canon but has been observed in the wild.
-        if(bmpHeight < 0) {
-          bmpHeight = -bmpHeight;
-          flip      = false;
-        }
-
-        // Crop area to be loaded
-        w = bmpWidth;
-        h = bmpHeight;
-        if((x+w-1) >= pGui->nDispW) w = pGui->nDispW  - x;
-        if((y+h-1) >= pGui->nDispH) h = pGui->nDispH - y;
-
-        // Set TFT address window to clipped image bounds
-        //xxx tft.setAddrWindow(x, y, x+w-1, y+h-1);
-
-        for (row=0; row<h; row++) { // For each scanline...
-
-          // Seek to start of scan line.  It might seem labor-
-          // intensive to be doing this on every line, but this
-          // method covers a lot of gritty details like cropping
-          // and scanline padding.  Also, the seek only takes
-          // place if the file position actually needs to change
-          // (avoids a lot of cluster math in SD library).
-          if(flip) // Bitmap is stored bottom-to-top order (normal BMP)
-            pos = bmpImageoffset + (bmpHeight - 1 - row) * rowSize;
-          else     // Bitmap is stored top-to-bottom
-            pos = bmpImageoffset + row * rowSize;
-          if(bmpFile.position() != pos) { // Need seek?
-            bmpFile.seek(pos);
-            buffidx = sizeof(sdbuffer); // Force buffer reload
-          }
+}
 
-          for (col=0; col<w; col++) { // For each pixel...
-            // Time to read more pixel data?
-            if (buffidx >= sizeof(sdbuffer)) { // Indeed
-              bmpFile.read(sdbuffer, sizeof(sdbuffer));
-              buffidx = 0; // Set index to beginning
-            }
-
-            // Convert pixel from BMP to TFT format, push to display
-            b = sdbuffer[buffidx++];
-            g = sdbuffer[buffidx++];
-            r = sdbuffer[buffidx++];
-            //xxx tft.pushColor(tft.Color565(r,g,b));
-            gslc_tsColor nCol = (gslc_tsColor){r,g,b};
-            bool bDrawBit = true;
-            if (GSLC_BMP_TRANS_EN) {
-              gslc_tsColor nColTrans = pGui->sTransCol;
-              if ((nCol.r == nColTrans.r) && (nCol.g == nColTrans.g) && (nCol.b == nColTrans.b)) {
-                bDrawBit = false;
-              }
-            }
-            if (bDrawBit) {
-              gslc_DrvDrawPoint(pGui,x+col,y+row,nCol);
-            }
-
-          } // end pixel
-        } // end scanline
-        //Serial.print("Loaded in ");
-        //Serial.print(millis() - startTime);
-        //Serial.println(" ms");
-      } // end goodBmp
-    }
+#if (DRV_HAS_IMG_CACHE)
+void gslc_DrvDrawImgCache(gslc_tsGui* pGui,int16_t nDstX,int16_t nDstY,gslc_tsImgCacheEntry* pEntry)
+{
+  // Determine the portion of the image within the clipping region
+  int16_t nRow0 = 0;
+  int16_t nRow1 = pEntry->nH;
+  int16_t nCol0 = 0;
+  int16_t nCol1 = pEntry->nW;
+  #if (GSLC_CLIP_EN)
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  gslc_tsRect rImg = (gslc_tsRect) { nDstX, nDstY, pEntry->nW, pEntry->nH };
+  if (!gslc_ClipRect(&pDriver->rClipRect,&rImg)) { return; }
+  nCol0 = rImg.x - nDstX;
+  nRow0 = rImg.y - nDstY;
+  nCol1 = nCol0 + rImg.w;
+  nRow1 = nRow0 + rImg.h;
+  #endif
+  if ((nCol0 == 0) && (nCol1 == pEntry->nW)) {
+    // Whole rows are visible, so push them as a single block
+    gslc_DrvDrawRawBlock(pGui, nDstX, nDstY + nRow0, pEntry->pPix + ((int32_t)nRow0 * pEntry->nW),
+      pEntry->nW, nRow1 - nRow0, pEntry->bTrans, pEntry->nTransRaw);
+    return;
   }
-  bmpFile.close();
-  if(!goodBmp) {
-    GSLC_DEBUG2_PRINT("ERROR: DrvDrawBmp24FromSD() BMP format unknown [%s]",filename);
+  // Otherwise push the visible portion of each row
+  for (int16_t row = nRow0; row < nRow1; row++) {
+    gslc_DrvDrawRawBlock(pGui, nDstX + nCol0, nDstY + row, pEntry->pPix + ((int32_t)row * pEntry->nW) + nCol0,
+      nCol1 - nCol0, 1, pEntry->bTrans, pEntry->nTransRaw);
   }
 }
-// ----- REFERENCE CODE end
-#endif // GSLC_SD_EN
+#endif // DRV_HAS_IMG_CACHE
 
 
 bool gslc_DrvDrawImage(gslc_tsGui* pGui,int16_t nDstX,int16_t nDstY,gslc_tsImgRef sImgRef)
@@ -1015,6 +1018,10 @@ bool gslc_DrvDrawImage(gslc_tsGui* pGui,int16_t nDstX,int16_t nDstY,gslc_tsImgRe
       // 24-bit Bitmap in ram
       gslc_DrvDrawBmp24FromMem(pGui,nDstX,nDstY,sImgRef.pImgBuf,false);
       return true;
+    } else if ((sImgRef.eImgFlags & GSLC_IMGREF_FMT) == GSLC_IMGREF_FMT_RLE16) {
+      // Run-length encoded RGB565 image in ram
+      gslc_DrvDrawRle16FromMem(pGui,nDstX,nDstY,sImgRef.pImgBuf,false);
+      return true;
     } else {
       return false; // TODO: not yet supported
     }
@@ -1031,6 +1038,10 @@ bool gslc_DrvDrawImage(gslc_tsGui* pGui,int16_t nDstX,int16_t nDstY,gslc_tsImgRe
       // 24-bit Bitmap in flash
       gslc_DrvDrawBmp24FromMem(pGui,nDstX,nDstY,sImgRef.pImgBuf,true);
       return true;
+    } else if ((sImgRef.eImgFlags & GSLC_IMGREF_FMT) == GSLC_IMGREF_FMT_RLE16) {
+      // Run-length encoded RGB565 image in flash
+      gslc_DrvDrawRle16FromMem(pGui,nDstX,nDstY,sImgRef.pImgBuf,true);
+      return true;
     } else {
       return false; // TODO: not yet supported
     }
@@ -1038,8 +1049,21 @@ bool gslc_DrvDrawImage(gslc_tsGui* pGui,int16_t nDstX,int16_t nDstY,gslc_tsImgRe
   } else if ((sImgRef.eImgFlags & GSLC_IMGREF_SRC) == GSLC_IMGREF_SRC_SD) {
     // Load image from SD media
     #if (GSLC_SD_EN)
-      if ((sImgRef.eImgFlags & GSLC_IMGREF_FMT) == GSLC_IMGREF_FMT_BMP24) {
-        // 24-bit Bitmap
+      if (((sImgRef.eImgFlags & GSLC_IMGREF_FMT) == GSLC_IMGREF_FMT_BMP24) ||
+          ((sImgRef.eImgFlags & GSLC_IMGREF_FMT) == GSLC_IMGREF_FMT_BMP16)) {
+        // 24-bit or 16-bit Bitmap
+        #if (DRV_HAS_IMG_CACHE)
+        // Draw from the decoded image cache, decoding the file into
+        // the cache first if it isn't present
+        gslc_tsImgCacheEntry* pEntry = gslc_ImgCacheFind(pGui,sImgRef);
+        if (pEntry == NULL) {
+          pEntry = gslc_DrvCacheBmpFromSD(pGui,sImgRef);
+        }
+        if (pEntry != NULL) {
+          gslc_DrvDrawImgCache(pGui,nDstX,nDstY,pEntry);
+          return true;
+        }
+        #endif // DRV_HAS_IMG_CACHE
         gslc_DrvDrawBmp24FromSD(pGui,sImgRef.pFname,nDstX,nDstY);
         return true;
       } else {
@@ -1112,7 +1136,10 @@ void gslc_DrvDrawBkgnd(gslc_tsGui* pGui)
       //       we may be redrawing the page with a clipping
       //       region enabled, it is important that we don't
       //       redraw the entire screen.
+      // - Limit the fill to the current clipping region so that
+      //   a partial redraw only repaints the exposed background
       gslc_tsRect rRect = (gslc_tsRect) { 0, 0, pGui->nDispW, pGui->nDispH };
+      if (!gslc_ClipRect(&pDriver->rClipRect,&rRect)) { return; }
       gslc_DrvDrawFillRect(pGui, rRect, pDriver->nColBkgnd);
     } else {
       // An image should be loaded
@@ -139,6 +139,58 @@ extern "C" {
 #define DRV_HAS_DRAW_BMP_MEM           0 ///< Support gslc_DrvDrawBmp24FromMem()
 
 #define DRV_OVERRIDE_TXT_ALIGN         1 ///< Driver provides text alignment
+#define DRV_HAS_DRAW_TXT_CLIP          0 ///< gslc_DrvDrawTxt() clips to the clipping region
+
+// -----------------------------------------------------------------------
+// Glyph buffer text rendering
+// - Fonts assigned DRV_FONTREF_MODE_GLYPHBUF via gslc_FontSetMode()
+//   are expanded by GUIslice into a local pixel buffer and pushed
+//   to the display with pushImage(), rather than being drawn by the
+//   library's free font renderer
+// - Only Adafruit-GFX fonts (GFXfont) referenced by pointer are
+//   supported. Other fonts and transparent text (text color equals
+//   background color) continue to use the library renderer
+// - DRV_GLYPHBUF_PX_MAX defines the buffer size in pixels (allocated
+//   on the stack). Each text row is pushed in tiles of at most this size
+// -----------------------------------------------------------------------
+#define DRV_HAS_DRAW_TXT_GLYPHBUF      1 ///< Support gslc_DrvDrawTxtGlyphBuf()
+
+#define DRV_FONTREF_MODE_GLYPHBUF      GSLC_FONTREF_MODE_2 ///< Font mode to render via glyph buffer
+
+#if !defined(DRV_GLYPHBUF_PX_MAX)
+  #define DRV_GLYPHBUF_PX_MAX          256 ///< Glyph buffer size (pixels)
+#endif
+
+// -----------------------------------------------------------------------
+// Decoded image cache
+// - With GSLC_FEATURE_IMG_CACHE, BMP images on SD card are decoded
+//   once into the GUIslice image cache and then drawn from it with
+//   pushImage(), instead of being parsed and converted from the file
+//   on every draw
+// - JPEG and BMP images in SPIFFS are decoded by TFT_eFEX directly
+//   to the display and are not cached
+// -----------------------------------------------------------------------
+#if (GSLC_FEATURE_IMG_CACHE)
+  #define DRV_HAS_IMG_CACHE            1 ///< Support gslc_DrvDrawImgCache()
+#else
+  #define DRV_HAS_IMG_CACHE            0 ///< Support gslc_DrvDrawImgCache()
+#endif
+
+// -----------------------------------------------------------------------
+// Run-length encoded images (GSLC_IMGREF_FMT_RLE16)
+// - Adjacent opaque pixels are expanded into a local span buffer and
+//   pushed to the display with pushImage(), one window per span
+// - DRV_RLE16_SPAN_PX_MAX defines the span buffer size in pixels
+//   (allocated on the stack). Longer spans are pushed in pieces
+// -----------------------------------------------------------------------
+#if !defined(DRV_RLE16_SPAN_PX_MAX)
+  #if defined(__AVR__)
+    #define DRV_RLE16_SPAN_PX_MAX      32 ///< RLE16 span buffer size (pixels)
+  #else
+    #define DRV_RLE16_SPAN_PX_MAX      128 ///< RLE16 span buffer size (pixels)
+  #endif
+#endif
+
 
 // =======================================================================
 // Driver-specific members
@@ -607,38 +659,72 @@ bool gslc_DrvDrawImage(gslc_tsGui* pGui,int16_t nDstX,int16_t nDstY,gslc_tsImgRe
 
 
 ///
-/// Draw a monochrome bitmap from a memory array
-/// - Draw from the bitmap buffer using the foreground color
-///   defined in the header (unset bits are transparent)
+/// Draw a color 24-bit depth bitmap from a memory array
+/// - Note that users must convert images from their native
+///   format (eg. BMP, PNG, etc.) into a C array. Please
+///   refer to the following guide for details:
+///   https://github.com/ImpulseAdventure/GUIslice/wiki/Display-Images-from-FLASH
+/// - The converted file (c array) can then be included in the sketch.
 ///
 /// \param[in]  pGui:        Pointer to GUI
-/// \param[in]  nDstX:       Destination X coord for copy
-/// \param[in]  nDstY:       Destination Y coord for copy
+/// \param[in]  nDstX:       X coord for copy
+/// \param[in]  nDstY:       Y coord for copy
 /// \param[in]  pBitmap:     Pointer to bitmap buffer
 /// \param[in]  bProgMem:    Bitmap is stored in Flash if true, RAM otherwise
 ///
 /// \return none
 ///
-void gslc_DrvDrawMonoFromMem(gslc_tsGui* pGui,int16_t nDstX, int16_t nDstY, const unsigned char *pBitmap,bool bProgMem);
+void gslc_DrvDrawBmp24FromMem(gslc_tsGui* pGui,int16_t nDstX, int16_t nDstY,const unsigned char* pBitmap,bool bProgMem);
 
+///
+/// Draw a run-length encoded RGB565 image (GSLC_IMGREF_FMT_RLE16)
+/// from a memory array
+/// - Transparent runs are skipped and opaque pixels are pushed
+///   as spans. The image is clipped to the clipping region.
+/// - Arrays are generated from BMP files with tools/img2rle16
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nDstX:       X coord for copy
+/// \param[in]  nDstY:       Y coord for copy
+/// \param[in]  pBitmap:     Pointer to image array
+/// \param[in]  bProgMem:    Image is stored in Flash if true, RAM otherwise
+///
+/// \return none
+///
+void gslc_DrvDrawRle16FromMem(gslc_tsGui* pGui,int16_t nDstX, int16_t nDstY,const unsigned char* pBitmap,bool bProgMem);
 
 ///
-/// Draw a color 24-bit depth bitmap from a memory array
-/// - Note that users must convert images from their native
-///   format (eg. BMP, PNG, etc.) into a C array. Please
-///   refer to the following guide for details:
-///   https://github.com/ImpulseAdventure/GUIslice/wiki/Display-Images-from-FLASH
-/// - The converted file (c array) can then be included in the sketch.
+/// Push a block of pixels in display format to the display
+/// - Transparent pixels are skipped when bTrans is set
 ///
 /// \param[in]  pGui:        Pointer to GUI
 /// \param[in]  nDstX:       X coord for copy
 /// \param[in]  nDstY:       Y coord for copy
-/// \param[in]  pBitmap:     Pointer to bitmap buffer
-/// \param[in]  bProgMem:    Bitmap is stored in Flash if true, RAM otherwise
+/// \param[in]  pPix:        Pointer to pixel buffer (nW*nH pixels)
+/// \param[in]  nW:          Width of block
+/// \param[in]  nH:          Height of block
+/// \param[in]  bTrans:      Transparent pixels are enabled
+/// \param[in]  nTransRaw:   Transparent color in display format
 ///
 /// \return none
 ///
-void gslc_DrvDrawBmp24FromMem(gslc_tsGui* pGui,int16_t nDstX, int16_t nDstY,const unsigned char* pBitmap,bool bProgMem);
+void gslc_DrvDrawRawBlock(gslc_tsGui* pGui,int16_t nDstX,int16_t nDstY,uint16_t* pPix,
+  uint16_t nW,uint16_t nH,bool bTrans,uint16_t nTransRaw);
+
+#if (DRV_HAS_IMG_CACHE)
+///
+/// Draw an image from the decoded image cache
+/// - Honors the clipping region and transparent pixels
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nDstX:       X coord for copy
+/// \param[in]  nDstY:       Y coord for copy
+/// \param[in]  pEntry:      Pointer to cache entry
+///
+/// \return none
+///
+void gslc_DrvDrawImgCache(gslc_tsGui* pGui,int16_t nDstX,int16_t nDstY,gslc_tsImgCacheEntry* pEntry);
+#endif // DRV_HAS_IMG_CACHE
 
 #if (GSLC_SPIFFS_EN)
 ///
@@ -779,6 +865,9 @@ bool gslc_DrvRotate(gslc_tsGui* pGui, uint8_t nRotation);
 
 uint16_t gslc_DrvAdaptColorToRaw(gslc_tsColor nCol);
 
+// Routines shared with other drivers (eg. glyph buffer text rendering)
+#include "GUIslice_drv_common.h"
+
 #ifdef __cplusplus
 }
 #endif // __cplusplus
@@ -120,6 +120,7 @@ gslc_tsElemRef* gslc_ElemXGlowballCreate(gslc_tsGui* pGui, int16_t nElemId, int1
   pXData->nMidY = nMidY;
   pXData->colBg = GSLC_COL_BLACK;
   pXData->nValLast = 0;
+  gslc_PolarCacheInit(&pXData->sPolarCache, NULL, 0);
 
 
   sElem.pXData            = (void*)(pXData);
@@ -146,30 +147,8 @@ gslc_tsElemRef* gslc_ElemXGlowballCreate(gslc_tsGui* pGui, int16_t nElemId, int1
 
 void drawXGlowballArc(gslc_tsGui* pGui, gslc_tsXGlowball* pGlowball, int16_t nMidX, int16_t nMidY, int16_t nRad1, int16_t nRad2, gslc_tsColor cArc, uint16_t nAngStart, uint16_t nAngEnd)
 {
-  gslc_tsPt anPts[4];
-  // TODO: Cleanup
-  int16_t nStep64 = 64*360 / pGlowball->nQuality;
-  int16_t nAng64;
-  int16_t nX, nY;
-  int16_t nSegStart, nSegEnd;
-  nSegStart = nAngStart * pGlowball->nQuality / 360;
-  nSegEnd = nAngEnd * pGlowball->nQuality / 360;
-
-  for (int16_t nSegInd = nSegStart; nSegInd < nSegEnd; nSegInd++) {
-    nAng64 = nSegInd * nStep64;
-    nAng64 = nAng64 % (360 * 64);
-
-    gslc_PolarToXY(nRad1, nAng64, &nX, &nY);
-    anPts[0] = (gslc_tsPt) { nMidX + nX, nMidY + nY };
-    gslc_PolarToXY(nRad2, nAng64, &nX, &nY);
-    anPts[1] = (gslc_tsPt) { nMidX + nX, nMidY + nY };
-    gslc_PolarToXY(nRad2, nAng64 + nStep64, &nX, &nY);
-    anPts[2] = (gslc_tsPt) { nMidX + nX, nMidY + nY };
-    gslc_PolarToXY(nRad1, nAng64 + nStep64, &nX, &nY);
-    anPts[3] = (gslc_tsPt) { nMidX + nX, nMidY + nY };
-
-    gslc_DrawFillQuad(pGui, anPts, cArc);
-  }
+  gslc_DrawFillSectorBase(pGui, pGlowball->nQuality, nMidX, nMidY, nRad1, nRad2, cArc, cArc, false,
+    0, 0, nAngStart, nAngEnd, &pGlowball->sPolarCache);
 }
 
 
@@ -260,6 +239,7 @@ void gslc_ElemXGlowballSetQuality(gslc_tsGui* pGui, gslc_tsElemRef* pElemRef, ui
 
   // Update the rendering quality setting
   pGlowball->nQuality = nQuality;
+  gslc_PolarCacheReset(&pGlowball->sPolarCache);
 
   // Mark for redraw
   // - Force full redraw
@@ -284,6 +264,19 @@ void gslc_ElemXGlowballSetColorBack(gslc_tsGui* pGui, gslc_tsElemRef* pElemRef,
   gslc_ElemSetRedraw(pGui,pElemRef,GSLC_REDRAW_FULL);
 }
 
+void gslc_ElemXGlowballSetPolarCache(gslc_tsGui* pGui, gslc_tsElemRef* pElemRef, gslc_tsPt* asPt, uint16_t nPtMax)
+{
+  if ((pGui == NULL) || (pElemRef == NULL)) {
+    static const char GSLC_PMEM FUNCSTR[] = "ElemXGlowballSetPolarCache";
+    GSLC_DEBUG2_PRINT_CONST(ERRSTR_NULL,FUNCSTR);
+    return;
+  }
+  gslc_tsElem*      pElem = gslc_GetElemFromRef(pGui,pElemRef);
+  gslc_tsXGlowball* pGlowball = (gslc_tsXGlowball*)(pElem->pXData);
+
+  gslc_PolarCacheInit(&pGlowball->sPolarCache, asPt, nPtMax);
+}
+
 // Redraw the element
 // - Note that this redraw is for the entire element rect region
 // - The Draw function parameters use void pointers to allow for
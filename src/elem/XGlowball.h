@@ -60,6 +60,11 @@ typedef struct {
 // - These data structures are maintained in the gslc_tsElem
 //   structure via the pXData pointer
 
+/// Number of points required by gslc_ElemXGlowballSetPolarCache()
+/// to cache the vertices of all rings at the given quality setting
+/// - Rings that share a radius with a neighboring ring require fewer points
+#define XGLOWBALL_POLAR_CACHE_PTS(nQuality,nNumRings) (2*(nNumRings)*(nQuality))
+
 /// Extended data for Slider element
 typedef struct {
   // Config
@@ -75,6 +80,7 @@ typedef struct {
   // State
   int16_t               nVal;           ///< Current value
   int16_t               nValLast;       ///< Previous value
+  gslc_tsPolarCache     sPolarCache;    ///< Cache of ring vertices
   // Callbacks
 } gslc_tsXGlowball;
 
@@ -119,6 +125,23 @@ void gslc_ElemXGlowballSetVal(gslc_tsGui* pGui, gslc_tsElemRef* pElemRef, int16_
 void gslc_ElemXGlowballSetQuality(gslc_tsGui* pGui, gslc_tsElemRef* pElemRef, uint16_t nQuality);
 void gslc_ElemXGlowballSetColorBack(gslc_tsGui* pGui, gslc_tsElemRef* pElemRef, gslc_tsColor colBg);
 
+///
+/// Assign a buffer used to cache the vertices of the rings, avoiding the
+/// recalculation of the vertices during each redraw
+/// - Each distinct ring radius (up to GSLC_POLAR_CACHE_RAD_MAX) consumes
+///   nQuality points. Radii that don't fit in the buffer are calculated
+///   during each redraw instead.
+/// - By default no buffer is assigned
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  pElemRef:    Pointer to Element reference
+/// \param[in]  asPt:        Buffer of points (or NULL to disable caching)
+/// \param[in]  nPtMax:      Maximum number of points in asPt
+///
+/// \return none
+///
+void gslc_ElemXGlowballSetPolarCache(gslc_tsGui* pGui, gslc_tsElemRef* pElemRef, gslc_tsPt* asPt, uint16_t nPtMax);
+
 // ============================================================================
 
 // ------------------------------------------------------------------------
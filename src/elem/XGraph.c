@@ -372,13 +372,15 @@ bool gslc_ElemXGraphDraw(void* pvGui,void* pvElemRef,gslc_teRedrawType eRedraw)
 
     // Render the datapoints
     if (pBox->eStyle == GSLCX_GRAPH_STYLE_DOT) {
-      gslc_DrawSetPixel(pGui,nPixX,nPixY,colGraph);
+      gslc_DrawPointBatch(pGui,nPixX,nPixY,colGraph);
     } else if (pBox->eStyle == GSLCX_GRAPH_STYLE_LINE) {
     } else if (pBox->eStyle == GSLCX_GRAPH_STYLE_FILL) {
       gslc_DrawLine(pGui,nPixX,nPixYBase,nPixX,nPixY,colGraph);
     }
 
   }
+  // Draw any remaining dots
+  gslc_DrawPointBatchFlush(pGui);
 
   // Clear the redraw flag
   gslc_ElemSetRedraw(pGui,pElemRef,GSLC_REDRAW_NONE);
@@ -275,6 +275,7 @@ void gslc_ElemXRadialDrawRadialHelp(gslc_tsGui* pGui,int16_t nX,int16_t nY,uint1
 
   } else {
     // Filled
+#if (DRV_HAS_DRAW_TRI_FILL)
     gslc_tsPt asPt[4];
 
     // Main body of pointer
@@ -289,6 +290,18 @@ void gslc_ElemXRadialDrawRadialHelp(gslc_tsGui* pGui,int16_t nX,int16_t nY,uint1
     asPt[1] = (gslc_tsPt){nX+nTipX,nY+nTipY};
     asPt[2] = (gslc_tsPt){nX+nBaseX2+nTipBaseX,nY+nBaseY2+nTipBaseY};
     gslc_DrawFillTriangle(pGui,asPt[0].x,asPt[0].y,asPt[1].x,asPt[1].y,asPt[2].x,asPt[2].y,colFrame);
+#else
+    // - Without a driver triangle fill, the main body and tip of the
+    //   pointer are filled together as a single polygon, including
+    //   its edges
+    gslc_tsPt asPt[5];
+    asPt[0] = (gslc_tsPt){nX+nBaseX1,nY+nBaseY1};
+    asPt[1] = (gslc_tsPt){nX+nBaseX1+nTipBaseX,nY+nBaseY1+nTipBaseY};
+    asPt[2] = (gslc_tsPt){nX+nTipX,nY+nTipY};
+    asPt[3] = (gslc_tsPt){nX+nBaseX2+nTipBaseX,nY+nBaseY2+nTipBaseY};
+    asPt[4] = (gslc_tsPt){nX+nBaseX2,nY+nBaseY2};
+    gslc_DrawFillPolygonBase(pGui,asPt,5,colFrame,true);
+#endif // DRV_HAS_DRAW_TRI_FILL
 
   }
 
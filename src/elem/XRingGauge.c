@@ -113,6 +113,7 @@ gslc_tsElemRef* gslc_ElemXRingGaugeCreate(gslc_tsGui* pGui, int16_t nElemId, int
   pXData->nVal = 0;
   pXData->nValLast = 0;
   pXData->acStrLast[0] = 0;
+  gslc_PolarCacheInit(&pXData->sPolarCache, NULL, 0);
 
 
   sElem.pXData            = (void*)(pXData);
@@ -238,14 +239,14 @@ bool gslc_ElemXRingGaugeDraw(void* pvGui, void* pvElemRef, gslc_teRedrawType eRe
       #if defined(DBG_REDRAW)
       GSLC_DEBUG2_PRINT("RingDraw:   ActiveG  start=%d end=%d astart=%d arange=%d\n", nDrawStart, nDrawVal,nAngStart,nAngRange);
       #endif
-      gslc_DrawFillGradSector(pGui, nQuality, nMidX, nMidY,
-        nRad1, nRad2, colRingActive1, colRingActive2, nDrawStart, nDrawVal, nAngStart, nAngRange);
+      gslc_DrawFillSectorBase(pGui, nQuality, nMidX, nMidY, nRad1, nRad2, colRingActive1, colRingActive2, true,
+        nAngStart, nAngRange, nDrawStart, nDrawVal, &pXRingGauge->sPolarCache);
     } else {
       #if defined(DBG_REDRAW)
       GSLC_DEBUG2_PRINT("RingDraw:   Active   start=%d end=%d\n", nDrawStart, nDrawVal);
       #endif
-      gslc_DrawFillSector(pGui, nQuality, nMidX, nMidY,
-        nRad1, nRad2, colRingActive1, nDrawStart, nDrawVal);
+      gslc_DrawFillSectorBase(pGui, nQuality, nMidX, nMidY, nRad1, nRad2, colRingActive1, colRingActive1, false,
+        0, 0, nDrawStart, nDrawVal, &pXRingGauge->sPolarCache);
     }
   }
 
@@ -254,8 +255,8 @@ bool gslc_ElemXRingGaugeDraw(void* pvGui, void* pvElemRef, gslc_teRedrawType eRe
     GSLC_DEBUG2_PRINT("RingDraw:   Inactive start=%d end=%d\n", nDrawEnd, nDrawVal);
     #endif
     // Since we are erasing, we will reverse the redraw direction (swap Val & End)
-    gslc_DrawFillSector(pGui, nQuality, nMidX, nMidY,
-      nRad1, nRad2, colRingInactive, nDrawEnd, nDrawVal);
+    gslc_DrawFillSectorBase(pGui, nQuality, nMidX, nMidY, nRad1, nRad2, colRingInactive, colRingInactive, false,
+      0, 0, nDrawEnd, nDrawVal, &pXRingGauge->sPolarCache);
   }
 
   // --------------------------------------------------------------------------
@@ -356,6 +357,7 @@ void gslc_ElemXRingGaugeSetThickness(gslc_tsGui* pGui, gslc_tsElemRef* pElemRef,
   if (!pXRingGauge) return;
 
   pXRingGauge->nThickness = nThickness;
+  gslc_PolarCacheReset(&pXRingGauge->sPolarCache);
 
   // Mark for full redraw
   gslc_ElemSetRedraw(pGui,pElemRef,GSLC_REDRAW_FULL);
@@ -408,10 +410,19 @@ void gslc_ElemXRingGaugeSetQuality(gslc_tsGui* pGui, gslc_tsElemRef* pElemRef, u
 
   nSegments = (nSegments == 0) ? 72 : nSegments; // Guard against div/0 with default
   pXRingGauge->nQuality = nSegments;
+  gslc_PolarCacheReset(&pXRingGauge->sPolarCache);
 
   // Mark for full redraw
   gslc_ElemSetRedraw(pGui,pElemRef,GSLC_REDRAW_FULL);
 }
 
+void gslc_ElemXRingGaugeSetPolarCache(gslc_tsGui* pGui, gslc_tsElemRef* pElemRef, gslc_tsPt* asPt, uint16_t nPtMax)
+{
+  gslc_tsXRingGauge* pXRingGauge = (gslc_tsXRingGauge*)gslc_GetXDataFromRef(pGui, pElemRef, GSLC_TYPEX_RING, __LINE__);
+  if (!pXRingGauge) return;
+
+  gslc_PolarCacheInit(&pXRingGauge->sPolarCache, asPt, nPtMax);
+}
+
 
 // ============================================================================
@@ -70,6 +70,10 @@ extern "C" {
 
 #define XRING_STR_MAX 10
 
+/// Number of points required by gslc_ElemXRingGaugeSetPolarCache()
+/// to cache the ring vertices at the given quality setting
+#define XRING_POLAR_CACHE_PTS(nQuality) (2*(nQuality))
+
 /// Extended data for XRingGauge element
 typedef struct {
   // Config
@@ -92,6 +96,7 @@ typedef struct {
   int16_t           nVal;           ///< Current position value
   int16_t           nValLast;       ///< Previous position value
   char              acStrLast[XRING_STR_MAX];
+  gslc_tsPolarCache sPolarCache;    ///< Cache of ring vertices
 
   // Callbacks
 
@@ -216,6 +221,25 @@ void gslc_ElemXRingGaugeSetThickness(gslc_tsGui* pGui, gslc_tsElemRef* pElemRef,
 ///
 void gslc_ElemXRingGaugeSetQuality(gslc_tsGui* pGui, gslc_tsElemRef* pElemRef, uint16_t nSegments);
 
+/// Assigns a buffer used to cache the vertices of the ring, avoiding the
+/// recalculation of the vertices during each redraw. The vertices are
+/// calculated during the first redraw after the quality, thickness or
+/// buffer has been set.
+/// - The buffer must hold XRING_POLAR_CACHE_PTS(nSegments) points for
+///   the quality setting in use. If the buffer is too small (eg. after
+///   increasing the quality), the vertices are calculated during each
+///   redraw instead.
+/// - By default no buffer is assigned.
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  pElemRef:    Pointer to Element reference
+/// \param[in]  asPt:        Buffer of points (or NULL to disable caching)
+/// \param[in]  nPtMax:      Maximum number of points in asPt
+///
+/// \return none
+///
+void gslc_ElemXRingGaugeSetPolarCache(gslc_tsGui* pGui, gslc_tsElemRef* pElemRef, gslc_tsPt* asPt, uint16_t nPtMax);
+
 /// Defines the color of the inactive region to be a flat (constant) color.
 /// The inactive color is often set to be the same as the background but it can
 /// be set to a different color to indicate the remainder of the value range that is yet to be filled.
@@ -0,0 +1,313 @@
+//
+// GUIslice Library Tools
+// - Calvin Hass
+// - https://www.impulseadventure.com/elec/guislice-gui.html
+// - https://github.com/ImpulseAdventure/GUIslice
+// - img2rle16: Convert a BMP file into a run-length encoded RGB565
+//   image array (GSLC_IMGREF_FMT_RLE16)
+//   - Pixels that match the transparent color are stored as
+//     transparent runs, so drawing skips them without a per-pixel
+//     color comparison
+//   - Runs of a single color are stored once, other pixels are
+//     stored as literal runs
+//   - The output is a C file in the same form as the flash image
+//     arrays used with GSLC_IMGREF_FMT_BMP24
+//
+// USAGE:
+//   make && ./img2rle16 [-t RRGGBB | -T] [-n name] input.bmp > output.c
+//   -t RRGGBB : Transparent color (default FF00FF, magenta)
+//   -T        : Disable transparency
+//   -n name   : Array name (default: input filename without extension)
+//
+// The resulting array is drawn with:
+//   gslc_GetImageFromProg((const unsigned char*)name,GSLC_IMGREF_FMT_RLE16)
+//
+// The run format is described with GSLC_IMG_RLE16_* in GUIslice.h
+//
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <ctype.h>
+
+// Run format (see GUIslice.h)
+#define RLE16_SKIP      0x0000
+#define RLE16_FILL      0x4000
+#define RLE16_COPY      0x8000
+#define RLE16_LEN_MAX   0x3FFF
+
+// Minimum length of a run of one color to store it as a fill run.
+// Shorter runs are cheaper to store as part of a literal run.
+#define RLE16_FILL_MIN  3
+
+typedef struct {
+  int32_t   nW;         ///< Image width
+  int32_t   nH;         ///< Image height
+  uint32_t* pnRgb;      ///< Pixels as 0xRRGGBB (top row first)
+} tsImg;
+
+typedef struct {
+  uint16_t* pnWord;     ///< Output words
+  uint32_t  nCnt;       ///< Number of words
+  uint32_t  nMax;       ///< Allocated words
+} tsOut;
+
+uint32_t Read16(const uint8_t* pBuf)
+{
+  return pBuf[0] | (pBuf[1] << 8);
+}
+
+uint32_t Read32(const uint8_t* pBuf)
+{
+  return pBuf[0] | (pBuf[1] << 8) | (pBuf[2] << 16) | ((uint32_t)pBuf[3] << 24);
+}
+
+// Load an uncompressed 24-bit BMP file
+bool LoadBmp(const char* pFname,tsImg* pImg)
+{
+  FILE*     pFile;
+  uint8_t*  pBuf;
+  long      nLen;
+  uint32_t  nOffset, nRowSize;
+  int32_t   nH, nRow, nCol, nFileRow;
+  bool      bTopDown = false;
+
+  if ((pFile = fopen(pFname,"rb")) == NULL) {
+    fprintf(stderr,"ERROR: Can't open [%s]\n",pFname);
+    return false;
+  }
+  fseek(pFile,0,SEEK_END);
+  nLen = ftell(pFile);
+  fseek(pFile,0,SEEK_SET);
+  pBuf = (uint8_t*)malloc(nLen > 0 ? nLen : 1);
+  if ((pBuf == NULL) || (nLen < 54) || (fread(pBuf,1,nLen,pFile) != (size_t)nLen)) {
+    fprintf(stderr,"ERROR: Can't read [%s]\n",pFname);
+    fclose(pFile);
+    free(pBuf);
+    return false;
+  }
+  fclose(pFile);
+
+  nOffset = Read32(&pBuf[10]);
+  pImg->nW = (int32_t)Read32(&pBuf[18]);
+  nH       = (int32_t)Read32(&pBuf[22]);
+  if ((Read16(&pBuf[0]) != 0x4D42) || (Read16(&pBuf[26]) != 1) ||
+      (Read16(&pBuf[28]) != 24) || (Read32(&pBuf[30]) != 0)) {
+    fprintf(stderr,"ERROR: [%s] is not an uncompressed 24-bit BMP\n",pFname);
+    free(pBuf);
+    return false;
+  }
+  if (nH < 0) {
+    nH = -nH;
+    bTopDown = true;
+  }
+  pImg->nH = nH;
+  nRowSize = ((uint32_t)pImg->nW * 3 + 3) & ~3;
+  if ((pImg->nW <= 0) || (pImg->nW > 0x7FFF) || (nH == 0) || (nH > 0x7FFF) ||
+      ((uint32_t)nLen < nOffset + nRowSize * (nH - 1) + pImg->nW * 3)) {
+    fprintf(stderr,"ERROR: [%s] has invalid dimensions\n",pFname);
+    free(pBuf);
+    return false;
+  }
+
+  pImg->pnRgb = (uint32_t*)malloc(sizeof(uint32_t) * pImg->nW * nH);
+  for (nRow=0;nRow<nH;nRow++) {
+    nFileRow = (bTopDown) ? nRow : (nH - 1 - nRow);
+    const uint8_t* pSrc = pBuf + nOffset + nFileRow * nRowSize;
+    for (nCol=0;nCol<pImg->nW;nCol++) {
+      pImg->pnRgb[nRow*pImg->nW + nCol] = ((uint32_t)pSrc[2] << 16) | (pSrc[1] << 8) | pSrc[0];
+      pSrc += 3;
+    }
+  }
+  free(pBuf);
+  return true;
+}
+
+void OutAdd(tsOut* pOut,uint16_t nWord)
+{
+  if (pOut->nCnt == pOut->nMax) {
+    pOut->nMax   = (pOut->nMax) ? pOut->nMax * 2 : 1024;
+    pOut->pnWord = (uint16_t*)realloc(pOut->pnWord,sizeof(uint16_t) * pOut->nMax);
+  }
+  pOut->pnWord[pOut->nCnt++] = nWord;
+}
+
+uint16_t RgbTo565(uint32_t nRgb)
+{
+  return (uint16_t)(((nRgb >> 8) & 0xF800) | ((nRgb >> 5) & 0x07E0) | ((nRgb >> 3) & 0x001F));
+}
+
+// Encode one row of pixels as a sequence of runs
+// - Transparency is determined from the original 24-bit color so that
+//   only exact matches with the transparent color are skipped
+void EncodeRow(const uint32_t* pnRgb,int32_t nW,bool bTrans,uint32_t nTransRgb,tsOut* pOut)
+{
+  int32_t nCol = 0;
+  int32_t nLen;
+  while (nCol < nW) {
+    if ((bTrans) && (pnRgb[nCol] == nTransRgb)) {
+      // Transparent run
+      nLen = 1;
+      while ((nCol + nLen < nW) && (nLen < RLE16_LEN_MAX) && (pnRgb[nCol+nLen] == nTransRgb)) {
+        nLen++;
+      }
+      OutAdd(pOut,RLE16_SKIP | nLen);
+      nCol += nLen;
+      continue;
+    }
+    // Measure the run of a single display color
+    nLen = 1;
+    while ((nCol + nLen < nW) && (nLen < RLE16_LEN_MAX) &&
+           (!bTrans || (pnRgb[nCol+nLen] != nTransRgb)) &&
+           (RgbTo565(pnRgb[nCol+nLen]) == RgbTo565(pnRgb[nCol]))) {
+      nLen++;
+    }
+    if (nLen >= RLE16_FILL_MIN) {
+      OutAdd(pOut,RLE16_FILL | nLen);
+      OutAdd(pOut,RgbTo565(pnRgb[nCol]));
+      nCol += nLen;
+      continue;
+    }
+    // Literal run until a transparent pixel or the start of a fill run
+    nLen = 0;
+    while ((nCol + nLen < nW) && (nLen < RLE16_LEN_MAX)) {
+      const uint32_t* pPix = &pnRgb[nCol+nLen];
+      if ((bTrans) && (pPix[0] == nTransRgb)) {
+        break;
+      }
+      if ((nLen > 0) && (nCol + nLen + RLE16_FILL_MIN <= nW)) {
+        int32_t nInd;
+        for (nInd=1;nInd<RLE16_FILL_MIN;nInd++) {
+          if (((bTrans) && (pPix[nInd] == nTransRgb)) || (RgbTo565(pPix[nInd]) != RgbTo565(pPix[0]))) {
+            break;
+          }
+        }
+        if (nInd == RLE16_FILL_MIN) {
+          break;
+        }
+      }
+      nLen++;
+    }
+    OutAdd(pOut,RLE16_COPY | nLen);
+    for (int32_t nInd=0;nInd<nLen;nInd++) {
+      OutAdd(pOut,RgbTo565(pnRgb[nCol+nInd]));
+    }
+    nCol += nLen;
+  }
+}
+
+void Usage(void)
+{
+  fprintf(stderr,"Usage: img2rle16 [-t RRGGBB | -T] [-n name] input.bmp > output.c\n");
+}
+
+int main(int argc,char* argv[])
+{
+  const char* pFname = NULL;
+  const char* pName = NULL;
+  char        acName[64];
+  bool        bTrans = true;
+  uint32_t    nTransRgb = 0xFF00FF;
+  tsImg       sImg;
+  tsOut       sOut = { NULL, 0, 0 };
+  int         nArg;
+  int32_t     nRow;
+  uint32_t    nInd, nRowStart;
+
+  for (nArg=1;nArg<argc;nArg++) {
+    if ((strcmp(argv[nArg],"-t") == 0) && (nArg+1 < argc)) {
+      nTransRgb = (uint32_t)strtoul(argv[++nArg],NULL,16);
+    } else if (strcmp(argv[nArg],"-T") == 0) {
+      bTrans = false;
+    } else if ((strcmp(argv[nArg],"-n") == 0) && (nArg+1 < argc)) {
+      pName = argv[++nArg];
+    } else if ((argv[nArg][0] != '-') && (pFname == NULL)) {
+      pFname = argv[nArg];
+    } else {
+      Usage();
+      return 1;
+    }
+  }
+  if (pFname == NULL) {
+    Usage();
+    return 1;
+  }
+  if (!LoadBmp(pFname,&sImg)) {
+    return 1;
+  }
+
+  // Default the array name to the input filename without path or
+  // extension, replacing any characters not valid in an identifier
+  const char* pBase = strrchr(pFname,'/');
+  pBase = (pBase) ? pBase + 1 : pFname;
+  if (pName == NULL) {
+    for (nInd=0;(pBase[nInd] != '\0') && (pBase[nInd] != '.') && (nInd < sizeof(acName)-1);nInd++) {
+      acName[nInd] = (isalnum((unsigned char)pBase[nInd])) ? pBase[nInd] : '_';
+    }
+    acName[nInd] = '\0';
+    pName = acName;
+  }
+
+  // Encode the rows, recording where each row starts for the comments
+  uint32_t* pnRowStart = (uint32_t*)malloc(sizeof(uint32_t) * (sImg.nH + 1));
+  for (nRow=0;nRow<sImg.nH;nRow++) {
+    pnRowStart[nRow] = sOut.nCnt;
+    EncodeRow(&sImg.pnRgb[nRow*sImg.nW],sImg.nW,bTrans,nTransRgb,&sOut);
+  }
+  pnRowStart[sImg.nH] = sOut.nCnt;
+
+  // The run word count is stored in a 16-bit header word
+  if (sOut.nCnt > 0xFFFF) {
+    fprintf(stderr,"ERROR: [%s] needs %u run words (max 65535)\n",pFname,sOut.nCnt);
+    free(pnRowStart);
+    free(sOut.pnWord);
+    free(sImg.pnRgb);
+    return 1;
+  }
+
+  uint32_t nBytesRaw = 4 + (uint32_t)sImg.nW * sImg.nH * 2;
+  uint32_t nBytesRle = 6 + sOut.nCnt * 2;
+
+  printf("// Generated by   : img2rle16 (GUIslice)\n");
+  printf("// Generated from : %s\n",pBase);
+  printf("// Image Size     : %dx%d pixels\n",sImg.nW,sImg.nH);
+  printf("// Memory usage   : %u bytes (%u bytes as BMP24 array)\n",nBytesRle,nBytesRaw);
+  if (bTrans) {
+    printf("// Transparent    : 0x%06X\n",nTransRgb);
+  } else {
+    printf("// Transparent    : none\n");
+  }
+  printf("//\n");
+  printf("// Draw with gslc_GetImageFromProg((const unsigned char*)%s,GSLC_IMGREF_FMT_RLE16)\n",pName);
+  printf("\n");
+  printf("#include \"GUIslice.h\"\n");
+  printf("#include \"GUIslice_config.h\"\n");
+  printf("#if (GSLC_USE_PROGMEM)\n");
+  printf("  #if defined(__AVR__)\n");
+  printf("    #include <avr/pgmspace.h>\n");
+  printf("  #else\n");
+  printf("    #include <pgmspace.h>\n");
+  printf("  #endif\n");
+  printf("#endif\n");
+  printf("\n");
+  printf("const unsigned short %s[%u+3] GSLC_PMEM ={\n",pName,sOut.nCnt);
+  printf("%d, // Height of image\n",sImg.nH);
+  printf("%d, // Width of image\n",sImg.nW);
+  printf("%u, // Number of run words\n",sOut.nCnt);
+  for (nRow=0;nRow<sImg.nH;nRow++) {
+    nRowStart = pnRowStart[nRow];
+    for (nInd=nRowStart;nInd<pnRowStart[nRow+1];nInd++) {
+      printf("0x%04X,%s",sOut.pnWord[nInd],(((nInd - nRowStart) % 16) == 15) ? "\n" : " ");
+    }
+    printf("  // Row %d\n",nRow);
+  }
+  printf("};\n");
+
+  fprintf(stderr,"%s: %dx%d, %u bytes (%u bytes as BMP24 array)\n",pBase,sImg.nW,sImg.nH,nBytesRle,nBytesRaw);
+
+  free(pnRowStart);
+  free(sOut.pnWord);
+  free(sImg.pnRgb);
+  return 0;
+}